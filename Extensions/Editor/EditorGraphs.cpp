@@ -93,6 +93,25 @@ public:
   }
 };
 
+//--------------------------------------------------------- Frame Memory Sampler
+class FrameMemorySampler : public DataSampler
+{
+public:
+  void Setup(RangeData& data, EntryLabel& label) override
+  {
+    label.Name = "Frame Memory Peak KB";
+    data.AutoNormalized = true;
+    data.MinValue = 0;
+    data.MaxValue = 1024.0f;
+  }
+
+  float Sample() override
+  {
+    // High water mark of any one thread's frame arena
+    return FrameAllocator::GetHighWaterMark() / 1024.0f;
+  }
+};
+
 class ObjectSampler : public DataSampler
 {
   void Setup(RangeData& data, EntryLabel& label) override
@@ -155,6 +174,7 @@ void AddGraph(Editor* editor)
   graph->SetSize(Pixels(280, 400));
   graph->AddSampler(new FpsSampler());
   graph->AddSampler(new MemorySampler());
+  graph->AddSampler(new FrameMemorySampler());
   graph->AddSampler(new ObjectSampler());
   editor->AddManagedWidget(graph, DockArea::Floating, true);
 }
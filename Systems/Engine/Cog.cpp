@@ -158,7 +158,7 @@ ZilchDefineType(Cog, builder, type)
   ZilchBindMethod(FindRootArchetype);
 
   // Events
-  ZilchBindMethod(DispatchEvent);
+  ZilchBindOverloadedMethod(DispatchEvent, ZilchInstanceOverload(void, StringParam, Event*));
   ZilchBindMethod(DispatchUp);
   ZilchBindMethod(DispatchDown);
 
@@ -529,6 +529,9 @@ void Cog::Initialize(CogInitializer& initializer)
     component->mOwner = this;
     component->Initialize(initializer);
 
+    if(mSpace)
+      mSpace->mComponentStore.Add(component);
+
     BoundType* componentType = ZilchVirtualTypeId(component);
     forRange(CogComponentMeta* meta, componentType->HasAll<CogComponentMeta>())
     {
@@ -602,6 +605,9 @@ void Cog::ForceAddComponent(Component* component, int index)
   component->mOwner = this;
   component->Initialize(initializer);
 
+  if(mSpace)
+    mSpace->mComponentStore.Add(component);
+
   //Do this now
   component->OnAllObjectsCreated(initializer);
 
@@ -885,6 +891,9 @@ void Cog::RemoveComponentInternal(Component* component)
   mComponentMap.EraseEqualValues(component);
   eraseEqualValues(mComponents, component);
 
+  if(mSpace)
+    mSpace->mComponentStore.Remove(component);
+
   // Delete the component
   component->Delete();
 }
@@ -957,7 +966,12 @@ void Cog::DeleteComponents()
   ComponentRange range = mComponents.All();
   uint numberOfComponents = mComponents.Size();
   for (uint i = 0; i < numberOfComponents; ++i)
-    mComponents[numberOfComponents - 1 - i]->Delete();
+  {
+    Component* component = mComponents[numberOfComponents - 1 - i];
+    if(mSpace)
+      mSpace->mComponentStore.Remove(component);
+    component->Delete();
+  }
 
   //Clear all components
   mComponents.Clear();
@@ -1942,6 +1956,12 @@ void Cog::DispatchEvent(StringParam eventId, Event* event)
   GetDispatcher()->Dispatch(eventId, event);
 }
 
+//**************************************************************************************************
+void Cog::DispatchEvent(const EventName& eventId, Event* event)
+{
+  GetDispatcher()->Dispatch(eventId, event);
+}
+
 //**************************************************************************************************
 void Cog::DispatchUp(StringParam eventId, Event* event)
 {
@@ -1978,6 +1998,12 @@ bool Cog::HasReceivers(StringParam eventId)
   return GetDispatcher()->HasReceivers(eventId);
 }
 
+//**************************************************************************************************
+bool Cog::HasReceivers(const EventName& eventId)
+{
+  return GetDispatcher()->HasReceivers(eventId);
+}
+
 //**************************************************************************************************
 EventDispatcher* Cog::GetDispatcherObject()
 {
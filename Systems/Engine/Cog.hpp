@@ -339,6 +339,7 @@ public:
   //------------------------------------------------------------------------------------ Events
   /// Dispatches an event on this object
   void DispatchEvent(StringParam eventId, Event* event);
+  void DispatchEvent(const EventName& eventId, Event* event);
 
   /// Dispatches an event up the tree on each parent recursively (pre-order traversal)
   void DispatchUp(StringParam eventId, Event* event);
@@ -348,6 +349,7 @@ public:
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const EventName& eventId);
 
   //----- Internals
   EventDispatcher* GetDispatcherObject();
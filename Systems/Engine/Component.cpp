@@ -62,7 +62,7 @@ ZilchDefineType(Component, builder, type)
 }
 
 //**************************************************************************************************
-Component::Component() : mOwner(NULL)
+Component::Component() : mOwner(NULL), mSpaceStoreIndex(ComponentStore::cNotStored)
 {
 }
 
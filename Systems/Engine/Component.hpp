@@ -131,6 +131,9 @@ public:
   /// Each component has a pointer back to the base owning composition.
   Cog* mOwner;
 
+  /// Index in the space's ComponentStore array for this component's type.
+  uint mSpaceStoreIndex;
+
 private:
   /// Only Cogs can destroy their Components.
   virtual void OnDestroy(uint flags = 0) {}
@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file ComponentStore.cpp
+/// Implementation of the per space component arrays used by Space::Query.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+//------------------------------------------------------------ Component Store
+Component* ComponentStore::TypeEntry::Find(Cog* owner)
+{
+  uint* index = OwnerIndices.FindPointer(owner);
+  if(index == nullptr)
+    return nullptr;
+  return Components[*index];
+}
+
+uint ComponentStore::MatchingArrays::GetComponentCount()
+{
+  uint count = 0;
+  for(uint i = 0; i < Entries.Size(); ++i)
+    count += Entries[i]->Components.Size();
+  return count;
+}
+
+Component* ComponentStore::MatchingArrays::FindOwned(Cog* owner, uint entryCount)
+{
+  for(uint i = 0; i < entryCount; ++i)
+  {
+    if(Component* component = Entries[i]->Find(owner))
+      return component;
+  }
+  return nullptr;
+}
+
+void ComponentStore::AddReference(MatchingArrays* matching)
+{
+  if(matching)
+    ++matching->References;
+}
+
+void ComponentStore::ReleaseReference(MatchingArrays* matching)
+{
+  if(matching && --matching->References == 0)
+    delete matching;
+}
+
+ComponentStore::ComponentStore()
+{
+}
+
+ComponentStore::~ComponentStore()
+{
+  // Ranges still holding on to a matching list will see it empty
+  forRange(MatchingArrays* matching, mMatching.Values())
+  {
+    matching->Entries.Clear();
+    ReleaseReference(matching);
+  }
+  DeleteObjectsInContainer(mEntries);
+}
+
+void ComponentStore::Add(Component* component)
+{
+  if(component->mSpaceStoreIndex != cNotStored)
+    return;
+
+  BoundType* componentType = ZilchVirtualTypeId(component);
+  if(!componentType->Native)
+    return;
+
+  TypeEntry* entry = GetEntry(componentType);
+  component->mSpaceStoreIndex = entry->Components.Size();
+  entry->Components.PushBack(component);
+  entry->OwnerIndices.Insert(component->mOwner, component->mSpaceStoreIndex);
+}
+
+void ComponentStore::Remove(Component* component)
+{
+  uint index = component->mSpaceStoreIndex;
+  if(index == cNotStored)
+    return;
+
+  TypeEntry* entry = mEntries.FindValue(ZilchVirtualTypeId(component), nullptr);
+  ReturnIf(entry == nullptr, , "Component was stored under a type that doesn't exist.");
+
+  ComponentArray& components = entry->Components;
+  Component* last = components.Back();
+  components[index] = last;
+  last->mSpaceStoreIndex = index;
+  components.PopBack();
+
+  entry->OwnerIndices.Erase(component->mOwner);
+  if(last != component)
+    entry->OwnerIndices[last->mOwner] = index;
+
+  component->mSpaceStoreIndex = cNotStored;
+}
+
+ComponentStore::ComponentArray* ComponentStore::GetExact(BoundType* componentType)
+{
+  TypeEntry* entry = mEntries.FindValue(componentType, nullptr);
+  if(entry == nullptr)
+    return nullptr;
+  return &entry->Components;
+}
+
+ComponentStore::MatchingArrays* ComponentStore::GetMatching(BoundType* componentType)
+{
+  if(MatchingArrays* matching = mMatching.FindValue(componentType, nullptr))
+    return matching;
+
+  // Only built once per queried type, GetEntry appends types stored later
+  MatchingArrays* matching = new MatchingArrays();
+  mMatching.Insert(componentType, matching);
+  forRange(TypeEntry* entry, mEntries.Values())
+  {
+    if(Matches(entry->Type, componentType))
+      matching->Entries.PushBack(entry);
+  }
+  return matching;
+}
+
+ComponentStore::TypeEntry* ComponentStore::GetEntry(BoundType* componentType)
+{
+  TypeEntry* entry = mEntries.FindValue(componentType, nullptr);
+  if(entry == nullptr)
+  {
+    entry = new TypeEntry();
+    entry->Type = componentType;
+    mEntries.Insert(componentType, entry);
+
+    // The new type may match previous queries
+    forRange(MatchingMap::value_type& pair, mMatching.All())
+    {
+      if(Matches(componentType, pair.first))
+        pair.second->Entries.PushBack(entry);
+    }
+  }
+  return entry;
+}
+
+bool ComponentStore::Matches(BoundType* storedType, BoundType* queryType)
+{
+  if(storedType->IsA(queryType))
+    return true;
+
+  forRange(CogComponentMeta* meta, storedType->HasAll<CogComponentMeta>())
+  {
+    if(meta->mInterfaces.Contains(queryType))
+      return true;
+  }
+  return false;
+}
+
+//------------------------------------------------------ Component Query Range
+ComponentQueryRange::ComponentQueryRange()
+  : mMatching(nullptr),
+    mRequired(nullptr),
+    mWalkRequired(false),
+    mEntryIndex(0),
+    mIndex(0),
+    mProbeIndex(0),
+    mCurrent(nullptr)
+{
+}
+
+ComponentQueryRange::ComponentQueryRange(ComponentStore::MatchingArrays* matching,
+                                         ComponentStore::MatchingArrays* required)
+  : mMatching(matching),
+    mRequired(required),
+    mWalkRequired(false),
+    mEntryIndex(0),
+    mIndex(0),
+    mProbeIndex(0),
+    mCurrent(nullptr)
+{
+  ComponentStore::AddReference(mMatching);
+  ComponentStore::AddReference(mRequired);
+
+  // Each component walked costs one owner map lookup per entry of the other
+  // type, so walk whichever type has fewer components
+  if(mMatching != nullptr && mRequired != nullptr)
+    mWalkRequired = mRequired->GetComponentCount() < mMatching->GetComponentCount();
+
+  SkipFiltered();
+}
+
+ComponentQueryRange::ComponentQueryRange(const ComponentQueryRange& other)
+  : mMatching(other.mMatching),
+    mRequired(other.mRequired),
+    mWalkRequired(other.mWalkRequired),
+    mEntryIndex(other.mEntryIndex),
+    mIndex(other.mIndex),
+    mProbeIndex(other.mProbeIndex),
+    mCurrent(other.mCurrent)
+{
+  ComponentStore::AddReference(mMatching);
+  ComponentStore::AddReference(mRequired);
+}
+
+ComponentQueryRange::~ComponentQueryRange()
+{
+  ComponentStore::ReleaseReference(mMatching);
+  ComponentStore::ReleaseReference(mRequired);
+}
+
+ComponentQueryRange& ComponentQueryRange::operator=(const ComponentQueryRange& other)
+{
+  ComponentStore::AddReference(other.mMatching);
+  ComponentStore::AddReference(other.mRequired);
+  ComponentStore::ReleaseReference(mMatching);
+  ComponentStore::ReleaseReference(mRequired);
+  mMatching = other.mMatching;
+  mRequired = other.mRequired;
+  mWalkRequired = other.mWalkRequired;
+  mEntryIndex = other.mEntryIndex;
+  mIndex = other.mIndex;
+  mProbeIndex = other.mProbeIndex;
+  mCurrent = other.mCurrent;
+  return *this;
+}
+
+Component* ComponentQueryRange::Front()
+{
+  ErrorIf(mCurrent == nullptr, "Accessed an empty component query range.");
+  return mCurrent;
+}
+
+void ComponentQueryRange::PopFront()
+{
+  // When walking the required type the same owner may have more of the
+  // queried components left to probe
+  if(!mWalkRequired)
+    ++mIndex;
+  SkipFiltered();
+}
+
+bool ComponentQueryRange::Empty()
+{
+  return mCurrent == nullptr;
+}
+
+void ComponentQueryRange::SkipFiltered()
+{
+  mCurrent = nullptr;
+  if(mMatching == nullptr)
+    return;
+
+  if(mWalkRequired)
+  {
+    SkipFilteredByRequired();
+    return;
+  }
+
+  // The sizes are checked every step, components can be removed while iterating
+  Array<ComponentStore::TypeEntry*>& entries = mMatching->Entries;
+  for(; mEntryIndex < entries.Size(); ++mEntryIndex, mIndex = 0)
+  {
+    ComponentStore::ComponentArray& components = entries[mEntryIndex]->Components;
+    for(; mIndex < components.Size(); ++mIndex)
+    {
+      Component* component = components[mIndex];
+      if(mRequired == nullptr || mRequired->FindOwned(component->mOwner, mRequired->Entries.Size()))
+      {
+        mCurrent = component;
+        return;
+      }
+    }
+  }
+}
+
+void ComponentQueryRange::SkipFilteredByRequired()
+{
+  Array<ComponentStore::TypeEntry*>& entries = mRequired->Entries;
+  Array<ComponentStore::TypeEntry*>& queried = mMatching->Entries;
+  for(; mEntryIndex < entries.Size(); ++mEntryIndex, mIndex = 0, mProbeIndex = 0)
+  {
+    ComponentStore::ComponentArray& components = entries[mEntryIndex]->Components;
+    for(; mIndex < components.Size(); ++mIndex, mProbeIndex = 0)
+    {
+      Cog* owner = components[mIndex]->mOwner;
+
+      // An owner with several of the required components is only
+      // walked from the first entry it's in so it isn't returned twice
+      if(mProbeIndex == 0 && mRequired->FindOwned(owner, mEntryIndex) != nullptr)
+        continue;
+
+      while(mProbeIndex < queried.Size())
+      {
+        Component* component = queried[mProbeIndex]->Find(owner);
+        ++mProbeIndex;
+        if(component != nullptr)
+        {
+          mCurrent = component;
+          return;
+        }
+      }
+    }
+  }
+}
+
+}//namespace Zero
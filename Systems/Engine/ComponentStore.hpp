@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file ComponentStore.hpp
+/// Declaration of the per space component arrays used by Space::Query.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+class Component;
+
+//------------------------------------------------------------ Component Store
+/// Every initialized native component in a space, kept in one dense array
+/// per component type. Systems (and scripts through Space.QueryComponents)
+/// iterate these arrays instead of walking cogs and looking each component
+/// up through Cog::QueryComponentType. Only native types are stored, script
+/// types come and go with every recompile.
+class ComponentStore
+{
+public:
+  static const uint cNotStored = (uint)-1;
+
+  typedef Array<Component*> ComponentArray;
+
+  /// The components of one exact type. A cog only has one component of each
+  /// type, so the owner map gives a cog's component without touching the cog.
+  struct TypeEntry
+  {
+    /// The owner's component of this type (null if it doesn't have one).
+    Component* Find(Cog* owner);
+
+    BoundType* Type;
+    ComponentArray Components;
+    /// Index of each owner's component in Components
+    HashMap<Cog*, uint> OwnerIndices;
+  };
+
+  /// The entries of every stored type that matches one queried type. Shared
+  /// by the store and every query range iterating it, the last one to let
+  /// go deletes it. The store clears it when destroyed so ranges that outlive
+  /// the store end instead of reading freed arrays.
+  struct MatchingArrays
+  {
+    MatchingArrays() : References(1) {}
+
+    /// How many components all the entries hold.
+    uint GetComponentCount();
+    /// The owner's component in the entries before entryCount (null if none).
+    Component* FindOwned(Cog* owner, uint entryCount);
+
+    Array<TypeEntry*> Entries;
+    uint References;
+  };
+
+  static void AddReference(MatchingArrays* matching);
+  static void ReleaseReference(MatchingArrays* matching);
+
+  ComponentStore();
+  ~ComponentStore();
+
+  /// Adds the component under its type. Does nothing for script components
+  /// or components that are already stored.
+  void Add(Component* component);
+  /// Removes the component, the last component of its type takes its place.
+  void Remove(Component* component);
+
+  /// The components of exactly the given type (null if there are none).
+  ComponentArray* GetExact(BoundType* componentType);
+  /// The entries of every stored type that is, derives from, or implements
+  /// (as a component interface) the given type. Types stored later are
+  /// appended to it.
+  MatchingArrays* GetMatching(BoundType* componentType);
+
+private:
+  TypeEntry* GetEntry(BoundType* componentType);
+  static bool Matches(BoundType* storedType, BoundType* queryType);
+
+  HashMap<BoundType*, TypeEntry*> mEntries;
+  /// Results of GetMatching by queried type
+  typedef HashMap<BoundType*, MatchingArrays*> MatchingMap;
+  MatchingMap mMatching;
+};
+
+//------------------------------------------------------ Component Query Range
+/// Range over the components returned by a space query. When a required
+/// type is given, components whose owner doesn't have that type are skipped.
+/// The required type's components are looked up in the store's owner maps,
+/// and whichever of the two types has fewer components is the one walked, so
+/// the order isn't defined. Components can be added or removed while
+/// iterating (the front one included), they may be skipped or visited.
+/// The range shares the store's matching arrays rather than copying them.
+class ComponentQueryRange
+{
+public:
+  typedef Component* value_type;
+  typedef Component* return_type;
+  typedef Component* FrontResult;
+
+  ComponentQueryRange();
+  ComponentQueryRange(ComponentStore::MatchingArrays* matching,
+                      ComponentStore::MatchingArrays* required = nullptr);
+  ComponentQueryRange(const ComponentQueryRange& other);
+  ~ComponentQueryRange();
+
+  ComponentQueryRange& operator=(const ComponentQueryRange& other);
+
+  Component* Front();
+  void PopFront();
+  bool Empty();
+
+  ComponentQueryRange& All() { return *this; }
+
+private:
+  /// Moves forward to the next component that passes the filter
+  void SkipFiltered();
+  /// Same, but walks the required type's components and finds the queried
+  /// components of their owners.
+  void SkipFilteredByRequired();
+
+  ComponentStore::MatchingArrays* mMatching;
+  ComponentStore::MatchingArrays* mRequired;
+  /// Walking mRequired's entries instead of mMatching's
+  bool mWalkRequired;
+  uint mEntryIndex;
+  uint mIndex;
+  /// The next of mMatching's entries to look for the owner in (mWalkRequired)
+  uint mProbeIndex;
+  /// Kept rather than indexed again so removing it doesn't move the front
+  Component* mCurrent;
+};
+
+/// ComponentQueryRange that returns the queried type.
+template <typename type>
+class TypedComponentQueryRange : public ComponentQueryRange
+{
+public:
+  typedef type* value_type;
+  typedef type* return_type;
+  typedef type* FrontResult;
+
+  TypedComponentQueryRange() {}
+  TypedComponentQueryRange(const ComponentQueryRange& range)
+    : ComponentQueryRange(range) {}
+
+  type* Front() { return (type*)ComponentQueryRange::Front(); }
+  TypedComponentQueryRange& All() { return *this; }
+};
+
+}//namespace Zero
@@ -167,6 +167,9 @@ void Engine::Update()
   UpdateEvent toSend(dt, dt, mTimePassed, 0);
   DispatchEvent(Events::EngineUpdate, &toSend);
 
+  // Frame memory from the last frame is no longer valid after this
+  FrameAllocator::EndFrame();
+
   ++mFrameCounter;
 }
 
@@ -15,6 +15,7 @@ ZilchDefineRange(HierarchyListNameRange);
 ZilchDefineRange(HierarchyRange);
 ZilchDefineRange(CogNameRange);
 ZilchDefineRange(CogRootNameRange);
+ZilchDefineRange(ComponentQueryRange);
 ZilchDefineRange(HierarchyList::range);
 ZilchDefineRange(HierarchyList::reverse_range);
 ZilchDefineRange(Space::range);
@@ -117,6 +118,7 @@ ZilchDefineStaticLibrary(EngineLibrary)
   ZilchInitializeRange(HierarchyRange);
   ZilchInitializeRange(CogNameRange);
   ZilchInitializeRange(CogRootNameRange);
+  ZilchInitializeRange(ComponentQueryRange);
   ZilchInitializeRangeAs(HierarchyList::range, "HierarchyListRange");
   ZilchInitializeRangeAs(HierarchyList::reverse_range, "HierarchyListReverseRange");
   ZilchInitializeRangeAs(Space::range, "SpaceRange");
@@ -440,6 +442,10 @@ bool EngineLibrary::Initialize(ZeroStartupSettings& settings)
   // Start the profiling system used to performance counters and timers. 
   Profile::ProfileSystem::Initialize();
 
+  // Record a timeline of every thread to write out at shutdown
+  if(!environment->GetParsedArgument("profileTrace").Empty())
+    Profile::ProfileSystem::Instance->BeginCapture();
+
   // Load the debug drawer.
   Debug::DebugDraw::Initialize();
 
@@ -519,6 +525,14 @@ void EngineLibrary::Shutdown()
   // systems are never deleted.
   ShutdownThreadSystem();
 
+  // All worker threads have finished writing to their timelines
+  Profile::ProfileSystem* profiler = Profile::ProfileSystem::Instance;
+  if(profiler->IsCapturing())
+  {
+    profiler->EndCapture();
+    profiler->WriteChromeTrace(Environment::GetInstance()->GetParsedArgument("profileTrace"));
+  }
+
   ShutdownContentSystem();
 
   ObjectStore::Destroy();
@@ -546,6 +560,9 @@ void EngineLibrary::Shutdown()
 
   Profile::ProfileSystem::Shutdown();
   GetLibrary()->ClearComponents();
+
+  // All threads that used frame memory have been shut down
+  FrameAllocator::Shutdown();
 }
 
 }//namespace Zero
@@ -82,6 +82,7 @@ private:
 #include "CogMetaComposition.hpp"
 //#include "Cog.hpp"
 #include "CogMeta.hpp"
+#include "ComponentStore.hpp"
 #include "Space.hpp"
 #include "DocumentResource.hpp"
 #include "ZilchResource.hpp"
@@ -102,6 +103,7 @@ private:
 #include "Hierarchy.hpp"
 #include "TransformSupport.hpp"
 #include "Transform.hpp"
+#include "TransformHierarchy.hpp"
 #include "Action/Action.hpp"
 #include "Action/ActionSystem.hpp"
 #include "Action/ActionEase.hpp"
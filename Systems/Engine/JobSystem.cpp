@@ -12,6 +12,17 @@
 namespace Zero
 {
 
+// The worker that owns the calling thread (null on non-worker threads)
+ZeroThreadLocal JobWorker* gCurrentJobWorker = nullptr;
+
+// The last job of a group releases it under this lock, so a waiting thread
+// that saw the group complete can't destroy it while it's still being signaled
+SpinLock gJobGroupLock;
+
+// Not part of the profile graph (jobs run under any scope on any thread),
+// it's only there to show jobs on the worker timelines of captured traces
+Profile::Record gJobProfileRecord;
+
 ZilchDefineType(Job, builder, type)
 {
 }
@@ -20,6 +31,9 @@ Job::Job()
 {
   mDeletedOnCompletion = true;
   mOsEvent = nullptr;
+  mPendingDependencies = 1;
+  mFinished = false;
+  mGroup = nullptr;
 }
 
 Job::~Job()
@@ -35,6 +49,150 @@ OsEvent* Job::InitializeOsEvent()
   return mOsEvent;
 }
 
+void Job::DependsOn(Job* prerequisite)
+{
+  ++mPendingDependencies;
+
+  prerequisite->mContinuationLock.Lock();
+  bool finished = prerequisite->mFinished;
+  if(!finished)
+    prerequisite->mContinuations.PushBack(this);
+  prerequisite->mContinuationLock.Unlock();
+
+  // The prerequisite already ran so there is nothing to wait on
+  if(finished)
+    --mPendingDependencies;
+}
+
+//-------------------------------------------------------------------- Job Group
+JobGroup::JobGroup()
+{
+  mPendingJobs = 0;
+  mCompletedEvent.Initialize();
+}
+
+JobGroup::~JobGroup()
+{
+  // Wait for the last job to finish signaling
+  gJobGroupLock.Lock();
+  gJobGroupLock.Unlock();
+}
+
+bool JobGroup::IsCompleted()
+{
+  return mPendingJobs.Load() == 0;
+}
+
+//-------------------------------------------------------------------- Job Deque
+JobDeque::JobDeque()
+{
+  mTop = 0;
+  mBottom = 0;
+  memset((void*)mJobs, 0, sizeof(mJobs));
+}
+
+bool JobDeque::Push(Job* job)
+{
+  s64 bottom = mBottom.Load();
+  s64 top = mTop.Load();
+  if(bottom - top >= cCapacity)
+    return false;
+
+  AtomicStore((void* volatile*)&mJobs[bottom & (cCapacity - 1)], job);
+  mBottom = bottom + 1;
+  return true;
+}
+
+Job* JobDeque::Pop()
+{
+  // Reserve the bottom slot before looking at the top so a thief
+  // racing for the same (last) job will see the reservation
+  s64 bottom = mBottom.Load() - 1;
+  mBottom = bottom;
+  s64 top = mTop.Load();
+
+  if(top > bottom)
+  {
+    // Empty
+    mBottom = top;
+    return nullptr;
+  }
+
+  Job* job = (Job*)AtomicLoad((void* volatile*)&mJobs[bottom & (cCapacity - 1)]);
+  if(top == bottom)
+  {
+    // Last job, race any thieves for it
+    if(!mTop.CompareExchangeBool(top + 1, top))
+      job = nullptr;
+    mBottom = top + 1;
+  }
+  return job;
+}
+
+Job* JobDeque::Steal()
+{
+  s64 top = mTop.Load();
+  s64 bottom = mBottom.Load();
+  if(top >= bottom)
+    return nullptr;
+
+  Job* job = (Job*)AtomicLoad((void* volatile*)&mJobs[top & (cCapacity - 1)]);
+
+  // Another thief or the owner got it first
+  if(!mTop.CompareExchangeBool(top + 1, top))
+    return nullptr;
+  return job;
+}
+
+bool JobDeque::Empty()
+{
+  return mTop.Load() >= mBottom.Load();
+}
+
+//------------------------------------------------------------------- Job Worker
+JobWorker::JobWorker(JobSystem* system, uint index, bool background)
+{
+  mSystem = system;
+  mIndex = index;
+  mBackground = background;
+  mActiveJob = nullptr;
+}
+
+OsInt JobWorker::WorkerThreadEntry()
+{
+  // Background workers don't own a deque, tasks they add go to the shared queue
+  if(mBackground)
+  {
+    Profile::ProfileSystem::SetThreadName(String::Format("Background Worker %u", mIndex));
+  }
+  else
+  {
+    gCurrentJobWorker = this;
+    Profile::ProfileSystem::SetThreadName(String::Format("Job Worker %u", mIndex));
+  }
+
+  Semaphore& jobCounter = mBackground ? mSystem->mBackgroundJobCounter : mSystem->mJobCounter;
+  for(;;)
+  {
+    jobCounter.WaitAndDecrement();
+
+    //Semaphore released with the workers inactive
+    //means that we are shutting down.
+    if(!mSystem->mWorkerThreadsActive)
+      return 0;
+
+    // Keep running jobs while there are any to find. The counter may
+    // still be signaled for jobs that another thread already ran.
+    while(Job* job = mBackground ? mSystem->FindBackgroundJob() : mSystem->FindJob(this))
+    {
+      mSystem->RunJob(job, this);
+
+      if(!mSystem->mWorkerThreadsActive)
+        return 0;
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 namespace Z
 {
@@ -44,13 +202,30 @@ namespace Z
 JobSystem::JobSystem()
 {
   mWorkerThreadsActive = true;
-  Workers.Resize(10);
+  mStealIndex = 0;
+  gJobProfileRecord.SetName("Job");
+
+  // The main thread helps while waiting, so leave a processor for it
+  uint processorCount = Os::GetProcessorCount();
+  uint workerCount = processorCount > 3 ? processorCount - 1 : 2;
+  Workers.Resize(workerCount);
 
   for(uint i=0;i<Workers.Size();++i)
   {
-    Workers[i] = new Thread();
-    Thread& thread = *Workers[i];
-    thread.Initialize(&Thread::ObjectEntryCreator<JobSystem,&JobSystem::WorkerThreadEntry>, this, "Background");
+    Workers[i] = new JobWorker(this, i, false);
+    Thread& thread = Workers[i]->mThread;
+    thread.Initialize(&Thread::ObjectEntryCreator<JobWorker,&JobWorker::WorkerThreadEntry>, Workers[i], "Job");
+    thread.Resume();
+  }
+
+  // Background jobs may block for a long time (waiting on the network or
+  // another process) so they get their own threads
+  BackgroundWorkers.Resize(cBackgroundWorkerCount);
+  for(uint i=0;i<BackgroundWorkers.Size();++i)
+  {
+    BackgroundWorkers[i] = new JobWorker(this, i, true);
+    Thread& thread = BackgroundWorkers[i]->mThread;
+    thread.Initialize(&Thread::ObjectEntryCreator<JobWorker,&JobWorker::WorkerThreadEntry>, BackgroundWorkers[i], "Background");
     thread.Resume();
   }
 }
@@ -59,114 +234,303 @@ JobSystem::~JobSystem()
 {
   mWorkerThreadsActive = false;
 
-  mLock.Lock();
+  Array<JobWorker*> allWorkers(Workers);
+  allWorkers.Append(BackgroundWorkers.All());
 
   //Cancel all active Jobs
+  for(uint i=0;i<allWorkers.Size();++i)
+  {
+    JobWorker* worker = allWorkers[i];
+    worker->mActiveLock.Lock();
+    if(worker->mActiveJob)
+      worker->mActiveJob->Cancel();
+    worker->mActiveLock.Unlock();
+  }
+
+  //increment the counters but push no jobs
+  //allowing each worker thread to unblock
+  mJobCounter.Increment((uint)Workers.Size());
+  mBackgroundJobCounter.Increment((uint)BackgroundWorkers.Size());
 
-  //Active job range is safe because of the lock.
-  forRange(Job& job, ActiveJobs.All())
-    job.Cancel();
+  //Wait for each thread to shutdown
+  for(uint i=0;i<allWorkers.Size();++i)
+  {
+    Thread& thread = allWorkers[i]->mThread;
+    thread.WaitForCompletion();
+  }
 
-  // Delete all pending jobs that we own. 
-  // if a job is marked to not be deleted on completion then it's likely a background task. 
+  // Delete all pending jobs that we own.
+  // if a job is marked to not be deleted on completion then it's likely a background task.
   // Leave this to the background task manager to delete otherwise a double deletion will happen.
   while(!PendingJobs.Empty())
   {
     Job* job = &PendingJobs.Front();
     PendingJobs.PopFront();
     if(job->mDeletedOnCompletion)
-    {
       SafeDelete(job);
-    }
   }
 
-  mLock.Unlock();
-
-  //increment the counter but push no jobs
-  //allowing each background thread to unblock
-  for(uint i=0;i<Workers.Size();++i)
+  while(!SharedTasks.Empty())
   {
-    mJobCounter.Increment();
+    Job* job = &SharedTasks.Front();
+    SharedTasks.PopFront();
+    if(job->mDeletedOnCompletion)
+      SafeDelete(job);
   }
 
-  //Wait for each thread to shutdown
   for(uint i=0;i<Workers.Size();++i)
   {
-    Thread& thread = *Workers[i];
-    thread.WaitForCompletion();
+    while(Job* job = Workers[i]->mDeque.Pop())
+    {
+      if(job->mDeletedOnCompletion)
+        SafeDelete(job);
+    }
   }
 
-  //delete all threads
+  //delete all workers
   DeleteObjectsInContainer(Workers);
+  DeleteObjectsInContainer(BackgroundWorkers);
 }
 
-Job* JobSystem::GetNextJob()
+void JobSystem::AddJob(Job* job)
 {
-  Job* job = nullptr;
+  AddJobs(&job, 1, nullptr);
+}
 
-  //Locked pop front
-  mLock.Lock();
-  if(!PendingJobs.Empty())
+void JobSystem::AddJob(Job* job, JobGroup* group)
+{
+  AddJobs(&job, 1, group);
+}
+
+void JobSystem::AddJobs(Job** jobs, uint count, JobGroup* group)
+{
+  // Count every job up front so the group can't complete part way through
+  if(group)
+    group->mPendingJobs += (s32)count;
+
+  uint queuedTasks = 0;
+  uint queuedBackgroundJobs = 0;
+  for(uint i = 0; i < count; ++i)
   {
-    job = &PendingJobs.Front();
-    PendingJobs.Erase(PendingJobs.Begin());
-    ActiveJobs.PushBack(job);
+    Job* job = jobs[i];
+    job->mGroup = group;
+
+    if(!ThreadingEnabled)
+    {
+      if(--job->mPendingDependencies == 0)
+        RunJob(job, nullptr);
+      continue;
+    }
+
+    // Release the reference held until the job was added
+    ReleaseDependency(job, queuedTasks, queuedBackgroundJobs);
   }
-  mLock.Unlock();
 
-  return job;
+  WakeWorkers(queuedTasks, queuedBackgroundJobs);
 }
 
-void JobSystem::JobFinished(Job* job)
+void JobSystem::WaitAndHelp(JobGroup& group)
+{
+  JobWorker* worker = GetCurrentWorker();
+  while(!group.IsCompleted())
+  {
+    Job* job = FindJob(worker);
+    if(job)
+    {
+      RunJob(job, worker);
+      continue;
+    }
+
+    // Nothing left to help with, the group's remaining jobs are running on
+    // other threads so sleep until the last one finishes (a signal left over
+    // from an earlier completion only costs another pass)
+    group.mCompletedEvent.Wait();
+  }
+}
+
+bool JobSystem::RunPendingJob()
+{
+  JobWorker* worker = GetCurrentWorker();
+  Job* job = FindJob(worker);
+  if(job == nullptr)
+    return false;
+
+  RunJob(job, worker);
+  return true;
+}
+
+uint JobSystem::GetWorkerCount()
 {
+  return Workers.Size();
+}
+
+JobWorker* JobSystem::GetCurrentWorker()
+{
+  JobWorker* worker = gCurrentJobWorker;
+  if(worker && worker->mSystem == this)
+    return worker;
+  return nullptr;
+}
+
+void JobSystem::Enqueue(Job* job, uint& queuedTasks, uint& queuedBackgroundJobs)
+{
+  // Tasks spawned from a worker stay on that worker (they're likely to
+  // share data with the spawning job), everything else goes to a shared queue
+  JobWorker* worker = GetCurrentWorker();
+  if(job->mGroup == nullptr)
+  {
+    mLock.Lock();
+    PendingJobs.PushBack(job);
+    mLock.Unlock();
+    ++queuedBackgroundJobs;
+    return;
+  }
+
+  if(worker == nullptr || !worker->mDeque.Push(job))
+  {
+    mLock.Lock();
+    SharedTasks.PushBack(job);
+    mLock.Unlock();
+  }
+  ++queuedTasks;
+}
+
+void JobSystem::ReleaseDependency(Job* job, uint& queuedTasks, uint& queuedBackgroundJobs)
+{
+  if(--job->mPendingDependencies == 0)
+    Enqueue(job, queuedTasks, queuedBackgroundJobs);
+}
+
+void JobSystem::WakeWorkers(uint queuedTasks, uint queuedBackgroundJobs)
+{
+  // A woken worker keeps running jobs until it can't find any, so
+  // there's no point waking more workers than there are
+  if(queuedTasks)
+    mJobCounter.Increment(Math::Min(queuedTasks, (uint)Workers.Size()));
+  if(queuedBackgroundJobs)
+    mBackgroundJobCounter.Increment(Math::Min(queuedBackgroundJobs, (uint)BackgroundWorkers.Size()));
+}
+
+Job* JobSystem::FindJob(JobWorker* worker)
+{
+  // Our own most recent task first (best for the cache)
+  if(worker)
+  {
+    if(Job* job = worker->mDeque.Pop())
+      return job;
+  }
+
+  // Then the shared queues
+  Job* job = nullptr;
   mLock.Lock();
-  ActiveJobs.Erase(job);
+  if(!SharedTasks.Empty())
+  {
+    job = &SharedTasks.Front();
+    SharedTasks.PopFront();
+  }
   mLock.Unlock();
 
-  if(job->mOsEvent)
-    job->mOsEvent->Signal();
+  if(job)
+    return job;
 
-  // Only delete the job if specified
-  if(job->mDeletedOnCompletion)
-    delete job;
+  // Finally steal the oldest job from another worker
+  uint workerCount = Workers.Size();
+  uint startIndex = (uint)(mStealIndex++) % workerCount;
+  for(uint i = 0; i < workerCount; ++i)
+  {
+    JobWorker* victim = Workers[(startIndex + i) % workerCount];
+    if(victim == worker)
+      continue;
+
+    if(Job* stolen = victim->mDeque.Steal())
+      return stolen;
+  }
+
+  return nullptr;
 }
 
-OsInt JobSystem::WorkerThreadEntry()
+Job* JobSystem::FindBackgroundJob()
 {
-  for(;;)
+  Job* job = nullptr;
+  mLock.Lock();
+  if(!PendingJobs.Empty())
   {
-    mJobCounter.WaitAndDecrement();
-    Job* job = GetNextJob();
+    job = &PendingJobs.Front();
+    PendingJobs.PopFront();
+  }
+  mLock.Unlock();
+  return job;
+}
 
-    //No jobs and Semaphore release
-    //that means we are shutting down.
-    if(job == nullptr)
-      return 0;
+void JobSystem::RunJob(Job* job, JobWorker* worker)
+{
+  // A worker helping inside of WaitAndHelp is still running the outer job
+  Job* outerJob = nullptr;
+  if(worker)
+  {
+    worker->mActiveLock.Lock();
+    outerJob = worker->mActiveJob;
+    worker->mActiveJob = job;
+    worker->mActiveLock.Unlock();
+  }
 
-    //Run the job
+  //Run the job
+  {
+    ProfileScopeRecord(gJobProfileRecord);
     job->Execute();
+  }
 
-    //Finish the job
-    JobFinished(job);
+  if(worker)
+  {
+    worker->mActiveLock.Lock();
+    worker->mActiveJob = outerJob;
+    worker->mActiveLock.Unlock();
   }
+
+  //Finish the job
+  JobFinished(job);
 }
 
-void JobSystem::AddJob(Job* job)
+void JobSystem::JobFinished(Job* job)
 {
-  if(!ThreadingEnabled)
+  // Nothing may touch the job after its group is notified or its
+  // OsEvent is signaled as the owner is then free to delete it
+  JobGroup* group = job->mGroup;
+  bool deleteJob = job->mDeletedOnCompletion;
+
+  Array<Job*> continuations;
+  job->mContinuationLock.Lock();
+  job->mFinished = true;
+  continuations.Swap(job->mContinuations);
+  job->mContinuationLock.Unlock();
+
+  if(job->mOsEvent)
+    job->mOsEvent->Signal();
+
+  // Only delete the job if specified
+  if(deleteJob)
+    delete job;
+
+  uint queuedTasks = 0;
+  uint queuedBackgroundJobs = 0;
+  forRange(Job* continuation, continuations.All())
   {
-    job->Execute();
-    return;
+    if(ThreadingEnabled)
+      ReleaseDependency(continuation, queuedTasks, queuedBackgroundJobs);
+    else if(--continuation->mPendingDependencies == 0)
+      RunJob(continuation, nullptr);
   }
-  
-  //lock push a job
-  mLock.Lock();
-  PendingJobs.PushBack(job);
-  mLock.Unlock();
+  WakeWorkers(queuedTasks, queuedBackgroundJobs);
 
-  //Signal that a job has been added 
-  //unblocking workers
-  mJobCounter.Increment();
+  if(group)
+  {
+    // The waiting thread may destroy the group as soon as it sees the
+    // count reach zero, the group's destructor waits on this lock
+    gJobGroupLock.Lock();
+    if(--group->mPendingJobs == 0)
+      group->mCompletedEvent.Signal();
+    gJobGroupLock.Unlock();
+  }
 }
 
 }//zero
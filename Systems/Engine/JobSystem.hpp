@@ -15,6 +15,10 @@
 namespace Zero
 {
 
+class JobGroup;
+class JobSystem;
+class JobWorker;
+
 //-------------------------------------------------------------------------- Job
 class Job : public EventObject
 {
@@ -28,39 +32,246 @@ public:
 
   // Called from a different thread, typically setting a bool to stop
   virtual int Cancel(){return 0;};
-  
+
   /// We don't want to create an OsEvent for every job, so only call this if you
-  /// need it. Creating an OsEvent on this job will also set 
+  /// need it. Creating an OsEvent on this job will also set
   /// mDeletedOnCompletion to false, as the job must be alive to wait on the OsEvent.
   OsEvent* InitializeOsEvent();
 
+  /// This job will not be run until the prerequisite job has finished executing.
+  /// Must be called before this job is added to the job system. The prerequisite
+  /// must either not have been added yet or must not be deleted on completion.
+  void DependsOn(Job* prerequisite);
+
   bool mDeletedOnCompletion;
   OsEvent* mOsEvent;
   Link<Job> link;
+
+private:
+  friend class JobSystem;
+
+  // Starts at one for the reference released by AddJob. The job is
+  // scheduled when every prerequisite and the AddJob call have released it.
+  Atomic<s32> mPendingDependencies;
+
+  // Jobs waiting on this one to finish, guarded by the continuation lock.
+  SpinLock mContinuationLock;
+  Array<Job*> mContinuations;
+  bool mFinished;
+
+  JobGroup* mGroup;
+};
+
+//-------------------------------------------------------------------- Job Group
+/// Counts outstanding jobs so that a thread can wait on them with
+/// JobSystem::WaitAndHelp (running queued jobs until there are none left,
+/// then sleeping until the last job of the group finishes).
+class JobGroup
+{
+public:
+  JobGroup();
+  ~JobGroup();
+
+  /// Whether every job added with this group has finished executing.
+  bool IsCompleted();
+
+private:
+  friend class JobSystem;
+  Atomic<s32> mPendingJobs;
+  // Signaled when the pending count drops to zero
+  OsEvent mCompletedEvent;
+};
+
+//-------------------------------------------------------------------- Job Deque
+/// Fixed size work stealing deque (Chase-Lev). The owning worker pushes and
+/// pops from the bottom while any other thread may steal from the top.
+class JobDeque
+{
+public:
+  static const s64 cCapacity = 1024;
+
+  JobDeque();
+
+  /// Owner only. Returns false if the deque is full.
+  bool Push(Job* job);
+  /// Owner only. Takes the most recently pushed job.
+  Job* Pop();
+  /// Any thread. Takes the oldest job.
+  Job* Steal();
+
+  bool Empty();
+
+private:
+  Atomic<s64> mTop;
+  Atomic<s64> mBottom;
+  Job* volatile mJobs[cCapacity];
+};
+
+//------------------------------------------------------------------- Job Worker
+class JobWorker
+{
+public:
+  JobWorker(JobSystem* system, uint index, bool background);
+
+  OsInt WorkerThreadEntry();
+
+  JobSystem* mSystem;
+  uint mIndex;
+  // Background workers only run jobs added without a group
+  bool mBackground;
+  JobDeque mDeque;
+  Thread mThread;
+
+  // The job currently executing, so it can be canceled on shutdown
+  SpinLock mActiveLock;
+  Job* mActiveJob;
 };
 
 //------------------------------------------------------------------- Job System
+/// Work stealing job scheduler. One task worker is created per logical
+/// processor (less the main thread). Jobs added with a group are short tasks:
+/// when added from a worker they go onto that worker's own deque, otherwise onto
+/// a shared queue, and idle workers steal them from each other. Jobs added
+/// without a group are treated as long running background jobs (web requests,
+/// content builds) that may block, so they run on a separate fixed size pool of
+/// background workers and never hold up the task workers.
 class JobSystem
 {
 public:
+  /// Size of the background worker pool (the size of the old single pool).
+  static const uint cBackgroundWorkerCount = 10;
+  /// Upper bound on the chunks ParallelFor splits a range into.
+  static const uint cMaxParallelForChunks = 64;
+
   JobSystem();
   ~JobSystem();
-  
+
+  /// Queue a background job to run on a background worker (once its dependencies have finished).
   void AddJob(Job* job);
-  OsInt WorkerThreadEntry();
+  /// Queue a task that the group tracks until it has finished.
+  void AddJob(Job* job, JobGroup* group);
+  /// Queue several jobs at once, waking the workers once for the whole batch.
+  void AddJobs(Job** jobs, uint count, JobGroup* group);
+
+  /// Runs queued tasks on the calling thread until every job in the group has
+  /// finished. Used so the main thread helps rather than blocking.
+  void WaitAndHelp(JobGroup& group);
+
+  /// Runs a single queued task on the calling thread.
+  /// Returns false if there was no task to run.
+  bool RunPendingJob();
+
+  /// Splits [start, end) into chunks of at least grainSize and calls
+  /// functor(chunkStart, chunkEnd) for each chunk across the workers. The
+  /// calling thread helps and this does not return until every chunk is done.
+  template <typename FunctorType>
+  void ParallelFor(uint start, uint end, uint grainSize, FunctorType functor);
+
+  /// Number of task worker threads (not counting the background workers).
+  uint GetWorkerCount();
+
+  /// The worker running on the calling thread (null if not a worker thread).
+  JobWorker* GetCurrentWorker();
 
 private:
+  friend class JobWorker;
+
+  // Queues a job whose dependencies have all been released and counts it
+  // so the caller can wake the workers once with WakeWorkers.
+  void Enqueue(Job* job, uint& queuedTasks, uint& queuedBackgroundJobs);
+  void ReleaseDependency(Job* job, uint& queuedTasks, uint& queuedBackgroundJobs);
+  void WakeWorkers(uint queuedTasks, uint queuedBackgroundJobs);
+  Job* FindJob(JobWorker* worker);
+  Job* FindBackgroundJob();
+  void RunJob(Job* job, JobWorker* worker);
+  void JobFinished(Job* job);
+
+  // Background jobs and tasks added from outside of the workers
   ThreadLock mLock;
   InList<Job> PendingJobs;
-  InList<Job> ActiveJobs;
-  Array<Thread*> Workers;
+  InList<Job> SharedTasks;
+
+  Array<JobWorker*> Workers;
+  Array<JobWorker*> BackgroundWorkers;
   Semaphore mJobCounter;
-  Job* GetNextJob();
-  void JobFinished(Job* job);
-  bool mWorkerThreadsActive;
-  friend class Job;
+  Semaphore mBackgroundJobCounter;
+  Atomic<bool> mWorkerThreadsActive;
+  // Rotates where thieves start looking so they don't all hit the same worker
+  Atomic<s32> mStealIndex;
 };
 
+//-------------------------------------------------------------- ParallelFor Job
+template <typename FunctorType>
+class ParallelForJob : public Job
+{
+public:
+  int Execute() override
+  {
+    (*mFunctor)(mStart, mEnd);
+    return 0;
+  }
+
+  FunctorType* mFunctor;
+  uint mStart;
+  uint mEnd;
+};
+
+template <typename FunctorType>
+void JobSystem::ParallelFor(uint start, uint end, uint grainSize, FunctorType functor)
+{
+  if(start >= end)
+    return;
+
+  if(grainSize == 0)
+    grainSize = 1;
+
+  // Give each thread a few chunks to steal so uneven chunks still balance,
+  // but never make a chunk smaller than the grain size
+  uint count = end - start;
+  uint maxChunks = (GetWorkerCount() + 1) * 4;
+  if(maxChunks > cMaxParallelForChunks)
+    maxChunks = cMaxParallelForChunks;
+  uint chunkCount = (count + grainSize - 1) / grainSize;
+  if(chunkCount > maxChunks)
+    chunkCount = maxChunks;
+
+  if(chunkCount <= 1 || !ThreadingEnabled)
+  {
+    functor(start, end);
+    return;
+  }
+
+  uint chunkSize = (count + chunkCount - 1) / chunkCount;
+  chunkCount = (count + chunkSize - 1) / chunkSize;
+
+  // The calling thread takes the first chunk itself, the rest are queued
+  // together as one batch
+  typedef ParallelForJob<FunctorType> ChunkJob;
+  uint jobCount = chunkCount - 1;
+  ChunkJob* jobs = (ChunkJob*)zAllocate(sizeof(ChunkJob) * jobCount);
+  Job* queuedJobs[cMaxParallelForChunks];
+
+  for(uint i = 0; i < jobCount; ++i)
+  {
+    ChunkJob* job = new(&jobs[i]) ChunkJob();
+    job->mDeletedOnCompletion = false;
+    job->mFunctor = &functor;
+    job->mStart = start + (i + 1) * chunkSize;
+    job->mEnd = Math::Min(job->mStart + chunkSize, end);
+    queuedJobs[i] = job;
+  }
+
+  JobGroup group;
+  AddJobs(queuedJobs, jobCount, &group);
+
+  functor(start, start + chunkSize);
+  WaitAndHelp(group);
+
+  for(uint i = 0; i < jobCount; ++i)
+    jobs[i].~ChunkJob();
+  zDeallocate(jobs);
+}
+
 namespace Z
 {
   extern JobSystem* gJobs;
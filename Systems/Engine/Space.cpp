@@ -46,6 +46,9 @@ ZilchDefineType(Space, builder, type)
   ZilchBindMethod(FindAllObjectsByName);
   ZilchBindMethod(FindAllRootObjectsByName);
 
+  ZilchBindMethod(QueryComponents);
+  ZilchBindMethod(QueryComponentsWith);
+
   ZilchBindMethod(DestroyAll);
   ZilchBindMethod(DestroyAllFromLevel);
 
@@ -70,6 +73,7 @@ Space::Space()
   mIsLoadingLevel = false;
   mInvalidObjectPositionOccurred = false;
   mMaxObjectPosition = real(1e+10);
+  mTransformHierarchy = nullptr;
 }
 
 Space::~Space()
@@ -77,6 +81,8 @@ Space::~Space()
   ErrorIf(!mCogList.Empty(), "Not all objects in space destroyed.");
   Z::gEngine->mSpaceList.Erase(this);
 
+  SafeDelete(mTransformHierarchy);
+
   // Remove ourself from the game session list
   if (GameSession* gameSession = GetGameSession())
     gameSession->InternalRemove(this);
@@ -114,6 +120,52 @@ GameSession* Space::GetGameSession()
   return mGameSession;
 }
 
+ComponentQueryRange Space::QueryComponents(BoundType* componentType)
+{
+  return QueryComponentsWith(componentType, nullptr);
+}
+
+// The store only has native components
+bool ValidateQueryType(BoundType* componentType)
+{
+  if(componentType == nullptr)
+  {
+    DoNotifyException("Invalid query", "Null component type given");
+    return false;
+  }
+
+  if(!componentType->Native)
+  {
+    String message = String::Format("Only native component types can be queried, '%s' is a script type",
+                                    componentType->Name.c_str());
+    DoNotifyException("Invalid query", message);
+    return false;
+  }
+  return true;
+}
+
+ComponentQueryRange Space::QueryComponentsWith(BoundType* componentType, BoundType* requiredType)
+{
+  if(!ValidateQueryType(componentType))
+    return ComponentQueryRange();
+
+  if(requiredType == nullptr)
+    return ComponentQueryRange(mComponentStore.GetMatching(componentType));
+
+  if(!ValidateQueryType(requiredType))
+    return ComponentQueryRange();
+
+  return ComponentQueryRange(mComponentStore.GetMatching(componentType),
+                             mComponentStore.GetMatching(requiredType));
+}
+
+TransformHierarchy* Space::GetTransformHierarchy()
+{
+  if(mTransformHierarchy == nullptr)
+    mTransformHierarchy = new TransformHierarchy();
+  return mTransformHierarchy;
+}
+
 void Space::Initialize(CogInitializer& initializer)
 {
   mGameSession = initializer.mGameSession;
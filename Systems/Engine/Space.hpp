@@ -11,6 +11,8 @@
 
 namespace Zero
 {
+class TransformHierarchy;
+
 typedef InList<Cog, &Cog::SpaceLink> SpaceCogList;
 typedef InList<Cog, &Cog::NameLink> NameCogList;
 
@@ -156,6 +158,22 @@ public:
   /// Number of objects in the space.
   uint GetObjectCount() { return mCogsInSpace; }
 
+  //---------------------------------------------------------------- Queries
+
+  /// All components in the space of the given type (or of types deriving
+  /// from or implementing it). Only native component types can be queried.
+  ComponentQueryRange QueryComponents(BoundType* componentType);
+  /// Same as QueryComponents, but skips components whose owner doesn't
+  /// also have a component of the required type (also native only).
+  ComponentQueryRange QueryComponentsWith(BoundType* componentType, BoundType* requiredType);
+
+  /// Typed versions of the above, e.g. space->Query<Transform, Model>()
+  /// returns every Transform whose owner has a Model.
+  template <typename type>
+  TypedComponentQueryRange<type> Query();
+  template <typename type, typename requiredType>
+  TypedComponentQueryRange<type> Query();
+
   //------------------------------------------------------------ Modification
 
   //Any change that needs to be saved marks the space as modified.
@@ -175,6 +193,9 @@ public:
 
   HierarchyList::range AllRootObjects(){return mRoots.All();}
 
+  /// World matrix store for Transform::sUseTransformHierarchy (created on first use).
+  TransformHierarchy* GetTransformHierarchy();
+
 //Internals
   void AddObject(Cog* cog);
   void RemoveObject(Cog* cog);
@@ -207,6 +228,12 @@ public:
   // Hierarchy
   HierarchyList mRoots;
   uint mRootCount;
+
+  // Dense per type component arrays for queries
+  ComponentStore mComponentStore;
+
+  // Null unless a transform has been added to it
+  TransformHierarchy* mTransformHierarchy;
   
   // If valid a load is pending for next update
   HandleOf<Level> mPendingLevel;
@@ -234,4 +261,16 @@ public:
   friend class ArchetypeRebuilder;
 };
 
+template <typename type>
+TypedComponentQueryRange<type> Space::Query()
+{
+  return QueryComponents(ZilchTypeId(type));
+}
+
+template <typename type, typename requiredType>
+TypedComponentQueryRange<type> Space::Query()
+{
+  return QueryComponentsWith(ZilchTypeId(type), ZilchTypeId(requiredType));
+}
+
 }//namespace Zero
@@ -15,8 +15,12 @@ ThreadDispatch* gDispatch = nullptr;
 }
 
 //-------------------------------------------------------------------ThreadDispatch
+const size_t cThreadDispatchRingSize = 4096;
+
 ThreadDispatch::ThreadDispatch()
+  : mRing(cThreadDispatchRingSize)
 {
+  mOverflowed.Store(false);
   Z::gDispatch = this;
 }
 
@@ -38,8 +42,32 @@ void ThreadDispatch::DispatchOn(HandleParam object, EventDispatcher* eventDispat
   queuedEvent.EventDispatcherOn = eventDispatcher;
   queuedEvent.EventId  = eventId;
 
+  if(!mOverflowed.Load() && mRing.TryPush(queuedEvent))
+    return;
+
+  //The ring is full (or was recently), fall back to the locked list
   mLock.Lock();
-  mEvents.PushBack(queuedEvent);
+  mOverflowed.Store(true);
+  mOverflow.PushBack(queuedEvent);
+  mLock.Unlock();
+}
+
+void ThreadDispatch::TakeEvents(Array<QueuedEvent>& events)
+{
+  //Fast path, nothing has overflowed so the ring can be drained without locking
+  if(!mOverflowed.Load())
+  {
+    mRing.PopBatch(events);
+    return;
+  }
+
+  //Overflowed events were pushed after everything their thread put in the
+  //ring, so wait on any partially pushed ring events before taking them
+  mLock.Lock();
+  mRing.PopClaimed(events);
+  events.Append(mOverflow.All());
+  mOverflow.Clear();
+  mOverflowed.Store(false);
   mLock.Unlock();
 }
 
@@ -49,9 +77,7 @@ void ThreadDispatch::DispatchEvents()
 
   //To avoid dead lock pull out all message before dispatching
   //(dispatching may add more events)
-  mLock.Lock();
-  eventsToDispatch.Swap(mEvents);
-  mLock.Unlock();
+  TakeEvents(eventsToDispatch);
 
   forRange(QueuedEvent& queuedEvent, eventsToDispatch.All())
   {
@@ -68,10 +94,7 @@ void ThreadDispatch::DispatchEvents()
 void ThreadDispatch::ClearEvents()
 {
   Array<QueuedEvent> eventsToDispatch;
-
-  mLock.Lock();
-  eventsToDispatch.Swap(mEvents);
-  mLock.Unlock();
+  TakeEvents(eventsToDispatch);
 
   forRange(QueuedEvent& queuedEvent, eventsToDispatch.All())
   {
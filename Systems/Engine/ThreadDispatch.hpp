@@ -20,6 +20,10 @@ struct QueuedEvent
 };
 
 //-------------------------------------------------------------------ThreadDispatch
+/// Queues events from any thread to be dispatched on the main thread. Events
+/// are pushed into a lock-free ring, only when the ring is full do producers
+/// take the lock and append to the overflow list (and keep doing so until the
+/// main thread drains it, so events from one thread stay in order).
 class ThreadDispatch
 {
 public:
@@ -37,8 +41,14 @@ public:
   void ClearEvents();
 
 private:
+  /// Pulls every queued event out (ring first, then the overflow)
+  void TakeEvents(Array<QueuedEvent>& events);
+
+  MpscRing<QueuedEvent> mRing;
+  /// Set while mOverflow has events, producers skip the ring until it's cleared
+  Atomic<bool> mOverflowed;
   ThreadLock mLock;
-  Array<QueuedEvent> mEvents;
+  Array<QueuedEvent> mOverflow;
 };
 
 //-------------------------------------------------------------------ObjectThreadDispatch
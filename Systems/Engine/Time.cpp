@@ -15,9 +15,9 @@ namespace Zero
 namespace Events
 {
   DefineEvent(SystemLogicUpdate);
-  DefineEvent(FrameUpdate);
+  DefineBatchedEvent(FrameUpdate);
   DefineEvent(GraphicsFrameUpdate);
-  DefineEvent(LogicUpdate);
+  DefineBatchedEvent(LogicUpdate);
   DefineEvent(PreviewUpdate);
   DefineEvent(EngineUpdate);
   DefineEvent(EngineShutdown);
@@ -208,6 +208,13 @@ void TimeSpace::Update(float dt)
       //dispatcher->Dispatch(Events::GraphicsFrameUpdate, &updateEvent);
     }
   }
+
+  // Bring every world matrix up to date before the space is rendered
+  if(TransformHierarchy* hierarchy = space->mTransformHierarchy)
+  {
+    ProfileScopeTree("TransformHierarchy", "TimeSystem", Color::SkyBlue);
+    hierarchy->Update();
+  }
 }
 
 void TimeSpace::TogglePause()
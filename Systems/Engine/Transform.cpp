@@ -115,6 +115,7 @@ Memory::Pool* Transform::sCachedWorldMatrixPool = new Memory::Pool("TransformWor
   Memory::GetRoot( ), sizeof(Mat4), 100);
 
 bool Transform::sCacheWorldMatrices = true;
+bool Transform::sUseTransformHierarchy = false;
 
 ZilchDefineType(Transform, builder, type)
 {
@@ -165,6 +166,8 @@ Transform::Transform( )
   TransformParent = NULL;
   InWorld = false;
   mCachedWorldMatrix = nullptr;
+  mHierarchy = nullptr;
+  mHierarchyIndex = 0;
 }
 
 Transform::~Transform( )
@@ -173,6 +176,9 @@ Transform::~Transform( )
   // world matrix after OnDestroy which would cause us to leak memory. Cleanup the
   // cached matrix if we have one here no matter what.
   FreeCachedMatrix();
+
+  if(mHierarchy)
+    mHierarchy->Remove(this);
 }
 
 void Transform::Serialize(Serializer& stream)
@@ -199,6 +205,12 @@ void Transform::Initialize(CogInitializer& initializer)
 {
   if(initializer.mParent)
     TransformParent = initializer.mParent->has(Transform);
+
+  if(sUseTransformHierarchy)
+  {
+    if(Space* space = GetSpace())
+      space->GetTransformHierarchy()->Add(this);
+  }
 }
 
 void Transform::AttachTo(AttachmentInfo& info)
@@ -214,6 +226,8 @@ void Transform::AttachTo(AttachmentInfo& info)
     TransformParent = parent->has(Transform);
   }
 
+  if(mHierarchy)
+    mHierarchy->ParentsChanged(this);
   SetDirty( );
 }
 
@@ -224,6 +238,8 @@ void Transform::Detached(AttachmentInfo& info)
 
   if(TransformParent!=NULL)
     TransformParent = NULL;
+  if(mHierarchy)
+    mHierarchy->ParentsChanged(this);
   SetDirty( );
 }
 
@@ -245,6 +261,10 @@ void Transform::TransformUpdate(TransformUpdateInfo& info)
     Mat3 rotation;
     newTransform.Decompose(&Scale, &rotation, &Translation);
     Rotation = Math::ToQuaternion(rotation).Normalized( );
+
+    // Already flagged by the parent, this stores the new local values
+    if(mHierarchy)
+      SetDirty( );
   }
 }
 
@@ -333,6 +353,10 @@ Mat4 Transform::GetParentRelativeMatrix()
 
 Mat4 Transform::GetWorldMatrix( )
 {
+  // The hierarchy caches every matrix (computing it now if it's dirty)
+  if(mHierarchy != nullptr)
+    return mHierarchy->GetWorldMatrix(mHierarchyIndex);
+
   // Return it if it's already cached
   if(mCachedWorldMatrix != nullptr)
     return *mCachedWorldMatrix;
@@ -738,6 +762,10 @@ void Transform::SetInWorld(bool state)
   Mat4 worldTransform = GetWorldMatrix();
   InWorld = state;
 
+  // In world transforms are roots of the hierarchy
+  if(mHierarchy)
+    mHierarchy->ParentsChanged(this);
+
   if(state)
   {
     Vec3 translation,scale;
@@ -777,17 +805,35 @@ bool Transform::GetInWorld()
 
 void Transform::SetDirty()
 {
-  // Don't need to do anything if we're already dirty
-  if(mCachedWorldMatrix == nullptr)
-    return;
+  // The hierarchy builds the world matrix from its own copy of the local values
+  if(mHierarchy != nullptr)
+    mHierarchy->SetLocalValues(mHierarchyIndex, Translation, Rotation, Scale);
 
-  // Free the memory
-  FreeCachedMatrix();
+  MarkWorldMatrixDirty();
+}
+
+void Transform::MarkWorldMatrixDirty()
+{
+  if(mHierarchy != nullptr)
+  {
+    // Only flagged, the hierarchy recomputes it on request or next update
+    if(!mHierarchy->MarkDirty(mHierarchyIndex))
+      return;
+  }
+  else
+  {
+    // Don't need to do anything if we're already dirty
+    if(mCachedWorldMatrix == nullptr)
+      return;
+
+    // Free the memory
+    FreeCachedMatrix();
+  }
 
   forRange(Cog& child, GetOwner()->GetChildren())
   {
     if(Transform* t = child.has(Transform))
-      t->SetDirty();
+      t->MarkWorldMatrixDirty();
   }
 }
 
@@ -828,10 +874,17 @@ void Transform::OnDestroy(uint flags /*= 0*/)
   {
     Transform* transform = cog.has(Transform);
     if (transform)
+    {
       transform->TransformParent = nullptr;
+      if(transform->mHierarchy)
+        transform->mHierarchy->ParentsChanged(transform);
+    }
   }
 
   FreeCachedMatrix();
+
+  if(mHierarchy)
+    mHierarchy->Remove(this);
 }
 
 void Transform::SetRotationBases(Vec3Param facing, Vec3Param up, Vec3Param right)
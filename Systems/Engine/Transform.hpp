@@ -12,6 +12,8 @@
 namespace Zero
 {
 
+class TransformHierarchy;
+
 namespace Tags
 {
 DeclareTag(Core);
@@ -43,6 +45,12 @@ public:
   static bool sCacheWorldMatrices;
   static Memory::Pool* sCachedWorldMatrixPool;
 
+  /// When set, transforms initialized afterwards keep their world matrices in
+  /// their space's TransformHierarchy instead of the pool. The hierarchy
+  /// updates every dirty matrix in one depth ordered pass per frame, splitting
+  /// large depth levels across the job system.
+  static bool sUseTransformHierarchy;
+
   /// Constructor / Destructor.
   Transform();
   ~Transform();
@@ -167,11 +175,18 @@ public:
   Transform* TransformParent;
 
 private:
+  friend class TransformHierarchy;
+
   void OnDestroy(uint flags = 0) override;
   void FreeCachedMatrix();
+  /// Flags the world matrix of this and all child objects to be recomputed.
+  void MarkWorldMatrixDirty();
 
   /// If null, the matrix is dirty.
   Mat4* mCachedWorldMatrix;
+  /// Set when the world matrix is stored in the space's hierarchy instead
+  TransformHierarchy* mHierarchy;
+  uint mHierarchyIndex;
   Vec3 Translation;
   Vec3 Scale;
   Quat Rotation;
@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file TransformHierarchy.cpp
+/// Implementation of the TransformHierarchy world matrix cache.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Levels smaller than this are cheaper to update on the calling thread
+const uint cParallelLevelSize = 1024;
+const uint cUpdateGrainSize = 256;
+
+// Updates a range of one depth level on a job worker
+struct TransformHierarchyUpdateRange
+{
+  TransformHierarchyUpdateRange(TransformHierarchy* hierarchy)
+    : mHierarchy(hierarchy)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    mHierarchy->UpdateRange(start, end);
+  }
+
+  TransformHierarchy* mHierarchy;
+};
+
+//----------------------------------------------------------- Transform Hierarchy
+TransformHierarchy::TransformHierarchy()
+{
+  mRemovedCount = 0;
+  mOrderDirty = false;
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+  forRange(Transform* transform, mTransforms.All())
+  {
+    if(transform)
+      transform->mHierarchy = nullptr;
+  }
+}
+
+void TransformHierarchy::Add(Transform* transform)
+{
+  ErrorIf(transform->mHierarchy != nullptr, "Transform is already in a hierarchy.");
+
+  transform->mHierarchy = this;
+  transform->mHierarchyIndex = mTransforms.Size();
+
+  mTransforms.PushBack(transform);
+  mParents.PushBack(GetParentIndex(transform));
+  mLocalTranslations.PushBack(transform->Translation);
+  mLocalRotations.PushBack(transform->Rotation);
+  mLocalScales.PushBack(transform->Scale);
+  mWorldMatrices.PushBack(Mat4::cIdentity);
+  mDirty.PushBack(1);
+
+  mOrderDirty = true;
+}
+
+void TransformHierarchy::Remove(Transform* transform)
+{
+  ErrorIf(transform->mHierarchy != this, "Transform is not in this hierarchy.");
+
+  // Leave a hole so the other parent indices stay valid, the next rebuild
+  // compacts it. The last world matrix is kept for any child read before then.
+  uint index = transform->mHierarchyIndex;
+  mTransforms[index] = nullptr;
+  mParents[index] = cNoParent;
+  mDirty[index] = 0;
+  ++mRemovedCount;
+
+  transform->mHierarchy = nullptr;
+  mOrderDirty = true;
+}
+
+void TransformHierarchy::ParentsChanged(Transform* transform)
+{
+  mParents[transform->mHierarchyIndex] = GetParentIndex(transform);
+  mOrderDirty = true;
+}
+
+void TransformHierarchy::SetLocalValues(uint index, Vec3Param translation, QuatParam rotation, Vec3Param scale)
+{
+  mLocalTranslations[index] = translation;
+  mLocalRotations[index] = rotation;
+  mLocalScales[index] = scale;
+}
+
+bool TransformHierarchy::MarkDirty(uint index)
+{
+  if(mDirty[index])
+    return false;
+  mDirty[index] = 1;
+  return true;
+}
+
+Mat4 TransformHierarchy::GetWorldMatrix(uint index)
+{
+  if(mDirty[index])
+  {
+    // The parent indices are kept current between rebuilds (only the depth
+    // order goes stale) so the parent chain is walked through the arrays
+    Mat4 local = BuildLocalMatrix(index);
+    uint parent = mParents[index];
+    if(parent == cNoParent)
+      mWorldMatrices[index] = local;
+    else if(parent == cExternalParent)
+      mWorldMatrices[index] = mTransforms[index]->TransformParent->GetWorldMatrix() * local;
+    else
+      mWorldMatrices[index] = GetWorldMatrix(parent) * local;
+    mDirty[index] = 0;
+  }
+
+  return mWorldMatrices[index];
+}
+
+void TransformHierarchy::Update()
+{
+  if(mOrderDirty)
+    Rebuild();
+
+  if(mTransforms.Empty())
+    return;
+
+  // Parents outside of the hierarchy can only be read on this thread, after
+  // this their children are clean and the levels below only read the arrays
+  forRange(uint index, mExternalChildren.All())
+    GetWorldMatrix(index);
+
+  // Each level only reads the level above it, so the transforms
+  // within a level can be updated in any order
+  bool parallel = Z::gJobs != nullptr;
+  for(uint level = 0; level + 1 < mLevelStarts.Size(); ++level)
+  {
+    uint start = mLevelStarts[level];
+    uint end = mLevelStarts[level + 1];
+
+    if(parallel && end - start >= cParallelLevelSize)
+      Z::gJobs->ParallelFor(start, end, cUpdateGrainSize, TransformHierarchyUpdateRange(this));
+    else
+      UpdateRange(start, end);
+  }
+}
+
+void TransformHierarchy::UpdateRange(uint start, uint end)
+{
+  for(uint i = start; i < end; ++i)
+  {
+    if(mDirty[i] == 0)
+      continue;
+
+    // Children of external parents were already computed by Update
+    Mat4 local = BuildLocalMatrix(i);
+    uint parent = mParents[i];
+    if(parent != cNoParent)
+      mWorldMatrices[i] = mWorldMatrices[parent] * local;
+    else
+      mWorldMatrices[i] = local;
+    mDirty[i] = 0;
+  }
+}
+
+Mat4 TransformHierarchy::BuildLocalMatrix(uint index)
+{
+  return Math::BuildTransform(mLocalTranslations[index], mLocalRotations[index], mLocalScales[index]);
+}
+
+uint TransformHierarchy::GetParentIndex(Transform* transform)
+{
+  Transform* parent = transform->TransformParent;
+  if(transform->InWorld || parent == nullptr)
+    return cNoParent;
+
+  if(parent->mHierarchy != this)
+    return cExternalParent;
+  return parent->mHierarchyIndex;
+}
+
+uint TransformHierarchy::ComputeDepth(uint index, Array<uint>& depths)
+{
+  if(depths[index] != cNoParent)
+    return depths[index];
+
+  uint parent = GetParentIndex(mTransforms[index]);
+  uint depth = 0;
+  if(parent < cExternalParent)
+    depth = ComputeDepth(parent, depths) + 1;
+  depths[index] = depth;
+  return depth;
+}
+
+// Moves each live value to its new index, dropping removed entries
+template <typename type>
+void PermuteArray(Array<type>& values, const Array<uint>& newIndices, uint newCount)
+{
+  Array<type> permuted;
+  permuted.Resize(newCount);
+  for(uint i = 0; i < values.Size(); ++i)
+  {
+    if(newIndices[i] != TransformHierarchy::cNoParent)
+      permuted[newIndices[i]] = values[i];
+  }
+  values.Swap(permuted);
+}
+
+void TransformHierarchy::Rebuild()
+{
+  uint count = mTransforms.Size();
+  uint liveCount = count - mRemovedCount;
+
+  Array<uint> depths;
+  depths.Resize(count, cNoParent);
+  uint maxDepth = 0;
+  for(uint i = 0; i < count; ++i)
+  {
+    if(mTransforms[i])
+      maxDepth = Math::Max(maxDepth, ComputeDepth(i, depths));
+  }
+
+  // Counting sort by depth (stable, so siblings keep their relative order)
+  mLevelStarts.Clear();
+  mLevelStarts.Resize(maxDepth + 2, 0);
+  for(uint i = 0; i < count; ++i)
+  {
+    if(mTransforms[i])
+      ++mLevelStarts[depths[i] + 1];
+  }
+  for(uint level = 1; level < mLevelStarts.Size(); ++level)
+    mLevelStarts[level] += mLevelStarts[level - 1];
+
+  Array<uint> nextIndex(mLevelStarts);
+  Array<uint> newIndices;
+  newIndices.Resize(count, cNoParent);
+  for(uint i = 0; i < count; ++i)
+  {
+    if(mTransforms[i])
+      newIndices[i] = nextIndex[depths[i]]++;
+  }
+
+  PermuteArray(mTransforms, newIndices, liveCount);
+  PermuteArray(mLocalTranslations, newIndices, liveCount);
+  PermuteArray(mLocalRotations, newIndices, liveCount);
+  PermuteArray(mLocalScales, newIndices, liveCount);
+  PermuteArray(mWorldMatrices, newIndices, liveCount);
+  PermuteArray(mDirty, newIndices, liveCount);
+  mParents.Resize(liveCount);
+  mRemovedCount = 0;
+
+  for(uint i = 0; i < liveCount; ++i)
+    mTransforms[i]->mHierarchyIndex = i;
+
+  mExternalChildren.Clear();
+  for(uint i = 0; i < liveCount; ++i)
+  {
+    mParents[i] = GetParentIndex(mTransforms[i]);
+    if(mParents[i] == cExternalParent)
+      mExternalChildren.PushBack(i);
+  }
+
+  mOrderDirty = false;
+}
+
+}//namespace Zero
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file TransformHierarchy.hpp
+/// Declaration of the TransformHierarchy world matrix cache.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+class Transform;
+
+//----------------------------------------------------------- Transform Hierarchy
+/// Optional per space store for the transforms' world matrices (see
+/// Transform::sUseTransformHierarchy). The local translation, rotation, scale,
+/// parent index and world matrix of every transform are kept in parallel
+/// arrays sorted by depth, so parents always come before their children.
+/// Transform's setters write the local values into the arrays and flag the
+/// transform (and its children) dirty, Update then recomputes every dirty
+/// world matrix from the arrays alone in one pass a depth level at a time,
+/// splitting large levels across the job system. Transform stays the
+/// interface, a world matrix requested while dirty is computed on demand by
+/// walking the parent indices.
+class TransformHierarchy
+{
+public:
+  static const uint cNoParent = (uint)-1;
+  /// The parent's world matrix isn't in this hierarchy (it was initialized
+  /// before the hierarchy was enabled) and is read through its Transform
+  static const uint cExternalParent = (uint)-2;
+
+  TransformHierarchy();
+  ~TransformHierarchy();
+
+  void Add(Transform* transform);
+  void Remove(Transform* transform);
+
+  /// A transform's parent or InWorld state changed. Its parent index is
+  /// updated now, the depth order is rebuilt on the next Update.
+  void ParentsChanged(Transform* transform);
+
+  /// Stores the transform's local values used to build its world matrix.
+  void SetLocalValues(uint index, Vec3Param translation, QuatParam rotation, Vec3Param scale);
+
+  /// Flags the world matrix to be recomputed. Returns false if it already was.
+  bool MarkDirty(uint index);
+
+  /// The world matrix, computed now if it is dirty.
+  Mat4 GetWorldMatrix(uint index);
+
+  /// Recomputes all dirty world matrices. Called once per frame by TimeSpace.
+  void Update();
+
+  uint GetCount() { return mTransforms.Size() - mRemovedCount; }
+
+private:
+  friend struct TransformHierarchyUpdateRange;
+
+  void Rebuild();
+  uint ComputeDepth(uint index, Array<uint>& depths);
+  uint GetParentIndex(Transform* transform);
+  void UpdateRange(uint start, uint end);
+  /// Builds the local matrix from the stored translation, rotation and scale
+  Mat4 BuildLocalMatrix(uint index);
+
+  // Structure of arrays indexed by Transform::mHierarchyIndex. Only Add,
+  // Remove and Rebuild read the transforms, removed entries are null until
+  // the next rebuild compacts them.
+  Array<Transform*> mTransforms;
+  Array<uint> mParents;
+  Array<Vec3> mLocalTranslations;
+  Array<Quat> mLocalRotations;
+  Array<Vec3> mLocalScales;
+  Array<Mat4> mWorldMatrices;
+  Array<byte> mDirty;
+
+  /// Where each depth level starts (plus the end), valid when not mOrderDirty
+  Array<uint> mLevelStarts;
+  /// Indices with a cExternalParent, computed before the levels are updated
+  Array<uint> mExternalChildren;
+  /// Removed entries waiting for the next rebuild
+  uint mRemovedCount;
+  /// Transforms were added, removed or re-parented since the last rebuild
+  bool mOrderDirty;
+};
+
+}//namespace Zero
@@ -296,6 +296,10 @@ NetProperty* NetChannel::AddNetProperty(Component* component, Property* property
     return nullptr;
   }
 
+  // Script properties may call NetProperty.MarkDirty from their setters, native setters never do
+  // (Native properties are compared every detection interval even if their config uses dirty flags)
+  netProperty->SetHasDirtyHook(!property->Owner->Native);
+
   // Success
   return netProperty;
 }
@@ -410,6 +414,7 @@ ZilchDefineType(NetChannelType, builder, type)
   ZilchBindGetterSetterProperty(ReliabilityMode);
   ZilchBindGetterSetterProperty(TransferMode);
   ZilchBindGetterSetterProperty(AccurateTimestampOnChange);
+  ZilchBindGetterSetterProperty(UseDeltaSnapshots);
 }
 
 NetChannelType::NetChannelType(const String& name)
@@ -449,6 +454,7 @@ void NetChannelType::ResetConfig()
     SetReplicateOnOffline();
     SetSerializationMode();
     SetTransferMode();
+    SetUseDeltaSnapshots();
   }
 
   // Set runtime config options
@@ -479,6 +485,7 @@ void NetChannelType::SetConfig(NetChannelConfig* netChannelConfig)
     SetReplicateOnOffline(netChannelConfig->mReplicateOnOffline);
     SetSerializationMode(netChannelConfig->mSerializationMode);
     SetTransferMode(netChannelConfig->mTransferMode);
+    SetUseDeltaSnapshots(netChannelConfig->mUseDeltaSnapshots);
   }
 
   // Set runtime config options
@@ -751,6 +758,23 @@ bool NetChannelType::GetAccurateTimestampOnChange() const
   return ReplicaChannelType::GetAccurateTimestampOnChange();
 }
 
+void NetChannelType::SetUseDeltaSnapshots(bool useDeltaSnapshots)
+{
+  // Already valid?
+  if(ReplicaChannelType::IsValid())
+  {
+    // Unable to modify configuration
+    DoNotifyError("NetChannelType", "Unable to modify this NetChannelType configuration option at game runtime");
+    return;
+  }
+
+  ReplicaChannelType::SetUseDeltaSnapshots(useDeltaSnapshots);
+}
+bool NetChannelType::GetUseDeltaSnapshots() const
+{
+  return ReplicaChannelType::GetUseDeltaSnapshots();
+}
+
 //---------------------------------------------------------------------------------//
 //                              NetChannelConfig                                   //
 //---------------------------------------------------------------------------------//
@@ -786,6 +810,7 @@ ZilchDefineType(NetChannelConfig, builder, type)
   ZilchBindFieldProperty(mReliabilityMode);
   ZilchBindFieldProperty(mTransferMode);
   ZilchBindFieldProperty(mAccurateTimestampOnChange);
+  ZilchBindFieldProperty(mUseDeltaSnapshots);
 }
 
 void NetChannelConfig::Serialize(Serializer& stream)
@@ -810,6 +835,7 @@ void NetChannelConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(ReliabilityMode, mReliabilityMode, ReliabilityMode::Reliable);
   SerializeEnumNameDefault(TransferMode, mTransferMode, TransferMode::Ordered);
   SerializeNameDefault(mAccurateTimestampOnChange, false);
+  SerializeNameDefault(mUseDeltaSnapshots, false);
 }
 
 //
@@ -253,6 +253,13 @@ public:
   /// (This setting may be overridden for net channels belonging to a specific net object by enabling the corresponding net object setting)
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
+
+  /// Controls whether or not net channel changes are sent as delta snapshots.
+  /// Every change serializes all net properties, encoded per link as a bitwise delta against the last change that link acknowledged.
+  /// (Reduces bandwidth for net properties that change slowly, such as transforms)
+  /// (Cannot be modified at game runtime)
+  void SetUseDeltaSnapshots(bool useDeltaSnapshots = false);
+  bool GetUseDeltaSnapshots() const;
 };
 
 //---------------------------------------------------------------------------------//
@@ -362,6 +369,11 @@ public:
   /// Controls whether or not the net channel will serialize an accurate timestamp value when changed, or will instead accept an estimated timestamp value.
   /// (This setting may be overridden for net channels belonging to a specific net object by enabling the corresponding net object setting)
   bool mAccurateTimestampOnChange;
+
+  /// Controls whether or not net channel changes are sent as delta snapshots.
+  /// Every change serializes all net properties, encoded per link as a bitwise delta against the last change that link acknowledged.
+  /// (Reduces bandwidth for net properties that change slowly, such as transforms)
+  bool mUseDeltaSnapshots;
 };
 
 //---------------------------------------------------------------------------------//
@@ -97,6 +97,9 @@ namespace Events
   // Network Ownership:
   DefineEvent(NetUserOwnerChanged);
 
+  // Network Relevance:
+  DefineEvent(NetObjectRelevance);
+
   // Network Channel Property Change:
   DefineEvent(NetChannelOutgoingPropertyInitialized);
   DefineEvent(NetChannelIncomingPropertyInitialized);
@@ -207,6 +210,9 @@ void BindNetEvents(LibraryBuilder& builder, BoundType* type)
   // Network Ownership:
   ZeroBindEvent(Events::NetUserOwnerChanged, NetUserOwnerChanged);
 
+  // Network Relevance:
+  ZeroBindEvent(Events::NetObjectRelevance, NetObjectRelevance);
+
   // Network Channel Property Change:
   ZeroBindEvent(Events::NetChannelOutgoingPropertyInitialized,   NetChannelPropertyChange);
   ZeroBindEvent(Events::NetChannelIncomingPropertyInitialized,   NetChannelPropertyChange);
@@ -788,6 +794,25 @@ ZilchDefineType(NetUserOwnerChanged, builder, type)
   ZilchBindFieldGetterProperty(mCurrentNetUserOwner);
 }
 
+///////////////////////
+// Network Relevance //
+///////////////////////
+
+//---------------------------------------------------------------------------------//
+//                              NetObjectRelevance                                 //
+//---------------------------------------------------------------------------------//
+
+ZilchDefineType(NetObjectRelevance, builder, type)
+{
+  // Bind documentation
+  ZeroBindDocumented();
+
+  // Bind properties
+  ZilchBindFieldGetterProperty(mTheirNetPeerId);
+  ZilchBindFieldGetterProperty(mDistance);
+  ZilchBindFieldProperty(mReturnRelevant);
+}
+
 /////////////////////////////////////
 // Network Channel Property Change //
 /////////////////////////////////////
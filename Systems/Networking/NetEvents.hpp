@@ -131,6 +131,11 @@ namespace Events
   // Generated as a result of changing NetObject ownership, for ALL RELEVANT peers in the network graph.
   DeclareEvent(NetUserOwnerChanged);
 
+  // Network Relevance:
+  // [Server] (Dispatched on Object Cog)
+  // Generated when the Object's relevance to a remote peer is updated, for the LOCAL peer only.
+  DeclareEvent(NetObjectRelevance);
+
   // Network Channel Property Change:
   // [Client/Server] (Dispatched on Cog)
   // Generated after an outgoing/incoming net property change is detected, for ALL RELEVANT peers in the network graph.
@@ -682,6 +687,27 @@ public:
   Cog* mCurrentNetUserOwner;  ///< The object's current network user owner.
 };
 
+///////////////////////
+// Network Relevance //
+///////////////////////
+
+//---------------------------------------------------------------------------------//
+//                              NetObjectRelevance                                 //
+//---------------------------------------------------------------------------------//
+
+/// Dispatched when the net object's relevance to a remote peer is updated.
+/// Changes to the net object are not replicated to peers it is irrelevant to, until it becomes relevant again.
+class NetObjectRelevance : public Event
+{
+public:
+  ZilchDeclareType(TypeCopyMode::ReferenceType);
+
+  // Data
+  NetPeerId mTheirNetPeerId; ///< Their net peer ID.
+  float     mDistance;       ///< Distance to their nearest owned net object (-1 if none are within the relevance radius).
+  bool      mReturnRelevant; ///< Return: Is the net object relevant to their peer? (Defaults to the relevance radius result.)
+};
+
 /////////////////////////////////////
 // Network Channel Property Change //
 /////////////////////////////////////
@@ -82,6 +82,9 @@ ZilchDefineType(NetPeer, builder, type)
   ZilchBindGetterProperty(NetSpaceCount)->Add(new EditInGameFilter);
   ZilchBindGetterSetterProperty(FrameFillWarning);
   ZilchBindGetterSetterProperty(FrameFillSkip);
+  ZilchBindGetterSetterProperty(RelevanceInterval);
+  ZilchBindGetterSetterProperty(RelevanceRadius);
+  ZilchBindGetterSetterProperty(PrioritizeChanges);
 
   // Bind link interface
   ZilchBindGetterProperty(LinkCount)->Add(new EditInGameFilter);
@@ -151,6 +154,8 @@ NetPeer::NetPeer()
     mFamilyTreeIdStore(),
     mActiveReplicaStream(nullptr),
     mActiveCogInitializer(nullptr),
+    mRelevanceRadius(0),
+    mRelevanceGrid(),
     mLanDiscoverable(false),
     mInternetDiscoverable(false),
     mFacilitateInternetConnections(false),
@@ -193,6 +198,9 @@ void NetPeer::ResetConfig()
   // Peer settings
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetRelevanceInterval();
+  SetRelevanceRadius();
+  SetPrioritizeChanges();
 
   // Timeout settings
   SetInternetHostListTimeout();
@@ -233,6 +241,9 @@ void NetPeer::Serialize(Serializer& stream)
   // Serialize peer settings
   SerializeNameDefault(mFrameFillWarning, GetFrameFillWarning());
   SerializeNameDefault(mFrameFillSkip, GetFrameFillSkip());
+  SerializeNameDefault(mRelevanceInterval, GetRelevanceInterval());
+  SerializeNameDefault(mRelevanceRadius, GetRelevanceRadius());
+  SerializeNameDefault(mPrioritizeChanges, GetPrioritizeChanges());
 
   // Serialize peer timeouts
   SerializeNameDefault(mInternetHostListTimeout, GetInternetHostListTimeout());
@@ -1254,6 +1265,33 @@ float NetPeer::GetFrameFillSkip() const
   return Replicator::GetFrameFillSkip();
 }
 
+void NetPeer::SetRelevanceInterval(uint relevanceInterval)
+{
+  Replicator::SetRelevanceInterval(relevanceInterval);
+}
+uint NetPeer::GetRelevanceInterval() const
+{
+  return Replicator::GetRelevanceInterval();
+}
+
+void NetPeer::SetRelevanceRadius(float relevanceRadius)
+{
+  mRelevanceRadius = Math::Max(relevanceRadius, 0.0f);
+}
+float NetPeer::GetRelevanceRadius() const
+{
+  return mRelevanceRadius;
+}
+
+void NetPeer::SetPrioritizeChanges(bool prioritizeChanges)
+{
+  Replicator::SetPrioritizeChanges(prioritizeChanges);
+}
+bool NetPeer::GetPrioritizeChanges() const
+{
+  return Replicator::GetPrioritizeChanges();
+}
+
 //
 // Link Interface
 //
@@ -4443,6 +4481,170 @@ void NetPeer::OnReplicaChannelPropertyChange(TimeMs timestamp, ReplicationPhase:
   }
 }
 
+//
+// Replicator Relevance Interface
+//
+
+/// Returns the relevance grid cell containing the position.
+static IntVec3 GetRelevanceCell(Vec3Param position, float cellSize)
+{
+  return IntVec3(int(Math::Floor(position.x / cellSize)),
+                 int(Math::Floor(position.y / cellSize)),
+                 int(Math::Floor(position.z / cellSize)));
+}
+/// Returns the relevance grid key of the cell.
+/// (Packs the lowest 21 bits of each cell coordinate)
+static u64 GetRelevanceCellKey(const IntVec3& cell)
+{
+  return  (u64(cell.x) & 0x1FFFFF)
+       | ((u64(cell.y) & 0x1FFFFF) << 21)
+       | ((u64(cell.z) & 0x1FFFFF) << 42);
+}
+
+void NetPeer::OnRelevanceUpdate()
+{
+  // Clear previous relevance viewers
+  mRelevanceGrid.Clear();
+
+  // Relevance radius disabled?
+  float relevanceRadius = GetRelevanceRadius();
+  if(relevanceRadius == 0)
+    return;
+
+  // For all live net objects
+  forRange(Replica* replica, Replicator::GetReplicas().All())
+  {
+    // Get net object
+    NetObject* netObject = static_cast<NetObject*>(replica);
+
+    // Not owned by a net user?
+    Cog* netUserOwner = netObject->GetNetUserOwner();
+    if(!netUserOwner)
+      continue;
+
+    // Net object has no position?
+    Vec3 position;
+    if(!GetRelevancePosition(netObject, position))
+      continue;
+
+    // Add relevance viewer to the grid cell containing its position
+    NetRelevanceViewer viewer;
+    viewer.mNetPeerId = netUserOwner->has(NetUser)->mNetPeerId;
+    viewer.mSpace     = netObject->GetOwner()->GetSpace();
+    viewer.mPosition  = position;
+    mRelevanceGrid[GetRelevanceCellKey(GetRelevanceCell(position, relevanceRadius))].PushBack(viewer);
+  }
+}
+bool NetPeer::IsReplicaRelevant(ReplicatorLink* link, Replica* replica)
+{
+  // Get net object
+  NetObject* netObject = static_cast<NetObject*>(replica);
+  Cog*       cog       = netObject->GetOwner();
+
+  // Get their net peer ID
+  NetPeerId theirNetPeerId = link->GetReplicatorId().value();
+
+  // Net object is the net peer, a net space, or a net user?
+  if(netObject->IsNetPeer() || netObject->IsNetSpace() || netObject->IsNetUser())
+    return true; // Always relevant
+
+  // Net object is owned by their net user?
+  Cog* netUserOwner = netObject->GetNetUserOwner();
+  if(netUserOwner && netUserOwner->has(NetUser)->mNetPeerId == theirNetPeerId)
+    return true; // Always relevant
+
+  // Determine relevance by distance to their owned net objects
+  // (Net objects without a position are always relevant)
+  float distance = -1;
+  bool  relevant = true;
+  Vec3  position;
+  if(GetRelevanceRadius() != 0 && GetRelevancePosition(netObject, position))
+  {
+    distance = GetNearestViewerDistance(theirNetPeerId, cog->GetSpace(), position);
+    relevant = (distance >= 0);
+  }
+
+  // Let the user override net object relevance (as needed)
+  if(cog->HasReceivers(Events::NetObjectRelevance))
+  {
+    NetObjectRelevance event;
+    event.mTheirNetPeerId = theirNetPeerId;
+    event.mDistance       = distance;
+    event.mReturnRelevant = relevant;
+    cog->DispatchEvent(Events::NetObjectRelevance, &event);
+
+    relevant = event.mReturnRelevant;
+  }
+
+  return relevant;
+}
+float NetPeer::GetReplicaPriority(ReplicatorLink* link, Replica* replica)
+{
+  // Get net object
+  NetObject* netObject = static_cast<NetObject*>(replica);
+
+  // No relevance viewers or net object has no position?
+  Vec3 position;
+  if(mRelevanceGrid.Empty() || !GetRelevancePosition(netObject, position))
+    return 1;
+
+  // Not within the relevance radius of their owned net objects?
+  float distance = GetNearestViewerDistance(link->GetReplicatorId().value(), netObject->GetOwner()->GetSpace(), position);
+  if(distance < 0)
+    return 1;
+
+  // Nearer net objects accumulate priority faster (up to twice as fast)
+  return 2 - (distance / GetRelevanceRadius());
+}
+
+bool NetPeer::GetRelevancePosition(NetObject* netObject, Vec3& position) const
+{
+  // Get root transform
+  Transform* transform = netObject->GetOwner()->FindRoot()->has(Transform);
+  if(!transform) // Unable?
+    return false;
+
+  position = transform->GetWorldTranslation();
+  return true;
+}
+float NetPeer::GetNearestViewerDistance(NetPeerId netPeerId, Space* space, Vec3Param position) const
+{
+  float   relevanceRadius   = GetRelevanceRadius();
+  IntVec3 cell              = GetRelevanceCell(position, relevanceRadius);
+  float   nearestDistanceSq = relevanceRadius * relevanceRadius;
+  bool    found             = false;
+
+  // For the cell containing the position and all neighboring cells
+  // (The grid's cell size is the relevance radius, so no viewer within the radius can be further away)
+  for(int x = -1; x <= 1; ++x)
+  for(int y = -1; y <= 1; ++y)
+  for(int z = -1; z <= 1; ++z)
+  {
+    // Get cell viewers
+    Array<NetRelevanceViewer>* viewers = mRelevanceGrid.FindPointer(GetRelevanceCellKey(cell + IntVec3(x, y, z)));
+    if(!viewers) // No viewers?
+      continue;
+
+    // For all cell viewers
+    forRange(NetRelevanceViewer& viewer, viewers->All())
+    {
+      // Not their viewer or in a different space?
+      if(viewer.mNetPeerId != netPeerId || viewer.mSpace != space)
+        continue;
+
+      // Nearest viewer so far?
+      float distanceSq = (viewer.mPosition - position).LengthSq();
+      if(distanceSq <= nearestDistanceSq)
+      {
+        nearestDistanceSq = distanceSq;
+        found             = true;
+      }
+    }
+  }
+
+  return found ? Math::Sqrt(nearestDistanceSq) : -1.0f;
+}
+
 //
 // Replicator Link Interface
 //
@@ -9,6 +9,22 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                              NetRelevanceViewer                                 //
+//---------------------------------------------------------------------------------//
+
+/// Network object position relevance is determined from.
+/// (The root position of an online net object owned by a net user)
+struct NetRelevanceViewer
+{
+  NetPeerId mNetPeerId; ///< Net user owner's net peer ID.
+  Space*    mSpace;     ///< Network space.
+  Vec3      mPosition;  ///< Root world translation.
+};
+
+/// Relevance viewers mapped by spatial grid cell.
+typedef HashMap<u64, Array<NetRelevanceViewer> > NetRelevanceGrid;
+
 //---------------------------------------------------------------------------------//
 //                                   NetPeer                                       //
 //---------------------------------------------------------------------------------//
@@ -248,6 +264,20 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls how often (in frames) net object relevance is updated for every link, 0 disables relevance filtering.
+  /// Changes to a net object are not replicated to peers it is irrelevant to, until it becomes relevant again.
+  void SetRelevanceInterval(uint relevanceInterval = 0);
+  uint GetRelevanceInterval() const;
+
+  /// [Server] Controls the distance from a peer's owned net objects within which net objects are relevant to that peer, 0 makes every net object relevant.
+  /// (Relevance may be overridden per net object by handling the NetObjectRelevance event)
+  void SetRelevanceRadius(float relevanceRadius = 0);
+  float GetRelevanceRadius() const;
+
+  /// Controls whether net object changes are sent in order of their accumulated priority (nearer net objects accumulate priority faster), as outgoing bandwidth allows.
+  void SetPrioritizeChanges(bool prioritizeChanges = false);
+  bool GetPrioritizeChanges() const;
+
   //
   // Link Interface
   //
@@ -651,6 +681,23 @@ public:
   /// Called after a replica channel property has legitimately changed, determined using comparisons, in a particular replication phase.
   void OnReplicaChannelPropertyChange(TimeMs timestamp, ReplicationPhase::Enum replicationPhase, Replica* replica, ReplicaChannel* replicaChannel, ReplicaProperty* replicaProperty, TransmissionDirection::Enum direction) override;
 
+  //
+  // Replicator Relevance Interface
+  //
+
+  /// [Server] Called before replica relevance is updated for every link (rebuilds the relevance grid).
+  void OnRelevanceUpdate() override;
+  /// [Server] Returns true if the live replica is relevant to the specified link, else false.
+  bool IsReplicaRelevant(ReplicatorLink* link, Replica* replica) override;
+  /// Returns the priority accumulated every frame by the replica's queued changes on the specified link.
+  float GetReplicaPriority(ReplicatorLink* link, Replica* replica) override;
+
+  /// Gets the position the net object's relevance is determined from (its root's world translation).
+  /// Returns true if successful, else false (the net object has no position).
+  bool GetRelevancePosition(NetObject* netObject, Vec3& position) const;
+  /// Returns the distance to the nearest relevance viewer of the specified net peer within the relevance radius, else -1.
+  float GetNearestViewerDistance(NetPeerId netPeerId, Space* space, Vec3Param position) const;
+
   //
   // Replicator Link Interface
   //
@@ -777,6 +824,8 @@ public:
   IdStore<FamilyTreeId>             mFamilyTreeIdStore;              ///< [Client/Server] Network object family tree ID store.
   const ReplicaStream*              mActiveReplicaStream;            ///< [Client] Active replica stream (used temporarily during net object creation).
   const CogInitializer*             mActiveCogInitializer;           ///< [Client] Active cog initializer, determines replica stream context (used temporarily during net object creation).
+  float                             mRelevanceRadius;                ///< [Server] Controls the distance from a peer's owned net objects within which net objects are relevant to that peer.
+  NetRelevanceGrid                  mRelevanceGrid;                  ///< [Server] Relevance viewers mapped by spatial grid cell (rebuilt every relevance update).
   bool                              mLanDiscoverable;                ///< Configures the server peer to be discoverable on the local area network.
   bool                              mInternetDiscoverable;           ///< Configures the server peer to be discoverable on the internet.
   bool                              mFacilitateInternetConnections;  ///< Configures the peer to use connection facilitation (NAT punch-through) when establishing a connection over the internet.
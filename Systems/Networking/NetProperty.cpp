@@ -53,6 +53,7 @@ ZilchDefineType(NetProperty, builder, type)
   ZilchBindGetterProperty(NetChannel);
   ZilchBindGetterProperty(LastChangeTimestamp);
   ZilchBindGetterProperty(LastChangeTimePassed);
+  ZilchBindMethod(MarkDirty);
 }
 
 NetProperty::NetProperty(const String& name, NetPropertyType* netPropertyType, const Variant& propertyData)
@@ -113,6 +114,11 @@ float NetProperty::GetLastChangeTimePassed() const
   return TimeMsToFloatSeconds(timePassed);
 }
 
+void NetProperty::MarkDirty()
+{
+  ReplicaProperty::MarkDirty();
+}
+
 //---------------------------------------------------------------------------------//
 //                               NetPropertyType                                   //
 //---------------------------------------------------------------------------------//
@@ -164,6 +170,7 @@ void NetPropertyType::ResetConfig()
     // Set non-runtime config options
     SetDeltaThreshold();
     SetUseDeltaThreshold();
+    SetUseDirtyFlag();
     SetSerializationMode();
     SetUseHalfFloats();
     SetUseQuantization();
@@ -186,6 +193,13 @@ void NetPropertyType::ResetConfig()
 
 void NetPropertyType::SetConfig(NetPropertyConfig* netPropertyConfig)
 {
+  // Not valid yet?
+  if(!IsValid())
+  {
+    // Set non-runtime config options (used by all types)
+    SetUseDirtyFlag(netPropertyConfig->mUseDirtyFlag);
+  }
+
   // Get config's target network property type
   BasicNetType::Enum configBasicNetType = netPropertyConfig->GetBasicNetType();
 
@@ -416,6 +430,7 @@ ZilchDefineType(NetPropertyConfig, builder, type)
   ZilchBindGetterSetterProperty(BasicNetType)->AddAttribute(PropertyAttributes::cInvalidatesObject);
   ZilchBindGetterSetterProperty(UseDeltaThreshold)->Add(new PropertyFilterArithmeticTypes);
   BindVariantGetSetForArithmeticTypes(DeltaThreshold);
+  ZilchBindGetterSetterProperty(UseDirtyFlag);
   ZilchBindGetterSetterProperty(SerializationMode)->Add(new PropertyFilterMultiPrimitiveTypes);
   ZilchBindGetterSetterProperty(UseHalfFloats)->AddAttributeChainable(PropertyAttributes::cInvalidatesObject)->Add(new PropertyFilterFloatingPointTypes);
   ZilchBindGetterSetterProperty(UseQuantization)->AddAttributeChainable(PropertyAttributes::cInvalidatesObject)->Add(new PropertyFilterArithmeticTypes);
@@ -437,6 +452,7 @@ NetPropertyConfig::NetPropertyConfig()
   : mBasicNetType(BasicNetType::Other),
     mUseDeltaThreshold(false),
     mDeltaThreshold(),
+    mUseDirtyFlag(false),
     mSerializationMode(SerializationMode::All),
     mUseHalfFloats(false),
     mUseQuantization(false),
@@ -465,6 +481,7 @@ void NetPropertyConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(BasicNetType, mBasicNetType, BasicNetType::Real);
   SerializeNameDefault(mUseDeltaThreshold, false);
   SerializeNameDefault(mDeltaThreshold, Variant(DefaultFloatDeltaThreshold));
+  SerializeNameDefault(mUseDirtyFlag, false);
   SerializeEnumNameDefault(SerializationMode, mSerializationMode, SerializationMode::All);
   SerializeNameDefault(mUseHalfFloats, false);
   SerializeNameDefault(mUseQuantization, false);
@@ -542,6 +559,15 @@ bool NetPropertyConfig::GetUseDeltaThreshold() const
 
 DefineVariantGetSetForArithmeticTypes(DeltaThreshold);
 
+void NetPropertyConfig::SetUseDirtyFlag(bool useDirtyFlag)
+{
+  mUseDirtyFlag = useDirtyFlag;
+}
+bool NetPropertyConfig::GetUseDirtyFlag() const
+{
+  return mUseDirtyFlag;
+}
+
 void NetPropertyConfig::SetSerializationMode(SerializationMode::Enum serializationMode)
 {
   mSerializationMode = serializationMode;
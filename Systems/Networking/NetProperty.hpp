@@ -44,6 +44,10 @@ public:
 
   /// Elapsed time passed since this net property was last changed, else 0.
   float GetLastChangeTimePassed() const;
+
+  /// Marks the net property as changed, to be compared on the next change detection.
+  /// (Call from the script property setter when the NetPropertyConfig uses dirty flags, otherwise does nothing)
+  void MarkDirty();
 };
 
 //---------------------------------------------------------------------------------//
@@ -149,6 +153,12 @@ public:
   /// Controls the delta threshold at which a net property's primitive-components are considered changed during change detection.
   DeclareVariantGetSetForArithmeticTypes(DeltaThreshold, float(1), int(1));
 
+  /// Controls whether or not net properties are only compared during change detection after being marked dirty (see NetProperty.MarkDirty).
+  /// (Enable if every property setter marks the net property dirty, avoids getting and comparing unchanged property values every detection interval)
+  /// (Only applies to script properties, native properties are compared every detection interval)
+  void SetUseDirtyFlag(bool useDirtyFlag);
+  bool GetUseDirtyFlag() const;
+
   /// Controls how net properties are serialized.
   void SetSerializationMode(SerializationMode::Enum serializationMode);
   SerializationMode::Enum GetSerializationMode() const;
@@ -221,6 +231,7 @@ public:
   BasicNetType::Enum      mBasicNetType;                  ///< Target basic property type.
   bool                    mUseDeltaThreshold;             ///< Use delta threshold?
   Variant                 mDeltaThreshold;                ///< Delta threshold.
+  bool                    mUseDirtyFlag;                  ///< Use dirty flag?
   SerializationMode::Enum mSerializationMode;             ///< Serialization mode.
   bool                    mUseHalfFloats;                 ///< Use half floats?
   bool                    mUseQuantization;               ///< Use quantization?
@@ -113,6 +113,7 @@ ZilchDefineStaticLibrary(NetworkingLibrary)
   ZilchInitializeType(NetObjectOnline);
   ZilchInitializeType(NetObjectOffline);
   ZilchInitializeType(NetUserOwnerChanged);
+  ZilchInitializeType(NetObjectRelevance);
   ZilchInitializeType(NetChannelPropertyChange);
   ZilchInitializeType(NetEventSent);
   ZilchInitializeType(NetEventReceived);
@@ -504,6 +504,10 @@ void Collider::OnPhysicsMaterialModified(Event* e)
   // mass terms since our density was (likely) just changed.
   if(mActiveRigidBody)
     mActiveRigidBody->QueueMassUpdate();
+
+  // Cached contacts still have the old material's properties
+  if(mSpace != nullptr)
+    mSpace->InvalidateCachedManifolds(this);
 }
 
 void Collider::SetWorldAabbFromHalfExtents(Vec3Param worldHalfExtents)
@@ -691,6 +695,9 @@ void Collider::InternalSizeChanged()
   // This might not be needed since the transform update will cause this to happen later
   // but to avoid any missing dirty bit checks force this here.
   CacheWorldValues();
+  // Cached contacts were generated against the old shape
+  if(mSpace != nullptr)
+    mSpace->InvalidateCachedManifolds(this);
 }
 
 void Collider::InternalTransformUpdate(eUpdateTransformState updateState)
@@ -27,7 +27,7 @@ ContactManager::~ContactManager()
   DestroyContacts();
 }
 
-Contact* ContactManager::AddManifold(Manifold& manifold)
+Contact* ContactManager::AddManifold(Manifold& manifold, bool speculative)
 {
   // Correct this manifold for 2d if it needs to be. If this returns
   // false then there are no points left in the manifold and
@@ -45,6 +45,7 @@ Contact* ContactManager::AddManifold(Manifold& manifold)
     contact->mContactManager = this;
     contact->SetPair(manifold.Objects);
     contact->SetManifold(new Manifold(manifold));
+    contact->SetSpeculative(speculative);
     ++contact->GetCollider(0)->mContactCount;
     ++contact->GetCollider(1)->mContactCount;
 
@@ -56,12 +57,35 @@ Contact* ContactManager::AddManifold(Manifold& manifold)
     // Can't change state in the middle of looping, otherwise broadphase
     // can get false positives due to order dependency on contact adding.
     
+    // Nothing is touching yet for a speculative contact
+    if(speculative)
+      return contact;
     eventManager->BatchCollisionStartedEvent(contact->mManifold, mSpace);
   }
   else
   {
+    // Switching between touching and speculative replaces the old points
+    bool wasSpeculative = contact->GetSpeculative();
+    if(wasSpeculative != speculative)
+    {
+      contact->mManifold->ContactCount = 0;
+      contact->mManifold->ManifoldPolicy = manifold.ManifoldPolicy;
+      contact->SetSpeculative(speculative);
+    }
     contact->UpdateManifold(&manifold);
-    eventManager->BatchCollisionPersistedEvent(contact->mManifold, mSpace);
+
+    // The colliders separated but are still closing in on each other
+    if(speculative)
+    {
+      if(!wasSpeculative)
+        eventManager->BatchCollisionEndedEvent(contact->mManifold, mSpace, false);
+      return contact;
+    }
+
+    if(wasSpeculative)
+      eventManager->BatchCollisionStartedEvent(contact->mManifold, mSpace);
+    else
+      eventManager->BatchCollisionPersistedEvent(contact->mManifold, mSpace);
   }
   // Whether or not this is a start or persisted collision,
   // we should batch up pre-solve events
@@ -94,7 +118,9 @@ void ContactManager::Remove(Contact* contact, bool sendImmediately)
     manifold->Objects.B->ForceAwake();
   }
 
-  mSpace->mEventManager->BatchCollisionEndedEvent(manifold, mSpace, sendImmediately);
+  // Speculative contacts never started so they don't end
+  if(!contact->GetSpeculative())
+    mSpace->mEventManager->BatchCollisionEndedEvent(manifold, mSpace, sendImmediately);
 
   // We want the CollisionEnded event to have access to the manifold, but the contact
   // owns the manifold and would delete it, so delay destruct the contacts
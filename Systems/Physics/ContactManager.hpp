@@ -23,8 +23,9 @@ public:
   ~ContactManager();
 
   /// Gets the existing contact for this manifold or creates a new one if none exists.
-  /// Used when a collision has been detected.
-  Contact* AddManifold(Manifold& manifold);
+  /// Used when a collision has been detected. Speculative manifolds are for colliders
+  /// that will touch this step (see SpeculativeCollision) and don't send events.
+  Contact* AddManifold(Manifold& manifold, bool speculative = false);
   /// Used when a collision no longer should exist.
   void RemoveManifold(Manifold* manifold);
   /// Used when a contact should be removed, maybe due to object deletion.
@@ -69,6 +69,7 @@ class IBroadPhase;
 class ConstraintSolver;
 class CollisionManager;
 class ContactManager;
+class ManifoldCache;
 class IslandManager;
 struct ConstraintSolverConfiguration;
 struct PhysicsNodeManager;
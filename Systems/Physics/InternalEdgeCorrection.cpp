@@ -208,34 +208,31 @@ void GenerateInternalEdgeInfo(PhysicsMesh* mesh, TriangleInfoMap* infoMap)
 {
   infoMap->Clear();
 
-  //get the tree and make sure it exists
-  typedef StaticAabbTree<uint> TreeType;
-  TreeType* treePointer = mesh->GetAabbTree();
-  if(treePointer == nullptr)
+  //get the bvh and make sure it exists
+  MeshBvh* bvh = mesh->GetBvh();
+  if(bvh == nullptr)
   {
-    ErrorIf(true, "Physics mesh returned a null tree pointer, "
-                  "tree must not have been constructed yet.");
+    ErrorIf(true, "Physics mesh returned a null bvh pointer, "
+                  "bvh must not have been constructed yet.");
     return;
   }
-  //i believe the range macro below doesn't like pointers, so convert to a reference
-  TreeType& tree = *treePointer;
 
   //loop over all of the triangles in the mesh, for each triangle send it through
-  //the tree to determine which triangles should be checked for the more
+  //the bvh to determine which triangles should be checked for the more
   //expensive internal calculation (should I fatten the aabb?)
+  Array<uint> overlappingIds;
   uint triangleCount = mesh->GetTriangleCount();
   for(uint indexA = 0; indexA < triangleCount; ++indexA)
   {
     Triangle triA = mesh->GetTriangle(indexA);
     Aabb triAabb = ToAabb(triA);
 
-    Array<TreeType::NodeType*> scratchData;
-    AutoDeclare(range, tree.Query(triAabb,scratchData));
-    for(; !range.Empty(); range.PopFront())
-    //forRangeBroadphaseTree(StaticAabbTree<uint>, tree, Aabb, triAabb)
+    overlappingIds.Clear();
+    bvh->Query(triAabb, overlappingIds);
+    for(uint i = 0; i < overlappingIds.Size(); ++i)
     {
       //Get the triangle index
-      uint indexB = range.Front();
+      uint indexB = overlappingIds[i];
       //if not the same triangle, try to compute the voronoi edge info for the pair.
       if(indexA != indexB)
       {
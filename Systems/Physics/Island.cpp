@@ -172,6 +172,16 @@ void Island::Solve(real dt, bool allowSleeping, uint debugFlags)
   UpdateSleep(dt, allowSleeping, debugFlags);
 }
 
+void Island::SolveWithoutEvents(real dt)
+{
+  mSolver->SolveWithoutEvents(dt);
+}
+
+void Island::BatchEvents()
+{
+  mSolver->BatchEvents();
+}
+
 void Island::SolvePositions(real dt)
 {
   mSolver->SolvePositions();
@@ -182,6 +192,12 @@ void Island::UpdateSleep(real dt, bool allowSleeping, uint debugFlags)
   if(!allowSleeping)
     return;
 
+  if(UpdateSleepTimers(dt, debugFlags))
+    PutToSleep();
+}
+
+bool Island::UpdateSleepTimers(real dt, uint debugFlags)
+{
   real minSleepTime = Math::PositiveMax();
 
   //Update the sleep timers of all objects
@@ -211,10 +227,12 @@ void Island::UpdateSleep(real dt, bool allowSleeping, uint debugFlags)
     }
   }
 
-  if(minSleepTime < cTimeToSleep)
-    return;
+  return minSleepTime >= cTimeToSleep;
+}
 
-  range = mColliders.All();
+void Island::PutToSleep()
+{
+  Colliders::range range = mColliders.All();
 
   while(!range.Empty())
   {
@@ -40,8 +40,16 @@ public:
   void IntegratePosition(real dt);
   void CommitConstraints();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  ///Solves the constraints without sending any events (see BatchEvents). Islands
+  ///don't share dynamic bodies so different islands can be solved at the same time.
+  void SolveWithoutEvents(real dt);
+  void BatchEvents();
   void SolvePositions(real dt);
   void UpdateSleep(real dt, bool allowSleeping, uint debugFlags);
+  ///Accumulates the sleep timers of the island's bodies. Returns true if
+  ///they've all been resting long enough for the island to go to sleep.
+  bool UpdateSleepTimers(real dt, uint debugFlags);
+  void PutToSleep();
   ///Helper function to mark everything as not on an island.
   void ClearIslandFlags(Collider& collider);
   void Clear();
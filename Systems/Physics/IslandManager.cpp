@@ -262,6 +262,59 @@ struct ConstraintCountPreProcessing
   }
 };
 
+// Islands are grouped into batches of at least this many constraints (plus
+// one per island) so a pile of tiny islands doesn't become a pile of tiny jobs
+const uint cIslandBatchCost = 64;
+
+struct IslandSolveEntry
+{
+  bool operator<(const IslandSolveEntry& rhs) const
+  {
+    //largest first, ties keep the island order so the batches are deterministic
+    if(mCost != rhs.mCost)
+      return mCost > rhs.mCost;
+    return mIndex < rhs.mIndex;
+  }
+
+  Island* mIsland;
+  uint mCost;
+  uint mIndex;
+};
+
+// Solves batches of islands on the job workers. The range is just the number
+// of threads helping, each one claims the next batch until there are none left
+// so the largest islands start first and the small batches fill in the gaps.
+struct IslandSolveRange
+{
+  void operator()(uint start, uint end)
+  {
+    uint batchCount = mBatchStarts->Size() - 1;
+    for(;;)
+    {
+      uint batch = (uint)mNextBatch->FetchAdd(1);
+      if(batch >= batchCount)
+        return;
+
+      for(uint i = (*mBatchStarts)[batch]; i < (*mBatchStarts)[batch + 1]; ++i)
+      {
+        ProfileScopeTree("IslandSolve", "ResolutionPhase", Color::Coral);
+        IslandSolveEntry& entry = (*mEntries)[i];
+        entry.mIsland->SolveWithoutEvents(mDt);
+
+        if(mUpdateSleep)
+          (*mCanSleep)[entry.mIndex] = entry.mIsland->UpdateSleepTimers(mDt, 0);
+      }
+    }
+  }
+
+  Array<IslandSolveEntry>* mEntries;
+  Array<uint>* mBatchStarts;
+  Array<byte>* mCanSleep;
+  Atomic<s32>* mNextBatch;
+  real mDt;
+  bool mUpdateSleep;
+};
+
 IslandManager::IslandManager(PhysicsSolverConfig* config)
 {
   mIslandCount = 0;
@@ -270,6 +323,7 @@ IslandManager::IslandManager(PhysicsSolverConfig* config)
   mPhysicsSolverConfig = config;
   mSpace = nullptr;
   mPostProcess = false;
+  mParallelIslands = false;
   mSharedSolver = nullptr;
   mShareSolver = false;
 }
@@ -393,12 +447,88 @@ void IslandManager::Solve(real dt, bool allowSleeping, uint debugFlags)
     return;
   }
 
+  if(mParallelIslands && Z::gJobs != nullptr)
+  {
+    SolveInParallel(dt, allowSleeping, debugFlags);
+    return;
+  }
+
   //solve all of the islands.
   IslandList::range islandRange = mIslands.All();
   for(; !islandRange.Empty(); islandRange.PopFront())
     islandRange.Front().Solve(dt, allowSleeping, debugFlags);
 }
 
+void IslandManager::SolveInParallel(real dt, bool allowSleeping, uint debugFlags)
+{
+  //drawing sleep preventors isn't thread safe, so the timers are updated afterwards
+  bool parallelSleep = allowSleeping && !(debugFlags & PhysicsSpaceDebugDrawFlags::DrawSleepPreventors);
+
+  Array<IslandSolveEntry> entries;
+  uint index = 0;
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island& island = islandRange.Front();
+    island.CommitConstraints();
+
+    IslandSolveEntry& entry = entries.PushBack();
+    entry.mIsland = &island;
+    entry.mCost = island.ContactCount + island.JointCount;
+    entry.mIndex = index++;
+  }
+
+  Sort(entries.All(), less<IslandSolveEntry>());
+
+  //large islands get a batch each, small ones are grouped until the batch is worth a job
+  Array<uint> batchStarts;
+  uint batchCost = 0;
+  for(uint i = 0; i < entries.Size(); ++i)
+  {
+    if(batchCost == 0)
+      batchStarts.PushBack(i);
+    batchCost += entries[i].mCost + 1;
+    if(batchCost >= cIslandBatchCost)
+      batchCost = 0;
+  }
+  batchStarts.PushBack(entries.Size());
+
+  Array<byte> canSleep;
+  canSleep.Resize(entries.Size(), 0);
+
+  Atomic<s32> nextBatch;
+  nextBatch = 0;
+  IslandSolveRange solveRange;
+  solveRange.mEntries = &entries;
+  solveRange.mBatchStarts = &batchStarts;
+  solveRange.mCanSleep = &canSleep;
+  solveRange.mNextBatch = &nextBatch;
+  solveRange.mDt = dt;
+  solveRange.mUpdateSleep = parallelSleep;
+
+  uint batchCount = batchStarts.Size() - 1;
+  uint threadCount = Math::Min(Z::gJobs->GetWorkerCount() + 1, batchCount);
+  Z::gJobs->ParallelFor(0, threadCount, 1, solveRange);
+
+  //events go out in the same order as when solving serially
+  ProfileScopeTree("IslandEvents", "ResolutionPhase", Color::LightCoral);
+  index = 0;
+  islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront(), ++index)
+  {
+    Island& island = islandRange.Front();
+    island.BatchEvents();
+
+    if(parallelSleep)
+    {
+      if(canSleep[index])
+        island.PutToSleep();
+    }
+    else
+      island.UpdateSleep(dt, allowSleeping, debugFlags);
+  }
+}
+
 void IslandManager::SolvePositions(real dt)
 {
   IslandList::range islandRange = mIslands.All();
@@ -553,6 +683,8 @@ IConstraintSolver* IslandManager::GetNewSolver()
     solver = new NormalSolver();
   else if(mPhysicsSolverConfig->mSolverType == PhysicsSolverType::Threaded)
     solver = new ThreadedSolver();
+  else if(mPhysicsSolverConfig->mSolverType == PhysicsSolverType::WideContact)
+    solver = new WideContactSolver();
   else
     ErrorIf(true,"Invalid Solver type specified.");
 
@@ -10,7 +10,7 @@ namespace Zero
 {
 
 /// What kind of a constraint solver should be used. A few pre-defined types meant for comparing performance.
-DeclareEnum4(PhysicsSolverType, Basic, Normal, GenericBasic, Threaded);
+DeclareEnum5(PhysicsSolverType, Basic, Normal, GenericBasic, Threaded, WideContact);
 /// How should islands be built. Internal for testing (mostly legacy).
 DeclareEnum3(PhysicsIslandType, Composites, Kinematics, ForcedOne);
 /// What kind of pre-processing strategy should be used for merging islands.
@@ -35,6 +35,10 @@ public:
   void BuildIslands(ColliderList& colliders);
   void PostProcessIslands();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  ///Solves the islands on the job workers (largest first, with small islands
+  ///batched together). Events and putting islands to sleep happen afterwards
+  ///on the calling thread in the same order as the serial solve.
+  void SolveInParallel(real dt, bool allowSleeping, uint debugFlags);
   void SolvePositions(real dt);
   void Draw(uint flags);
 
@@ -65,6 +69,7 @@ public:
   PhysicsSolverConfig* mPhysicsSolverConfig;
 
   PhysicsSpace* mSpace;
+  bool mParallelIslands;
   bool mShareSolver;
   IConstraintSolver* mSharedSolver;
 };
@@ -68,16 +68,21 @@ void BasicSolver::AddContacts(ContactList& contacts)
 ///Necessary solving functions
 void BasicSolver::Solve(real dt)
 {
-  BasicSolver::UpdateData();
-  BasicSolver::WarmStart();
-  BasicSolver::SolveVelocities();
-  BasicSolver::Commit();
+  BasicSolver::SolveWithoutEvents(dt);
   BasicSolver::BatchEvents();
 
   //can't solve positions here as this step needs to run after position integration
   //BasicSolver::SolvePositions();
 }
 
+void BasicSolver::SolveWithoutEvents(real dt)
+{
+  BasicSolver::UpdateData();
+  BasicSolver::WarmStart();
+  BasicSolver::SolveVelocities();
+  BasicSolver::Commit();
+}
+
 void BasicSolver::DebugDraw(uint debugFlags)
 {
   if(debugFlags & PhysicsSpaceDebugDrawFlags::DrawConstraints)
@@ -31,6 +31,7 @@ public:
   // Solve Functions
   void AddContacts(ContactList& contacts) override;
   void Solve(real dt) override;
+  void SolveWithoutEvents(real dt) override;
   void DebugDraw(uint debugFlags) override;
   void Clear() override;
   // Iteration functions
@@ -94,6 +94,16 @@ void Contact::SetActive(bool active)
   mFlags.SetState(ContactFlags::Active,active);
 }
 
+bool Contact::GetSpeculative() const
+{
+  return mFlags.IsSet(ContactFlags::Speculative);
+}
+
+void Contact::SetSpeculative(bool speculative)
+{
+  mFlags.SetState(ContactFlags::Speculative, speculative);
+}
+
 bool Contact::GetIsNew() const
 {
   return mFlags.IsSet(ContactFlags::NewContact);
@@ -259,6 +269,15 @@ void Contact::ComputeMolecules(MoleculeWalker& fragments)
     if(relativeVelocity > velocityThreshold)
       restitutionBias = mManifold->Restitution * relativeVelocity;
 
+    //a speculative point isn't touching yet, so the bodies can approach fast enough to
+    //close the gap this step but no faster (no restitution, there's no impact yet)
+    if(GetSpeculative())
+    {
+      real dt = mContactManager->mSpace->mIterationDt;
+      fragments[0].mError = real(0.0);
+      restitutionBias = Math::Min(contact.Penetration, real(0.0)) / dt;
+    }
+
     fragments[1].mImpulse = contact.AccumulatedImpulse[1];
     fragments[1].mError = 0;
 
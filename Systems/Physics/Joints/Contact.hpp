@@ -21,7 +21,7 @@ class Contact;
 class ContactManager;
 class IConstraintSolver;
 
-DeclareBitField6(ContactFlags,OnIsland, Ghost, SkipsResolution, Valid, NewContact, Active);
+DeclareBitField7(ContactFlags,OnIsland, Ghost, SkipsResolution, Valid, NewContact, Active, Speculative);
 
 ///A constraint specifically for solving a non-penetration constraint.
 ///This should not be created anywhere but in the constraint solver.
@@ -46,6 +46,10 @@ public:
   /// Used currently for z axis contact in 2d.
   bool GetActive() const;
   void SetActive(bool active);
+  /// The colliders aren't touching yet, but will be this step at their current
+  /// velocities. The points have negative penetrations (the gap) and don't send events.
+  bool GetSpeculative() const;
+  void SetSpeculative(bool speculative);
   bool GetIsNew() const;
   bool GetSendsEvents() const;
 
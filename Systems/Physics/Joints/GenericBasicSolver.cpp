@@ -65,12 +65,17 @@ void GenericBasicSolver::AddContacts(ContactList& contacts)
 }
 
 void GenericBasicSolver::Solve(real dt)
+{
+  GenericBasicSolver::SolveWithoutEvents(dt);
+  GenericBasicSolver::BatchEvents();
+}
+
+void GenericBasicSolver::SolveWithoutEvents(real dt)
 {
   GenericBasicSolver::UpdateData();
   GenericBasicSolver::WarmStart();
   GenericBasicSolver::SolveVelocities();
   GenericBasicSolver::Commit();
-  GenericBasicSolver::BatchEvents();
 }
 
 void GenericBasicSolver::DebugDraw(uint debugFlags)
@@ -29,6 +29,7 @@ public:
   void AddContacts(ContactList& contacts) override;
   // Solving functions
   void Solve(real dt) override;
+  void SolveWithoutEvents(real dt) override;
   void DebugDraw(uint debugFlags) override;
   void Clear() override;
   // Iteration functions
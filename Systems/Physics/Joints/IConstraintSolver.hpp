@@ -51,6 +51,9 @@ public:
 
   ///Attempts to satisfy all of the joints for the given frame.
   virtual void Solve(real dt) = 0;
+  ///Same as Solve without sending the joint events. Used when solving
+  ///islands on other threads, BatchEvents is called afterwards on the main thread.
+  virtual void SolveWithoutEvents(real dt) = 0;
   ///Debug draws all joints and contacts.
   virtual void DebugDraw(uint debugFlags) = 0;
   ///Removes all joints.
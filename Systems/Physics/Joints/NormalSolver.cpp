@@ -57,12 +57,17 @@ void NormalSolver::AddContact(Contact* contact)
 
 ///Necessary solving functions
 void NormalSolver::Solve(real dt)
+{
+  NormalSolver::SolveWithoutEvents(dt);
+  NormalSolver::BatchEvents();
+}
+
+void NormalSolver::SolveWithoutEvents(real dt)
 {
   NormalSolver::UpdateData();
   NormalSolver::WarmStart();
   NormalSolver::SolveVelocities();
   NormalSolver::Commit();
-  NormalSolver::BatchEvents();
 }
 
 void NormalSolver::DebugDraw(uint debugFlags)
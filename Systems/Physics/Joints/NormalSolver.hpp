@@ -30,6 +30,7 @@ public:
   void AddContact(Contact* contact) override;
   // Solve Functions
   void Solve(real dt) override;
+  void SolveWithoutEvents(real dt) override;
   void DebugDraw(uint debugFlags) override;
   void Clear() override;
   // Iteration functions
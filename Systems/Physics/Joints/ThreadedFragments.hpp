@@ -15,9 +15,11 @@ namespace Physics
 template <typename JointType>
 struct ConstraintBatch
 {
-  ConstraintBatch() { ConstraintCount = 0; }
+  ConstraintBatch() { ConstraintCount = 0; MoleculeStart = 0; }
   ~ConstraintBatch() { Joints.Clear(); }
   uint ConstraintCount;
+  /// Index of the batch's first molecule in the solver's molecule array
+  uint MoleculeStart;
   typedef InList<JointType,&JointType::SolverLink> JointList;
   JointList Joints;
 
@@ -27,13 +29,17 @@ struct ConstraintBatch
 template <typename JointType>
 struct ConstraintPhase
 {
-  ConstraintPhase() { BatchCount = 0; }
+  ConstraintPhase() { BatchCount = 0; Serial = false; }
   ~ConstraintPhase() { DeleteObjectsIn(Batches); }
   uint BatchCount;
+  /// The batches share bodies and must be solved one after another
+  bool Serial;
 
   typedef ConstraintBatch<JointType> JointBatch;
   typedef InList<JointBatch> JointBatches;
   JointBatches Batches;
+  /// The same batches for indexing from the job workers
+  Array<JointBatch*> BatchArray;
 
   IntrusiveLink(ConstraintPhase<JointType>,link);
 };
@@ -107,80 +113,181 @@ void GroupOperationTwoParamFragment(ConstraintGroup<typename ListType::value_typ
   }
 }
 
+/// The body a constraint writes velocities to (null if it doesn't). Static and
+/// kinematic bodies have no inverse mass so solving never changes them.
+inline RigidBody* GetSolverBody(Collider* collider)
+{
+  if(collider == nullptr)
+    return nullptr;
+
+  RigidBody* body = collider->GetActiveBody();
+  if(body == nullptr || !body->IsDynamic())
+    return nullptr;
+  return body;
+}
+
+/// Colors the constraints so that no two constraints of a phase share a
+/// dynamic body, then splits each phase into batches. The batches of a phase
+/// can be solved on any thread in any order with the same result. Colors
+/// are assigned greedily in list order so the same constraint order always
+/// produces the same phases. Constraints that don't fit in any color go in
+/// a last phase that is solved serially.
 template <typename ListType>
-void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases)
+void ColorConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& group)
 {
   typedef ConstraintPhase<typename ListType::value_type> PhaseType;
   typedef ConstraintBatch<typename ListType::value_type> BatchType;
 
-  HashSet<uint> bodySet;
-  uint batchSize = 32;
-  uint batchesPerPhase = 2;
+  const uint cMaxColors = 64;
+  const uint cBatchSize = 64;
 
-  PhaseType* phase = nullptr;
-  BatchType* batch = nullptr;
-
-  bool newPhaseStarted = false;
+  // Bit i is set if the body is used by a constraint in color i
+  HashMap<RigidBody*, u64> bodyColors;
+  Array<PhaseType*> colors;
+  PhaseType* serialPhase = nullptr;
 
   while(!joints.Empty())
   {
-    if(newPhaseStarted == false)
+    typename ListType::pointer joint = &joints.Front();
+    ListType::Unlink(joint);
+
+    RigidBody* bodyA = GetSolverBody(joint->GetCollider(0));
+    RigidBody* bodyB = GetSolverBody(joint->GetCollider(1));
+    u64 usedColors = 0;
+    if(bodyA)
+      usedColors |= bodyColors.FindValue(bodyA, 0);
+    if(bodyB)
+      usedColors |= bodyColors.FindValue(bodyB, 0);
+
+    uint color = 0;
+    while(color < cMaxColors && (usedColors & ((u64)1 << color)))
+      ++color;
+
+    PhaseType* phase;
+    if(color == cMaxColors)
+    {
+      if(serialPhase == nullptr)
+      {
+        serialPhase = new PhaseType();
+        serialPhase->Serial = true;
+      }
+      phase = serialPhase;
+    }
+    else
+    {
+      u64 colorBit = (u64)1 << color;
+      if(bodyA)
+        bodyColors[bodyA] |= colorBit;
+      if(bodyB)
+        bodyColors[bodyB] |= colorBit;
+
+      // A color is only used once all lower colors exist
+      if(color == colors.Size())
+        colors.PushBack(new PhaseType());
+      phase = colors[color];
+    }
+
+    uint constraintCount = joint->MoleculeCount();
+    BatchType* batch = phase->BatchArray.Empty() ? nullptr : phase->BatchArray.Back();
+    if(batch == nullptr || batch->ConstraintCount + constraintCount > cBatchSize)
     {
-      phase = new PhaseType();
-      phases.Phases.PushBack(phase);
-      ++phases.PhaseCount;
       batch = new BatchType();
       phase->Batches.PushBack(batch);
+      phase->BatchArray.PushBack(batch);
       ++phase->BatchCount;
-      bodySet.Clear();
     }
-    newPhaseStarted = false;
 
-    typename ListType::range range = joints.All();
-    while(!range.Empty())
-    {
-      typename ListType::pointer joint = &(range.Front());
-      range.PopFront();
+    batch->Joints.PushBack(joint);
+    batch->ConstraintCount += constraintCount;
+  }
 
-      //get the id of the two bodies involved in this joint
-      uint idA = joint->GetCollider(0)->mId;
-      uint idB = joint->GetCollider(1)->mId;
+  for(uint i = 0; i < colors.Size(); ++i)
+  {
+    group.Phases.PushBack(colors[i]);
+    ++group.PhaseCount;
+  }
+  if(serialPhase)
+  {
+    group.Phases.PushBack(serialPhase);
+    ++group.PhaseCount;
+  }
+}
 
-      //if either of the bodies have been used in this phase, then skip this joint
-      if(!bodySet.Find(idA).Empty() || !bodySet.Find(idB).Empty())
-        continue;
+/// Computes the molecules of every batch, remembering where each batch's
+/// molecules start so batches can be solved independently.
+template <typename ListType>
+void UpdateDataGroup(ConstraintGroup<typename ListType::value_type>& group, MoleculeWalker& molecules,
+                     ConstraintMolecule* moleculeStart)
+{
+  typedef ConstraintGroup<typename ListType::value_type> JointGroup;
+  typedef ConstraintPhase<typename ListType::value_type> JointPhase;
 
-      //if adding this joint would make the batch too large, make a new batch and add the old to the phase
-      uint ConstraintCount = joint->MoleculeCount();
-      if(ConstraintCount + batch->ConstraintCount > batchSize)
-      {
-        //if this will be too many batches for this phase, then make a new phase
-        if(phase->BatchCount >= batchesPerPhase)
-        {
-          phase = new PhaseType();
-          phases.Phases.PushBack(phase);
-          ++phases.PhaseCount;
-          //since this is a new phase, all bodies are valid again
-          bodySet.Clear();
-          newPhaseStarted = true;
-        }
-
-        batch = new BatchType();
-        phase->Batches.PushBack(batch);
-        ++phase->BatchCount;
-      }
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for(; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    typename JointPhase::JointBatches::range range = phase.Batches.All();
+    for(; !range.Empty(); range.PopFront())
+    {
+      range.Front().MoleculeStart = (uint)(molecules.mMolecules - moleculeStart);
+      UpdateDataFragmentList(range.Front().Joints, molecules);
+    }
+  }
+}
 
-      //mark both of these bodies as being used for this phase
-      bodySet.Insert(idA);
-      bodySet.Insert(idB);
+/// Warm starts or solves a range of the batches of one phase.
+template <typename ListType>
+struct PhaseSolveRange
+{
+  typedef ConstraintPhase<typename ListType::value_type> PhaseType;
 
-      //put the joint in this batch
-      ListType::Unlink(joint);
+  PhaseSolveRange(PhaseType* phase, ConstraintMolecule* molecules, bool warmStart, uint iteration)
+    : mPhase(phase), mMolecules(molecules), mWarmStart(warmStart), mIteration(iteration)
+  {
+  }
 
-      batch->Joints.PushBack(joint);
-      batch->ConstraintCount += ConstraintCount;
+  void operator()(uint start, uint end)
+  {
+    for(uint i = start; i < end; ++i)
+    {
+      ConstraintBatch<typename ListType::value_type>* batch = mPhase->BatchArray[i];
+      MoleculeWalker molecules(mMolecules, sizeof(ConstraintMolecule), 0);
+      molecules += batch->MoleculeStart;
+
+      if(mWarmStart)
+        WarmStartFragmentList(batch->Joints, molecules);
+      else
+        IterateVelocitiesFragmentList(batch->Joints, molecules, mIteration);
     }
   }
+
+  PhaseType* mPhase;
+  ConstraintMolecule* mMolecules;
+  bool mWarmStart;
+  uint mIteration;
+};
+
+/// Solves the phases in order, spreading the batches of each phase across
+/// the job workers.
+template <typename ListType>
+void SolveGroupInParallel(ConstraintGroup<typename ListType::value_type>& group, ConstraintMolecule* molecules,
+                          bool warmStart, uint iteration)
+{
+  typedef ConstraintGroup<typename ListType::value_type> JointGroup;
+  typedef ConstraintPhase<typename ListType::value_type> JointPhase;
+
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for(; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    PhaseSolveRange<ListType> solveRange(&phase, molecules, warmStart, iteration);
+    uint batchCount = phase.BatchArray.Size();
+
+    if(phase.Serial || batchCount < 2 || Z::gJobs == nullptr)
+      solveRange(0, batchCount);
+    else
+      Z::gJobs->ParallelFor(0, batchCount, 1, solveRange);
+  }
 }
 
 template <typename ListType>
@@ -29,15 +29,6 @@ namespace Zero
 namespace Physics
 {
 
-template <typename JointList>
-void ThreadSolveFunction(JointList& joints, MoleculeWalker molecules, uint startIndex)
-{
-  MoleculeWalker mols = molecules;
-  mols += startIndex;
-
-  IterateVelocitiesFragment(joints,mols,0);
-}
-
 ThreadedSolver::ThreadedSolver()
 {
   mConstraintCount = 0;
@@ -91,12 +82,17 @@ void ThreadedSolver::AddContacts(ContactList& contacts)
 }
 
 void ThreadedSolver::Solve(real dt)
+{
+  ThreadedSolver::SolveWithoutEvents(dt);
+  ThreadedSolver::BatchEvents();
+}
+
+void ThreadedSolver::SolveWithoutEvents(real dt)
 {
   ThreadedSolver::UpdateData();
   ThreadedSolver::WarmStart();
   ThreadedSolver::SolveVelocities();
   ThreadedSolver::Commit();
-  ThreadedSolver::BatchEvents();
 }
 
 void ThreadedSolver::DebugDraw(uint debugFlags)
@@ -126,11 +122,11 @@ void ThreadedSolver::UpdateData()
 
   MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
 
-  SplitConstraints(mContacts,mContactPhases);
-  SplitConstraints(mJoints,mJointPhases);
+  ColorConstraints(mContacts,mContactPhases);
+  ColorConstraints(mJoints,mJointPhases);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules,UpdateDataFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules,UpdateDataFragmentList<JointList>);
+  UpdateDataGroup<ContactList>(mContactPhases,molecules,mMolecules.Data());
+  UpdateDataGroup<JointList>(mJointPhases,molecules,mMolecules.Data());
 }
 
 void ThreadedSolver::WarmStart()
@@ -138,14 +134,14 @@ void ThreadedSolver::WarmStart()
   if(mSolverConfig->mWarmStart == false)
     return;
 
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
-
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules, WarmStartFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules, WarmStartFragmentList<JointList>);
+  SolveGroupInParallel<ContactList>(mContactPhases,mMolecules.Data(),true,0);
+  SolveGroupInParallel<JointList>(mJointPhases,mMolecules.Data(),true,0);
 }
 
 void ThreadedSolver::SolveVelocities()
 {
+  ProfileScopeTree("SolveVelocities", "ResolutionPhase", Color::DarkMagenta);
+
   //solve all of the velocity constraints the given number of times
   for(uint i = 0; i < GetSolverIterationCount(); ++i)
     IterateVelocities(i);
@@ -153,10 +149,10 @@ void ThreadedSolver::SolveVelocities()
 
 void ThreadedSolver::IterateVelocities(uint iteration)
 {
-  MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
-
-  GroupOperationTwoParamFragment<ContactList>(mContactPhases,molecules,iteration,IterateVelocitiesFragmentList<ContactList>);
-  GroupOperationTwoParamFragment<JointList>(mJointPhases,molecules,iteration,IterateVelocitiesFragmentList<JointList>);
+  // Every batch of a phase writes to different bodies and molecules,
+  // so the result doesn't depend on how the batches are scheduled
+  SolveGroupInParallel<ContactList>(mContactPhases,mMolecules.Data(),false,iteration);
+  SolveGroupInParallel<JointList>(mJointPhases,mMolecules.Data(),false,iteration);
 }
 
 void ThreadedSolver::SolvePositions()
@@ -13,7 +13,9 @@ namespace Physics
 {
 
 /// A constraint solver designed to thread the constraints
-/// into as many threads as possible.
+/// into as many threads as possible. Contacts and joints are colored
+/// into phases that share no dynamic body, the batches of each phase
+/// are then warm started and solved across the job workers.
 class ThreadedSolver : public IConstraintSolver
 {
 public:
@@ -27,6 +29,7 @@ public:
   void AddContacts(ContactList& contacts) override;
   // Solve Functions
   void Solve(real dt) override;
+  void SolveWithoutEvents(real dt) override;
   void DebugDraw(uint debugFlags) override;
   void Clear() override;
   // Iteration functions
@@ -0,0 +1,432 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+// How many of the most recent blocks a contact point can be placed in. A
+// larger window fills more lanes but makes packing quadratic for big islands.
+const uint cWideContactOpenBlocks = 8;
+
+// Whether the block already writes to the given body
+bool BlockUsesBody(WideContactBlock& block, RigidBody* body)
+{
+  for(uint lane = 0; lane < block.mLaneCount; ++lane)
+  {
+    if((block.mWrite[0][lane] && block.mBodies[0][lane] == body) ||
+       (block.mWrite[1][lane] && block.mBodies[1][lane] == body))
+      return true;
+  }
+  return false;
+}
+
+// Copies one molecule of a contact point into its lane of the row
+void SetWideRow(WideContactRow& row, uint lane, ConstraintMolecule& mol)
+{
+  for(uint i = 0; i < 2; ++i)
+  {
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      row.mLinear[i][axis][lane] = mol.mJacobian.Linear[i][axis];
+      row.mAngular[i][axis][lane] = mol.mJacobian.Angular[i][axis];
+    }
+  }
+  row.mMass[lane] = mol.mMass;
+  row.mBias[lane] = mol.mBias;
+  row.mGamma[lane] = mol.mGamma;
+  row.mImpulse[lane] = mol.mImpulse;
+}
+
+// Simd version of ComputeLambda and ApplyConstraintImpulse for all lanes of one row
+SimInline void SolveWideRow(WideContactRow& row, SimVecParam minImpulse, SimVecParam maxImpulse,
+                            SimVec v[2][3], SimVec w[2][3], SimVec invMass[2][3], SimVec invInertia[2][9])
+{
+  SimVec L[2][3], A[2][3];
+  SimVec cDot = Simd::ZeroOutVec();
+  for(uint i = 0; i < 2; ++i)
+  {
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      L[i][axis] = Simd::UnAlignedLoad(row.mLinear[i][axis]);
+      A[i][axis] = Simd::UnAlignedLoad(row.mAngular[i][axis]);
+      cDot = Simd::MultiplyAdd(L[i][axis], v[i][axis], cDot);
+      cDot = Simd::MultiplyAdd(A[i][axis], w[i][axis], cDot);
+    }
+  }
+
+  SimVec oldImpulse = Simd::UnAlignedLoad(row.mImpulse);
+  cDot = Simd::Add(cDot, Simd::UnAlignedLoad(row.mBias));
+  cDot = Simd::MultiplyAdd(Simd::UnAlignedLoad(row.mGamma), oldImpulse, cDot);
+  SimVec lambda = Simd::Negate(Simd::Multiply(Simd::UnAlignedLoad(row.mMass), cDot));
+
+  //clamp the accumulated impulse and apply only what changed
+  SimVec impulse = Simd::Clamp(Simd::Add(oldImpulse, lambda), minImpulse, maxImpulse);
+  lambda = Simd::Subtract(impulse, oldImpulse);
+  Simd::UnAlignedStore(impulse, row.mImpulse);
+
+  for(uint i = 0; i < 2; ++i)
+  {
+    SimVec angularImpulse[3];
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      v[i][axis] = Simd::MultiplyAdd(Simd::Multiply(invMass[i][axis], L[i][axis]), lambda, v[i][axis]);
+      angularImpulse[axis] = Simd::Multiply(A[i][axis], lambda);
+    }
+
+    for(uint r = 0; r < 3; ++r)
+    {
+      SimVec delta = Simd::Multiply(invInertia[i][r * 3 + 0], angularImpulse[0]);
+      delta = Simd::MultiplyAdd(invInertia[i][r * 3 + 1], angularImpulse[1], delta);
+      delta = Simd::MultiplyAdd(invInertia[i][r * 3 + 2], angularImpulse[2], delta);
+      w[i][r] = Simd::Add(w[i][r], delta);
+    }
+  }
+}
+
+WideContactSolver::WideContactSolver()
+{
+  SetConfiguration(nullptr);
+  mJointConstraintCount = 0;
+  mContactConstraintCount = 0;
+}
+
+WideContactSolver::~WideContactSolver()
+{
+  Clear();
+}
+
+void WideContactSolver::AddJoint(Joint* joint)
+{
+  joint->mSolver = this;
+  joint->UpdateAtomsVirtual();
+  mJointConstraintCount += joint->MoleculeCountVirtual();
+  mJoints.PushBack(joint);
+}
+
+void WideContactSolver::AddContact(Contact* contact)
+{
+  contact->mSolver = this;
+  contact->UpdateAtoms();
+  mContactConstraintCount += contact->MoleculeCount();
+  mContacts.PushBack(contact);
+}
+
+void WideContactSolver::AddJoints(JointList& joints)
+{
+  JointList::range range = joints.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    Joint* joint = &(range.Front());
+    joint->mSolver = this;
+    joint->UpdateAtomsVirtual();
+    mJointConstraintCount += joint->MoleculeCountVirtual();
+  }
+  mJoints.Splice(mJoints.End(),joints.All());
+}
+
+void WideContactSolver::AddContacts(ContactList& contacts)
+{
+  ContactList::range range = contacts.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    Contact* contact = &(range.Front());
+    contact->mSolver = this;
+    contact->UpdateAtoms();
+    mContactConstraintCount += contact->MoleculeCount();
+  }
+  mContacts.Splice(mContacts.End(),contacts.All());
+}
+
+void WideContactSolver::Solve(real dt)
+{
+  WideContactSolver::SolveWithoutEvents(dt);
+  WideContactSolver::BatchEvents();
+}
+
+void WideContactSolver::SolveWithoutEvents(real dt)
+{
+  WideContactSolver::UpdateData();
+  WideContactSolver::WarmStart();
+  WideContactSolver::SolveVelocities();
+  WideContactSolver::Commit();
+}
+
+void WideContactSolver::DebugDraw(uint debugFlags)
+{
+  if(debugFlags & PhysicsSpaceDebugDrawFlags::DrawConstraints)
+    DrawJoints(debugFlags);
+}
+
+void WideContactSolver::Clear()
+{
+  ClearFragmentList(mJoints);
+  ClearFragmentList(mContacts);
+  mBlocks.Clear();
+}
+
+void WideContactSolver::UpdateData()
+{
+  mJointMolecules.Resize(mJointConstraintCount);
+  mContactMolecules.Resize(mContactConstraintCount);
+
+  MoleculeWalker jointMolecules(mJointMolecules.Data(),sizeof(ConstraintMolecule),0);
+  MoleculeWalker contactMolecules(mContactMolecules.Data(),sizeof(ConstraintMolecule),0);
+
+  UpdateDataFragmentList(mJoints,jointMolecules);
+  UpdateDataFragmentList(mContacts,contactMolecules);
+
+  BuildBlocks();
+}
+
+void WideContactSolver::WarmStart()
+{
+  if(mSolverConfig->mWarmStart == false)
+    return;
+
+  MoleculeWalker jointMolecules(mJointMolecules.Data(),sizeof(ConstraintMolecule),0);
+  MoleculeWalker contactMolecules(mContactMolecules.Data(),sizeof(ConstraintMolecule),0);
+
+  WarmStartFragmentList(mJoints,jointMolecules);
+  WarmStartFragmentList(mContacts,contactMolecules);
+}
+
+void WideContactSolver::SolveVelocities()
+{
+  ProfileScopeTree("SolveVelocities", "ResolutionPhase", Color::DarkMagenta);
+
+  //solve all of the velocity constraints the given number of times
+  for(uint i = 0; i < GetSolverIterationCount(); ++i)
+    IterateVelocities(i);
+}
+
+void WideContactSolver::IterateVelocities(uint iteration)
+{
+  MoleculeWalker jointMolecules(mJointMolecules.Data(),sizeof(ConstraintMolecule),0);
+  IterateVelocitiesFragmentList(mJoints,jointMolecules,iteration);
+
+  for(uint i = 0; i < mBlocks.Size(); ++i)
+    SolveBlock(mBlocks[i]);
+}
+
+void WideContactSolver::SolvePositions()
+{
+  //same as the basic solver's block solving, position correction isn't wide
+  JointList jointsToSolve;
+  ContactList contactsToSolve;
+
+  CollectJointsToSolve(mJoints, jointsToSolve);
+  CollectContactsToSolve(mContacts, contactsToSolve, mSolverConfig);
+
+  for(uint iterationCount = 0; iterationCount < GetSolverPositionIterationCount(); ++iterationCount)
+  {
+    BlockSolvePositions(jointsToSolve, EmptyUpdate<Joint>);
+    BlockSolvePositions(contactsToSolve, ContactUpdate);
+  }
+
+  if(!jointsToSolve.Empty())
+    mJoints.Splice(mJoints.End(), jointsToSolve.All());
+  if(!contactsToSolve.Empty())
+    mContacts.Splice(mContacts.End(), contactsToSolve.All());
+}
+
+void WideContactSolver::Commit()
+{
+  StoreImpulses();
+
+  MoleculeWalker jointMolecules(mJointMolecules.Data(),sizeof(ConstraintMolecule),0);
+  MoleculeWalker contactMolecules(mContactMolecules.Data(),sizeof(ConstraintMolecule),0);
+
+  CommitFragmentList(mJoints,jointMolecules);
+  CommitFragmentList(mContacts,contactMolecules);
+}
+
+void WideContactSolver::BatchEvents()
+{
+  BatchEventsFragmentList(mJoints);
+}
+
+void WideContactSolver::DrawJoints(uint debugFlag)
+{
+  DrawJointsFragmentList(mJoints);
+  DrawJointsFragmentList(mContacts);
+}
+
+void WideContactSolver::BuildBlocks()
+{
+  mBlocks.Clear();
+
+  //blocks before this are full
+  uint firstOpen = 0;
+
+  MoleculeWalker molecules(mContactMolecules.Data(),sizeof(ConstraintMolecule),0);
+  ContactList::range range = mContacts.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    Contact* contact = &(range.Front());
+    Collider* collider0 = contact->GetCollider(0);
+    Collider* collider1 = contact->GetCollider(1);
+    RigidBody* body0 = collider0->GetActiveBody();
+    RigidBody* body1 = collider1->GetActiveBody();
+    RigidBody* solverBody0 = GetSolverBody(collider0);
+    RigidBody* solverBody1 = GetSolverBody(collider1);
+
+    JointMass masses;
+    JointHelpers::GetMasses(collider0, collider1, masses);
+    Vec3 invMasses[2] = {masses.mInvMass[0].GetInvMasses(), masses.mInvMass[1].GetInvMasses()};
+    real frictionRatio = contact->mManifold->DynamicFriction / contact->GetContactCount();
+
+    uint contactCount = contact->GetContactCount();
+    for(uint point = 0; point < contactCount; ++point)
+    {
+      //find a block that doesn't write to either body. The points of one
+      //contact share their bodies so they always end up in different blocks.
+      uint blockCount = mBlocks.Size();
+      uint windowStart = 0;
+      if(blockCount > cWideContactOpenBlocks)
+        windowStart = blockCount - cWideContactOpenBlocks;
+
+      uint blockIndex = Math::Max(firstOpen, windowStart);
+      for(; blockIndex < mBlocks.Size(); ++blockIndex)
+      {
+        WideContactBlock& block = mBlocks[blockIndex];
+        if(block.mLaneCount == cWideContactLanes)
+          continue;
+        if(solverBody0 && BlockUsesBody(block, solverBody0))
+          continue;
+        if(solverBody1 && BlockUsesBody(block, solverBody1))
+          continue;
+        break;
+      }
+
+      if(blockIndex == mBlocks.Size())
+      {
+        //unused lanes stay zeroed (no bodies and no mass) so they do nothing
+        WideContactBlock& newBlock = mBlocks.PushBack();
+        memset(&newBlock, 0, sizeof(WideContactBlock));
+      }
+
+      WideContactBlock& block = mBlocks[blockIndex];
+      uint lane = block.mLaneCount++;
+      block.mBodies[0][lane] = body0;
+      block.mBodies[1][lane] = body1;
+      block.mWrite[0][lane] = (solverBody0 != nullptr);
+      block.mWrite[1][lane] = (solverBody1 != nullptr);
+      block.mMolecules[lane] = &molecules[0];
+      block.mFrictionRatio[lane] = frictionRatio;
+
+      for(uint i = 0; i < 2; ++i)
+      {
+        for(uint axis = 0; axis < 3; ++axis)
+          block.mInvMass[i][axis][lane] = invMasses[i][axis];
+        for(uint r = 0; r < 3; ++r)
+        {
+          for(uint c = 0; c < 3; ++c)
+            block.mInvInertia[i][r * 3 + c][lane] = masses.InverseInertia[i](r, c);
+        }
+      }
+
+      for(uint row = 0; row < 3; ++row)
+        SetWideRow(block.mRows[row], lane, molecules[row]);
+
+      while(firstOpen < mBlocks.Size() && mBlocks[firstOpen].mLaneCount == cWideContactLanes)
+        ++firstOpen;
+
+      molecules += 3;
+    }
+  }
+}
+
+void WideContactSolver::SolveBlock(WideContactBlock& block)
+{
+  //gather the lanes' velocities
+  real velocities[2][2][3][cWideContactLanes];
+  for(uint lane = 0; lane < cWideContactLanes; ++lane)
+  {
+    for(uint i = 0; i < 2; ++i)
+    {
+      RigidBody* body = block.mBodies[i][lane];
+      Vec3 linear = Vec3::cZero;
+      Vec3 angular = Vec3::cZero;
+      if(body)
+      {
+        linear = body->mVelocity;
+        angular = body->mAngularVelocity;
+      }
+      for(uint axis = 0; axis < 3; ++axis)
+      {
+        velocities[0][i][axis][lane] = linear[axis];
+        velocities[1][i][axis][lane] = angular[axis];
+      }
+    }
+  }
+
+  SimVec v[2][3], w[2][3], invMass[2][3], invInertia[2][9];
+  for(uint i = 0; i < 2; ++i)
+  {
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      v[i][axis] = Simd::UnAlignedLoad(velocities[0][i][axis]);
+      w[i][axis] = Simd::UnAlignedLoad(velocities[1][i][axis]);
+      invMass[i][axis] = Simd::UnAlignedLoad(block.mInvMass[i][axis]);
+    }
+    for(uint j = 0; j < 9; ++j)
+      invInertia[i][j] = Simd::UnAlignedLoad(block.mInvInertia[i][j]);
+  }
+
+  //normal first, then the friction limits from the new normal impulse
+  SimVec zero = Simd::ZeroOutVec();
+  SolveWideRow(block.mRows[0], zero, Simd::Set(Math::PositiveMax()), v, w, invMass, invInertia);
+
+  SimVec frictionMax = Simd::Multiply(Simd::UnAlignedLoad(block.mFrictionRatio),
+                                      Simd::UnAlignedLoad(block.mRows[0].mImpulse));
+  SimVec frictionMin = Simd::Negate(frictionMax);
+  SolveWideRow(block.mRows[1], frictionMin, frictionMax, v, w, invMass, invInertia);
+  SolveWideRow(block.mRows[2], frictionMin, frictionMax, v, w, invMass, invInertia);
+
+  //scatter the velocities back to the dynamic bodies
+  for(uint i = 0; i < 2; ++i)
+  {
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      Simd::UnAlignedStore(v[i][axis], velocities[0][i][axis]);
+      Simd::UnAlignedStore(w[i][axis], velocities[1][i][axis]);
+    }
+  }
+  for(uint lane = 0; lane < block.mLaneCount; ++lane)
+  {
+    for(uint i = 0; i < 2; ++i)
+    {
+      if(!block.mWrite[i][lane])
+        continue;
+
+      RigidBody* body = block.mBodies[i][lane];
+      body->mVelocity = Vec3(velocities[0][i][0][lane], velocities[0][i][1][lane], velocities[0][i][2][lane]);
+      body->mAngularVelocity = Vec3(velocities[1][i][0][lane], velocities[1][i][1][lane], velocities[1][i][2][lane]);
+    }
+  }
+}
+
+void WideContactSolver::StoreImpulses()
+{
+  for(uint i = 0; i < mBlocks.Size(); ++i)
+  {
+    WideContactBlock& block = mBlocks[i];
+    for(uint lane = 0; lane < block.mLaneCount; ++lane)
+    {
+      ConstraintMolecule* molecules = block.mMolecules[lane];
+      for(uint row = 0; row < 3; ++row)
+        molecules[row].mImpulse = block.mRows[row].mImpulse[lane];
+    }
+  }
+}
+
+}//namespace Physics
+
+}//namespace Zero
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file WideContactSolver.hpp
+/// Declaration of the WideContactSolver, which solves contacts four points at a time.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+/// The number of contact points solved at once by the wide contact solver.
+const uint cWideContactLanes = 4;
+
+/// One constraint row (normal or friction) of each lane, as structure of arrays.
+/// The impulse limits aren't stored, they're the same as ComputeContactLimits.
+struct WideContactRow
+{
+  real mLinear[2][3][cWideContactLanes];
+  real mAngular[2][3][cWideContactLanes];
+  real mMass[cWideContactLanes];
+  real mBias[cWideContactLanes];
+  real mGamma[cWideContactLanes];
+  real mImpulse[cWideContactLanes];
+};
+
+/// Up to four contact points from contacts that share no dynamic body. The
+/// normal and both friction rows of every lane are solved together with
+/// one simd register per component. Unused lanes have no mass and no
+/// bodies so they never produce an impulse.
+struct WideContactBlock
+{
+  /// Bodies whose velocities are read (null if there isn't one)
+  RigidBody* mBodies[2][cWideContactLanes];
+  /// Whether the solved velocities are written back to the body (dynamic bodies only)
+  bool mWrite[2][cWideContactLanes];
+  /// Each lane's normal molecule (followed by its two friction molecules)
+  ConstraintMolecule* mMolecules[cWideContactLanes];
+  uint mLaneCount;
+
+  real mInvMass[2][3][cWideContactLanes];
+  /// Row major inverse world inertia tensors
+  real mInvInertia[2][9][cWideContactLanes];
+  /// Friction limits are this times the normal impulse
+  real mFrictionRatio[cWideContactLanes];
+
+  WideContactRow mRows[3];
+};
+
+/// A contact-only wide solver. Joints are solved like the basic solver, but
+/// contact points are packed four at a time into simd lanes (SSE through
+/// Math::Simd) so the whole register does useful work instead of the one
+/// constraint row at a time done by Contact::SolveSse.
+class WideContactSolver : public IConstraintSolver
+{
+public:
+  WideContactSolver();
+  ~WideContactSolver();
+
+  // IConstraintSolver Interface
+  void AddJoint(Joint* joint) override;
+  void AddContact(Contact* contact) override;
+  void AddJoints(JointList& joints) override;
+  void AddContacts(ContactList& contacts) override;
+  // Solve Functions
+  void Solve(real dt) override;
+  void SolveWithoutEvents(real dt) override;
+  void DebugDraw(uint debugFlags) override;
+  void Clear() override;
+  // Iteration functions
+  void UpdateData() override;
+  void WarmStart() override;
+  void SolveVelocities() override;
+  void IterateVelocities(uint iteration) override;
+  void SolvePositions() override;
+  void Commit() override;
+  void BatchEvents() override;
+
+  void DrawJoints(uint debugFlags);
+
+private:
+  typedef InList<Joint,&Joint::SolverLink> JointList;
+  typedef InList<Contact,&Contact::SolverLink> ContactList;
+  typedef Array<ConstraintMolecule> MoleculeList;
+
+  /// Packs every contact point into blocks of lanes that share no dynamic body
+  void BuildBlocks();
+  void SolveBlock(WideContactBlock& block);
+  /// Copies the solved impulses back to the contact molecules
+  void StoreImpulses();
+
+  JointList mJoints;
+  ContactList mContacts;
+  uint mJointConstraintCount;
+  uint mContactConstraintCount;
+  MoleculeList mJointMolecules;
+  MoleculeList mContactMolecules;
+  Array<WideContactBlock> mBlocks;
+};
+
+}//namespace Physics
+
+}//namespace Zero
@@ -0,0 +1,227 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+// How far the colliders can move/rotate relative to each other (since
+// the last full test) before the pair has to be tested again
+const real cManifoldCacheLinearThreshold = real(0.005);
+const real cManifoldCacheAngularThreshold = real(0.01);
+// A reused point that separates more than this forces a full test
+const real cManifoldCacheBreakingThreshold = real(0.02);
+// Full tests are forced every so often to pick up changes the cache can't
+// see (new points on the edge of the manifold). Material and size changes
+// invalidate the collider's pairs right away.
+const uint cManifoldCacheMaxReuse = 8;
+
+//------------------------------------------------------------------ManifoldCacheResults
+ManifoldCacheResults::ManifoldCacheResults()
+{
+  mHits = 0;
+  mMisses = 0;
+}
+
+//------------------------------------------------------------------ManifoldCache
+ManifoldCache::ManifoldCache()
+{
+  mHits = 0;
+  mMisses = 0;
+  mEnabled = false;
+  mFrame = 1;
+  mFrameHits = 0;
+  mFrameMisses = 0;
+}
+
+bool ManifoldCache::TestCollision(CollisionManager* collisionManager, ColliderPair& pair,
+                                  ManifoldArray& manifolds, ManifoldCacheResults& results)
+{
+  if(!mEnabled)
+    return collisionManager->TestCollision(pair, manifolds);
+
+  //the filtering can change at any time so it's always checked
+  if(!pair.Top->ShouldCollide(pair.Bot))
+    return false;
+
+  //the array can hold the manifolds of other pairs (a whole chunk of the
+  //narrow phase), only what this pair appends is ever removed or cached
+  uint start = manifolds.Size();
+
+  u64 key = GetKey(pair);
+  CachedManifolds* cached = mPairs.FindPointer(key);
+  if(cached != nullptr && cached->mFrame + 1 == mFrame && CanReuse(*cached, pair))
+  {
+    if(Refresh(*cached, manifolds))
+    {
+      cached->mFrame = mFrame;
+      ++cached->mReuseCount;
+      ++results.mHits;
+      return true;
+    }
+    manifolds.Resize(start);
+  }
+
+  ++results.mMisses;
+  if(!collisionManager->ForceTestCollision(pair, manifolds))
+    return false;
+
+  //each pair is only tested once a frame, so updating an existing entry is safe
+  if(cached != nullptr)
+  {
+    Store(*cached, pair, manifolds, start);
+  }
+  else
+  {
+    CachedManifolds& newPair = results.mNewPairs.PushBack();
+    newPair.mKey = key;
+    Store(newPair, pair, manifolds, start);
+  }
+  return true;
+}
+
+void ManifoldCache::Commit(ManifoldCacheResults& results)
+{
+  for(uint i = 0; i < results.mNewPairs.Size(); ++i)
+  {
+    CachedManifolds& newPair = results.mNewPairs[i];
+    mPairs.Insert(newPair.mKey, newPair);
+  }
+
+  mFrameHits += results.mHits;
+  mFrameMisses += results.mMisses;
+}
+
+void ManifoldCache::EndFrame()
+{
+  Array<u64> stalePairs;
+  HashMap<u64, CachedManifolds>::range range = mPairs.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    if(range.Front().second.mFrame != mFrame)
+      stalePairs.PushBack(range.Front().first);
+  }
+
+  for(uint i = 0; i < stalePairs.Size(); ++i)
+    mPairs.Erase(stalePairs[i]);
+
+  mHits = mFrameHits;
+  mMisses = mFrameMisses;
+  mFrameHits = 0;
+  mFrameMisses = 0;
+  ++mFrame;
+}
+
+void ManifoldCache::Clear()
+{
+  mPairs.Clear();
+}
+
+void ManifoldCache::Invalidate(Collider* collider)
+{
+  if(mPairs.Empty())
+    return;
+
+  Array<u64> stalePairs;
+  HashMap<u64, CachedManifolds>::range range = mPairs.All();
+  for(; !range.Empty(); range.PopFront())
+  {
+    u64 key = range.Front().first;
+    if((u32)(key >> 32) == collider->mId || (u32)key == collider->mId)
+      stalePairs.PushBack(key);
+  }
+
+  for(uint i = 0; i < stalePairs.Size(); ++i)
+    mPairs.Erase(stalePairs[i]);
+}
+
+u64 ManifoldCache::GetKey(ColliderPair& pair)
+{
+  //the pair is already sorted by id
+  return ((u64)pair.Top->mId << 32) | (u64)pair.Bot->mId;
+}
+
+void ManifoldCache::GetRelativeTransform(ColliderPair& pair, Vec3Ref translation, Mat3Ref rotation)
+{
+  Mat3 topRotation = pair.Top->GetWorldRotation();
+  Vec3 offset = pair.Bot->GetWorldTranslation() - pair.Top->GetWorldTranslation();
+  translation = Math::TransposedTransform(topRotation, offset);
+  rotation = topRotation.Transposed() * pair.Bot->GetWorldRotation();
+}
+
+bool ManifoldCache::CanReuse(CachedManifolds& cached, ColliderPair& pair)
+{
+  if(cached.mReuseCount >= cManifoldCacheMaxReuse)
+    return false;
+
+  if(cached.mScales[0] != pair.Top->GetWorldScale() || cached.mScales[1] != pair.Bot->GetWorldScale())
+    return false;
+
+  Vec3 translation;
+  Mat3 rotation;
+  GetRelativeTransform(pair, translation, rotation);
+
+  real linearThresholdSq = cManifoldCacheLinearThreshold * cManifoldCacheLinearThreshold;
+  if((translation - cached.mRelativeTranslation).LengthSq() > linearThresholdSq)
+    return false;
+
+  //the angle of the rotation between the old and new relative rotations
+  real cosAngle = (Math::Trace(cached.mRelativeRotation.Transposed() * rotation) - real(1.0)) * real(0.5);
+  return cosAngle >= Math::Cos(cManifoldCacheAngularThreshold);
+}
+
+bool ManifoldCache::Refresh(CachedManifolds& cached, ManifoldArray& manifolds)
+{
+  for(uint i = 0; i < cached.mManifolds.Size(); ++i)
+  {
+    Manifold& manifold = manifolds.PushBack();
+    manifold = cached.mManifolds[i];
+
+    Mat3 rotation = manifold.Objects[0]->GetWorldRotation();
+    for(uint j = 0; j < manifold.ContactCount; ++j)
+    {
+      ManifoldPoint& point = manifold.Contacts[j];
+      point.WorldPoints[0] = JointHelpers::BodyRToWorldPoint(manifold.Objects[0], point.BodyPoints[0]);
+      point.WorldPoints[1] = JointHelpers::BodyRToWorldPoint(manifold.Objects[1], point.BodyPoints[1]);
+      point.Normal = Math::Transform(rotation, point.Normal);
+      point.Penetration = Math::Dot(point.WorldPoints[0] - point.WorldPoints[1], point.Normal);
+
+      if(point.Penetration < -cManifoldCacheBreakingThreshold)
+        return false;
+    }
+  }
+  return true;
+}
+
+void ManifoldCache::Store(CachedManifolds& cached, ColliderPair& pair, ManifoldArray& manifolds, uint start)
+{
+  GetRelativeTransform(pair, cached.mRelativeTranslation, cached.mRelativeRotation);
+  cached.mScales[0] = pair.Top->GetWorldScale();
+  cached.mScales[1] = pair.Bot->GetWorldScale();
+  cached.mFrame = mFrame;
+  cached.mReuseCount = 0;
+
+  cached.mManifolds.Assign(manifolds.SubRange(start, manifolds.Size() - start));
+  for(uint i = 0; i < cached.mManifolds.Size(); ++i)
+  {
+    Manifold& manifold = cached.mManifolds[i];
+    Mat3 rotation = manifold.Objects[0]->GetWorldRotation();
+    for(uint j = 0; j < manifold.ContactCount; ++j)
+    {
+      ManifoldPoint& point = manifold.Contacts[j];
+      point.BodyPoints[0] = JointHelpers::WorldPointToBodyR(manifold.Objects[0], point.WorldPoints[0]);
+      point.BodyPoints[1] = JointHelpers::WorldPointToBodyR(manifold.Objects[1], point.WorldPoints[1]);
+      point.Normal = Math::TransposedTransform(rotation, point.Normal);
+    }
+  }
+}
+
+}//namespace Physics
+
+}//namespace Zero
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+/// The last full collision test of a touching pair.
+struct CachedManifolds
+{
+  u64 mKey;
+  /// The relative transform (Bot in Top's space) when the pair was tested
+  Vec3 mRelativeTranslation;
+  Mat3 mRelativeRotation;
+  Vec3 mScales[2];
+  /// Body points are in each collider's space and normals
+  /// are in the space of the manifold's first collider.
+  ManifoldArray mManifolds;
+  /// The last frame this pair was touching
+  uint mFrame;
+  /// How many frames in a row the manifolds have been reused
+  uint mReuseCount;
+};
+
+/// Pairs tested by one thread, added to the cache with ManifoldCache::Commit.
+struct ManifoldCacheResults
+{
+  ManifoldCacheResults();
+
+  Array<CachedManifolds> mNewPairs;
+  uint mHits;
+  uint mMisses;
+};
+
+/// Keeps the manifolds of touching pairs from one frame to the next. If the
+/// two colliders have barely moved relative to each other since the pair was
+/// last tested, the old contact points are moved with the colliders instead
+/// of running the full collision test again (mostly a win for resting stacks).
+/// Pairs are keyed by collider id so a destroyed collider never matches a new one.
+class ManifoldCache
+{
+public:
+  ManifoldCache();
+
+  /// Same as CollisionManager::TestCollision, but may return the cached manifolds.
+  /// The pair's manifolds are appended, anything already in the array is kept.
+  /// Different pairs can be tested from different threads, each thread with its
+  /// own results, as long as nothing is committed while testing.
+  bool TestCollision(CollisionManager* collisionManager, ColliderPair& pair,
+                     ManifoldArray& manifolds, ManifoldCacheResults& results);
+  /// Adds the newly touching pairs and the hit counts.
+  void Commit(ManifoldCacheResults& results);
+  /// Removes the pairs that weren't touching this frame and starts the next one.
+  void EndFrame();
+  /// Removes the collider's pairs so they get a full test next frame. Material
+  /// and shape changes can't be seen in the relative transform. Not safe while testing.
+  void Invalidate(Collider* collider);
+  void Clear();
+
+  /// How many pairs were reused/tested last frame.
+  uint mHits;
+  uint mMisses;
+  bool mEnabled;
+
+private:
+  static u64 GetKey(ColliderPair& pair);
+  static void GetRelativeTransform(ColliderPair& pair, Vec3Ref translation, Mat3Ref rotation);
+  bool CanReuse(CachedManifolds& cached, ColliderPair& pair);
+  /// Moves the cached points with the colliders. Returns false if a point separated.
+  bool Refresh(CachedManifolds& cached, ManifoldArray& manifolds);
+  /// Caches the manifolds appended after start.
+  void Store(CachedManifolds& cached, ColliderPair& pair, ManifoldArray& manifolds, uint start);
+
+  HashMap<u64, CachedManifolds> mPairs;
+  uint mFrame;
+  /// Counts for the frame in progress
+  uint mFrameHits;
+  uint mFrameMisses;
+};
+
+}//namespace Physics
+
+}//namespace Zero
@@ -0,0 +1,663 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+const uint cMeshBvhBinCount = 16;
+const uint cMeshBvhMaxLeafSize = 4;
+// Cost of visiting a node relative to testing one primitive
+const real cMeshBvhTraversalCost = real(1.0);
+// Past this depth nodes are split at the median so the
+// depth (and the traversal stacks) stay bounded
+const uint cMeshBvhMedianSplitDepth = 64;
+const uint cMeshBvhQuantizedMax = 0xffff;
+
+//-------------------------------------------------------------------MeshBvhRay
+MeshBvhRay::MeshBvhRay(const Ray& ray)
+{
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    mStart[axis] = ray.Start[axis];
+    // Avoid infinities (and 0 * inf) for axis aligned rays
+    real direction = ray.Direction[axis];
+    if(Math::Abs(direction) > Math::Epsilon())
+      mInvDirection[axis] = real(1.0) / direction;
+    else
+      mInvDirection[axis] = direction < 0 ? -Math::PositiveMax() : Math::PositiveMax();
+  }
+}
+
+bool MeshBvhRay::Test(const real min[3], const real max[3], real maxDistance, real& distance) const
+{
+  real tMin = real(0.0);
+  real tMax = maxDistance;
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    real t0 = (min[axis] - mStart[axis]) * mInvDirection[axis];
+    real t1 = (max[axis] - mStart[axis]) * mInvDirection[axis];
+    if(t0 > t1)
+      Math::Swap(t0, t1);
+    tMin = Math::Max(tMin, t0);
+    tMax = Math::Min(tMax, t1);
+  }
+
+  distance = tMin;
+  return tMin <= tMax;
+}
+
+//-------------------------------------------------------------------MeshBvh Build Helpers
+struct MeshBvhBin
+{
+  MeshBvhBin()
+  {
+    mAabb.SetInvalid();
+    mCount = 0;
+  }
+
+  Aabb mAabb;
+  uint mCount;
+};
+
+struct MeshBvhBuildEntry
+{
+  uint mStart;
+  uint mEnd;
+  /// The node whose second child this is (invalid for first children)
+  uint mParent;
+  uint mDepth;
+};
+
+struct MeshBvhCentroidSorter
+{
+  MeshBvhCentroidSorter(const Array<Vec3>& centroids, uint axis)
+    : mCentroids(&centroids), mAxis(axis)
+  {
+  }
+
+  bool operator()(uint lhs, uint rhs) const
+  {
+    return (*mCentroids)[lhs][mAxis] < (*mCentroids)[rhs][mAxis];
+  }
+
+  const Array<Vec3>* mCentroids;
+  uint mAxis;
+};
+
+uint GetMeshBvhBin(real value, real min, real scale)
+{
+  int bin = (int)((value - min) * scale);
+  return (uint)Math::Clamp(bin, 0, (int)cMeshBvhBinCount - 1);
+}
+
+void SetNodeBounds(MeshBvhNode& node, const Aabb& aabb)
+{
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    node.mMin[axis] = aabb.mMin[axis];
+    node.mMax[axis] = aabb.mMax[axis];
+  }
+}
+
+//-------------------------------------------------------------------MeshBvh
+MeshBvh::MeshBvh()
+{
+  mLayout = MeshBvhLayout::Standard;
+  mQuantizeOrigin = Vec3::cZero;
+  mQuantizeScale = Vec3(1, 1, 1);
+}
+
+void MeshBvh::Build(const Array<Aabb>& primitiveAabbs, MeshBvhLayout::Enum layout)
+{
+  Clear();
+  mLayout = layout;
+  if(primitiveAabbs.Empty())
+    return;
+
+  BuildBinary(primitiveAabbs);
+
+  if(layout == MeshBvhLayout::Quantized)
+    Quantize();
+  else if(layout == MeshBvhLayout::Wide)
+    Collapse();
+}
+
+void MeshBvh::Clear()
+{
+  mNodes.Deallocate();
+  mQuantizedNodes.Deallocate();
+  mWideNodes.Deallocate();
+  mPrimitives.Deallocate();
+}
+
+void MeshBvh::BuildBinary(const Array<Aabb>& primitiveAabbs)
+{
+  uint primitiveCount = primitiveAabbs.Size();
+  mPrimitives.Resize(primitiveCount);
+  Array<Vec3> centroids;
+  centroids.Resize(primitiveCount);
+  for(uint i = 0; i < primitiveCount; ++i)
+  {
+    mPrimitives[i] = i;
+    centroids[i] = primitiveAabbs[i].GetCenter();
+  }
+
+  // Every split makes one leaf more, so the node count is known up front
+  mNodes.Reserve(2 * primitiveCount - 1);
+
+  // Nodes are created in the order they're popped. The first child is pushed
+  // last so it's always created right after its parent (depth first order).
+  Array<MeshBvhBuildEntry> stack;
+  MeshBvhBuildEntry rootEntry = {0, primitiveCount, cInvalidIndex, 0};
+  stack.PushBack(rootEntry);
+
+  while(!stack.Empty())
+  {
+    MeshBvhBuildEntry entry = stack.Back();
+    stack.PopBack();
+
+    uint nodeIndex = mNodes.Size();
+    if(entry.mParent != cInvalidIndex)
+      mNodes[entry.mParent].mIndex = nodeIndex;
+
+    uint start = entry.mStart;
+    uint end = entry.mEnd;
+    uint count = end - start;
+
+    Aabb nodeAabb;
+    Aabb centroidAabb;
+    nodeAabb.SetInvalid();
+    centroidAabb.SetInvalid();
+    for(uint i = start; i < end; ++i)
+    {
+      uint primitive = mPrimitives[i];
+      nodeAabb.Combine(primitiveAabbs[primitive]);
+      centroidAabb.Expand(centroids[primitive]);
+    }
+
+    MeshBvhNode& node = mNodes.PushBack();
+    SetNodeBounds(node, nodeAabb);
+    node.mIndex = start;
+    node.mCount = count;
+    if(count == 1)
+      continue;
+
+    // Find the best binned split plane on all axes
+    Vec3 centroidExtents = centroidAabb.GetExtents();
+    real bestCost = Math::PositiveMax();
+    uint bestAxis = 0;
+    uint bestPlane = cInvalidIndex;
+    real nodeArea = Math::Max(nodeAabb.GetSurfaceArea(), Math::Epsilon());
+    for(uint axis = 0; axis < 3 && entry.mDepth < cMeshBvhMedianSplitDepth; ++axis)
+    {
+      if(centroidExtents[axis] <= Math::Epsilon())
+        continue;
+
+      real axisMin = centroidAabb.mMin[axis];
+      real scale = real(cMeshBvhBinCount) / centroidExtents[axis];
+      MeshBvhBin bins[cMeshBvhBinCount];
+      for(uint i = start; i < end; ++i)
+      {
+        uint primitive = mPrimitives[i];
+        MeshBvhBin& bin = bins[GetMeshBvhBin(centroids[primitive][axis], axisMin, scale)];
+        bin.mAabb.Combine(primitiveAabbs[primitive]);
+        ++bin.mCount;
+      }
+
+      // Sweep from the left to get everything left of each plane
+      real leftAreas[cMeshBvhBinCount - 1];
+      uint leftCounts[cMeshBvhBinCount - 1];
+      Aabb leftAabb;
+      leftAabb.SetInvalid();
+      uint leftCount = 0;
+      for(uint plane = 0; plane < cMeshBvhBinCount - 1; ++plane)
+      {
+        leftCount += bins[plane].mCount;
+        if(bins[plane].mCount != 0)
+          leftAabb.Combine(bins[plane].mAabb);
+        leftCounts[plane] = leftCount;
+        leftAreas[plane] = leftCount != 0 ? leftAabb.GetSurfaceArea() : real(0.0);
+      }
+
+      // Then from the right to evaluate the cost of each plane
+      Aabb rightAabb;
+      rightAabb.SetInvalid();
+      uint rightCount = 0;
+      for(uint plane = cMeshBvhBinCount - 1; plane > 0; --plane)
+      {
+        rightCount += bins[plane].mCount;
+        if(bins[plane].mCount != 0)
+          rightAabb.Combine(bins[plane].mAabb);
+
+        uint left = leftCounts[plane - 1];
+        if(left == 0 || rightCount == 0)
+          continue;
+
+        real cost = leftAreas[plane - 1] * left + rightAabb.GetSurfaceArea() * rightCount;
+        cost = cMeshBvhTraversalCost + cost / nodeArea;
+        if(cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestPlane = plane - 1;
+        }
+      }
+    }
+
+    // Splitting isn't worth it
+    if(count <= cMeshBvhMaxLeafSize && (bestPlane == cInvalidIndex || bestCost >= real(count)))
+      continue;
+
+    uint mid = start;
+    if(bestPlane != cInvalidIndex)
+    {
+      real axisMin = centroidAabb.mMin[bestAxis];
+      real scale = real(cMeshBvhBinCount) / centroidExtents[bestAxis];
+      uint last = end;
+      while(mid < last)
+      {
+        real value = centroids[mPrimitives[mid]][bestAxis];
+        if(GetMeshBvhBin(value, axisMin, scale) <= bestPlane)
+          ++mid;
+        else
+          Math::Swap(mPrimitives[mid], mPrimitives[--last]);
+      }
+    }
+
+    // Too deep or no usable plane (all centroids in one spot), split at the median
+    if(mid == start || mid == end)
+    {
+      uint axis = 0;
+      if(centroidExtents[1] > centroidExtents[axis])
+        axis = 1;
+      if(centroidExtents[2] > centroidExtents[axis])
+        axis = 2;
+      Sort(mPrimitives.SubRange(start, count), MeshBvhCentroidSorter(centroids, axis));
+      mid = start + count / 2;
+    }
+
+    mNodes[nodeIndex].mCount = 0;
+    MeshBvhBuildEntry second = {mid, end, nodeIndex, entry.mDepth + 1};
+    MeshBvhBuildEntry first = {start, mid, cInvalidIndex, entry.mDepth + 1};
+    stack.PushBack(second);
+    stack.PushBack(first);
+  }
+}
+
+void MeshBvh::Quantize()
+{
+  Vec3 min(mNodes[0].mMin[0], mNodes[0].mMin[1], mNodes[0].mMin[2]);
+  Vec3 max(mNodes[0].mMax[0], mNodes[0].mMax[1], mNodes[0].mMax[2]);
+  mQuantizeOrigin = min;
+  // One step less than the range so the max of the tree is always covered
+  Vec3 extents = max - min;
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    if(extents[axis] > 0)
+      mQuantizeScale[axis] = extents[axis] / real(cMeshBvhQuantizedMax - 1);
+    else
+      mQuantizeScale[axis] = real(1.0);
+  }
+
+  // Round outwards so the quantized bounds always contain the real ones
+  mQuantizedNodes.Resize(mNodes.Size());
+  for(uint i = 0; i < mNodes.Size(); ++i)
+  {
+    MeshBvhNode& node = mNodes[i];
+    MeshBvhQuantizedNode& quantized = mQuantizedNodes[i];
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      real qMin = Math::Floor((node.mMin[axis] - mQuantizeOrigin[axis]) / mQuantizeScale[axis]);
+      real qMax = Math::Ceil((node.mMax[axis] - mQuantizeOrigin[axis]) / mQuantizeScale[axis]);
+      quantized.mMin[axis] = (u16)Math::Clamp((int)qMin - 1, 0, (int)cMeshBvhQuantizedMax);
+      quantized.mMax[axis] = (u16)Math::Clamp((int)qMax + 1, 0, (int)cMeshBvhQuantizedMax);
+    }
+    ErrorIf(node.mCount >= (1u << cMeshBvhCountBits), "Leaf is too big to be quantized.");
+    quantized.mIndexAndCount = (node.mIndex << cMeshBvhCountBits) | node.mCount;
+  }
+
+  mNodes.Deallocate();
+}
+
+void MeshBvh::Collapse()
+{
+  struct CollapseEntry
+  {
+    uint mNode;
+    uint mParent;
+    uint mSlot;
+  };
+
+  Array<CollapseEntry> stack;
+  CollapseEntry rootEntry = {0, cInvalidIndex, 0};
+  stack.PushBack(rootEntry);
+
+  while(!stack.Empty())
+  {
+    CollapseEntry entry = stack.Back();
+    stack.PopBack();
+
+    uint wideIndex = mWideNodes.Size();
+    if(entry.mParent != cInvalidIndex)
+      mWideNodes[entry.mParent].mIndex[entry.mSlot] = wideIndex;
+
+    // Open the largest internal children until there are 4 of them
+    uint children[4];
+    uint childCount = 0;
+    MeshBvhNode& binaryNode = mNodes[entry.mNode];
+    if(binaryNode.mCount != 0)
+    {
+      // Only the root can be a leaf
+      children[childCount++] = entry.mNode;
+    }
+    else
+    {
+      children[childCount++] = entry.mNode + 1;
+      children[childCount++] = binaryNode.mIndex;
+    }
+
+    while(childCount < 4)
+    {
+      uint largest = cInvalidIndex;
+      real largestArea = -Math::PositiveMax();
+      for(uint i = 0; i < childCount; ++i)
+      {
+        MeshBvhNode& child = mNodes[children[i]];
+        if(child.mCount != 0)
+          continue;
+
+        Aabb aabb;
+        GetNodeAabb(children[i], aabb);
+        real area = aabb.GetSurfaceArea();
+        if(area > largestArea)
+        {
+          largestArea = area;
+          largest = i;
+        }
+      }
+
+      if(largest == cInvalidIndex)
+        break;
+
+      uint opened = children[largest];
+      children[largest] = opened + 1;
+      children[childCount++] = mNodes[opened].mIndex;
+    }
+
+    MeshBvhWideNode& wideNode = mWideNodes.PushBack();
+    for(uint slot = 0; slot < 4; ++slot)
+    {
+      wideNode.mMinX[slot] = wideNode.mMinY[slot] = wideNode.mMinZ[slot] = Math::PositiveMax();
+      wideNode.mMaxX[slot] = wideNode.mMaxY[slot] = wideNode.mMaxZ[slot] = -Math::PositiveMax();
+      wideNode.mIndex[slot] = cInvalidIndex;
+      wideNode.mCount[slot] = 0;
+    }
+
+    // Push in reverse so the first slot is created next
+    for(uint slot = childCount; slot > 0; --slot)
+    {
+      uint i = slot - 1;
+      MeshBvhNode& child = mNodes[children[i]];
+      wideNode.mMinX[i] = child.mMin[0];
+      wideNode.mMinY[i] = child.mMin[1];
+      wideNode.mMinZ[i] = child.mMin[2];
+      wideNode.mMaxX[i] = child.mMax[0];
+      wideNode.mMaxY[i] = child.mMax[1];
+      wideNode.mMaxZ[i] = child.mMax[2];
+      wideNode.mCount[i] = child.mCount;
+
+      if(child.mCount != 0)
+      {
+        wideNode.mIndex[i] = child.mIndex;
+      }
+      else
+      {
+        CollapseEntry childEntry = {children[i], wideIndex, i};
+        stack.PushBack(childEntry);
+      }
+    }
+  }
+
+  mNodes.Deallocate();
+}
+
+void MeshBvh::GetNodeAabb(uint nodeIndex, Aabb& aabb) const
+{
+  real min[3], max[3];
+  GetBounds(nodeIndex, min, max);
+  aabb.SetMinAndMax(Vec3(min[0], min[1], min[2]), Vec3(max[0], max[1], max[2]));
+}
+
+void MeshBvh::GetBounds(uint nodeIndex, real min[3], real max[3]) const
+{
+  if(mLayout == MeshBvhLayout::Quantized)
+  {
+    const MeshBvhQuantizedNode& node = mQuantizedNodes[nodeIndex];
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      min[axis] = mQuantizeOrigin[axis] + real(node.mMin[axis]) * mQuantizeScale[axis];
+      max[axis] = mQuantizeOrigin[axis] + real(node.mMax[axis]) * mQuantizeScale[axis];
+    }
+    return;
+  }
+
+  const MeshBvhNode& node = mNodes[nodeIndex];
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    min[axis] = node.mMin[axis];
+    max[axis] = node.mMax[axis];
+  }
+}
+
+void MeshBvh::GetLink(uint nodeIndex, uint& index, uint& count) const
+{
+  if(mLayout == MeshBvhLayout::Quantized)
+  {
+    uint indexAndCount = mQuantizedNodes[nodeIndex].mIndexAndCount;
+    index = indexAndCount >> cMeshBvhCountBits;
+    count = indexAndCount & ((1 << cMeshBvhCountBits) - 1);
+    return;
+  }
+
+  index = mNodes[nodeIndex].mIndex;
+  count = mNodes[nodeIndex].mCount;
+}
+
+void MeshBvh::Query(const Aabb& aabb, Array<uint>& primitives) const
+{
+  if(mPrimitives.Empty())
+    return;
+
+  if(mLayout == MeshBvhLayout::Standard)
+    QueryStandard(aabb, primitives);
+  else if(mLayout == MeshBvhLayout::Quantized)
+    QueryQuantized(aabb, primitives);
+  else
+    QueryWide(aabb, primitives);
+}
+
+void MeshBvh::QueryStandard(const Aabb& aabb, Array<uint>& primitives) const
+{
+  uint stack[cMeshBvhMaxDepth + 1];
+  uint stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while(stackSize != 0)
+  {
+    uint nodeIndex = stack[--stackSize];
+    const MeshBvhNode& node = mNodes[nodeIndex];
+    if(node.mMin[0] > aabb.mMax.x || node.mMax[0] < aabb.mMin.x ||
+       node.mMin[1] > aabb.mMax.y || node.mMax[1] < aabb.mMin.y ||
+       node.mMin[2] > aabb.mMax.z || node.mMax[2] < aabb.mMin.z)
+      continue;
+
+    if(node.mCount != 0)
+    {
+      for(uint i = 0; i < node.mCount; ++i)
+        primitives.PushBack(mPrimitives[node.mIndex + i]);
+      continue;
+    }
+
+    stack[stackSize++] = node.mIndex;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+}
+
+void MeshBvh::QueryQuantized(const Aabb& aabb, Array<uint>& primitives) const
+{
+  // Quantize the query (rounded outwards) so the nodes are tested as integers
+  int qMin[3], qMax[3];
+  for(uint axis = 0; axis < 3; ++axis)
+  {
+    real min = (aabb.mMin[axis] - mQuantizeOrigin[axis]) / mQuantizeScale[axis];
+    real max = (aabb.mMax[axis] - mQuantizeOrigin[axis]) / mQuantizeScale[axis];
+    // Entirely outside of the tree
+    if(max < real(0.0) || min > real(cMeshBvhQuantizedMax))
+      return;
+    qMin[axis] = Math::Clamp((int)Math::Floor(min), 0, (int)cMeshBvhQuantizedMax);
+    qMax[axis] = Math::Clamp((int)Math::Ceil(max), 0, (int)cMeshBvhQuantizedMax);
+  }
+
+  uint stack[cMeshBvhMaxDepth + 1];
+  uint stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while(stackSize != 0)
+  {
+    uint nodeIndex = stack[--stackSize];
+    const MeshBvhQuantizedNode& node = mQuantizedNodes[nodeIndex];
+    if(node.mMin[0] > qMax[0] || node.mMax[0] < qMin[0] ||
+       node.mMin[1] > qMax[1] || node.mMax[1] < qMin[1] ||
+       node.mMin[2] > qMax[2] || node.mMax[2] < qMin[2])
+      continue;
+
+    uint index, count;
+    GetLink(nodeIndex, index, count);
+    if(count != 0)
+    {
+      for(uint i = 0; i < count; ++i)
+        primitives.PushBack(mPrimitives[index + i]);
+      continue;
+    }
+
+    stack[stackSize++] = index;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+}
+
+void MeshBvh::QueryWide(const Aabb& aabb, Array<uint>& primitives) const
+{
+  using namespace Math::Simd;
+
+  SimVec queryMinX = Set(aabb.mMin.x);
+  SimVec queryMinY = Set(aabb.mMin.y);
+  SimVec queryMinZ = Set(aabb.mMin.z);
+  SimVec queryMaxX = Set(aabb.mMax.x);
+  SimVec queryMaxY = Set(aabb.mMax.y);
+  SimVec queryMaxZ = Set(aabb.mMax.z);
+  SimVec one = Set(real(1.0));
+
+  uint stack[cMeshBvhMaxDepth * 3 + 4];
+  uint stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while(stackSize != 0)
+  {
+    const MeshBvhWideNode& node = mWideNodes[stack[--stackSize]];
+
+    // Overlap all 4 children at once
+    SimVec overlap = AndVec(LessEqual(UnAlignedLoad(node.mMinX), queryMaxX),
+                            GreaterEqual(UnAlignedLoad(node.mMaxX), queryMinX));
+    overlap = AndVec(overlap, AndVec(LessEqual(UnAlignedLoad(node.mMinY), queryMaxY),
+                                     GreaterEqual(UnAlignedLoad(node.mMaxY), queryMinY)));
+    overlap = AndVec(overlap, AndVec(LessEqual(UnAlignedLoad(node.mMinZ), queryMaxZ),
+                                     GreaterEqual(UnAlignedLoad(node.mMaxZ), queryMinZ)));
+
+    real overlaps[4];
+    UnAlignedStore(AndVec(overlap, one), overlaps);
+
+    for(uint i = 0; i < 4; ++i)
+    {
+      if(overlaps[i] == real(0.0) || node.mIndex[i] == cInvalidIndex)
+        continue;
+
+      uint count = node.mCount[i];
+      if(count != 0)
+      {
+        for(uint j = 0; j < count; ++j)
+          primitives.PushBack(mPrimitives[node.mIndex[i] + j]);
+      }
+      else
+      {
+        stack[stackSize++] = node.mIndex[i];
+      }
+    }
+  }
+}
+
+uint MeshBvh::GetMemoryUsage() const
+{
+  return mNodes.Size() * sizeof(MeshBvhNode) +
+         mQuantizedNodes.Size() * sizeof(MeshBvhQuantizedNode) +
+         mWideNodes.Size() * sizeof(MeshBvhWideNode) +
+         mPrimitives.Size() * sizeof(uint);
+}
+
+void MeshBvh::Draw(uint depth) const
+{
+  if(mPrimitives.Empty())
+    return;
+
+  Array<Pair<uint, uint> > stack;
+  stack.PushBack(Pair<uint, uint>(0, 0));
+  while(!stack.Empty())
+  {
+    Pair<uint, uint> entry = stack.Back();
+    stack.PopBack();
+
+    if(mLayout == MeshBvhLayout::Wide)
+    {
+      const MeshBvhWideNode& node = mWideNodes[entry.first];
+      for(uint i = 0; i < 4; ++i)
+      {
+        if(node.mIndex[i] == cInvalidIndex)
+          continue;
+
+        if(entry.second == depth)
+        {
+          Aabb aabb;
+          aabb.SetMinAndMax(Vec3(node.mMinX[i], node.mMinY[i], node.mMinZ[i]),
+                            Vec3(node.mMaxX[i], node.mMaxY[i], node.mMaxZ[i]));
+          gDebugDraw->Add(Debug::Obb(aabb).Color(Color::MintCream));
+        }
+        else if(node.mCount[i] == 0)
+        {
+          stack.PushBack(Pair<uint, uint>(node.mIndex[i], entry.second + 1));
+        }
+      }
+      continue;
+    }
+
+    if(entry.second == depth)
+    {
+      Aabb aabb;
+      GetNodeAabb(entry.first, aabb);
+      gDebugDraw->Add(Debug::Obb(aabb).Color(Color::MintCream));
+      continue;
+    }
+
+    uint index, count;
+    GetLink(entry.first, index, count);
+    if(count == 0)
+    {
+      stack.PushBack(Pair<uint, uint>(index, entry.second + 1));
+      stack.PushBack(Pair<uint, uint>(entry.first + 1, entry.second + 1));
+    }
+  }
+}
+
+}//namespace Zero
@@ -0,0 +1,318 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+/// How the nodes of a MeshBvh are stored. Standard nodes are 32 bytes with
+/// float bounds. Quantized nodes store the bounds as 16 bit offsets in the
+/// tree's bounds (16 bytes, half the memory for large meshes). Wide nodes
+/// store 4 children in structure of array form so one node's children are
+/// tested against a ray or aabb with simd.
+DeclareEnum3(MeshBvhLayout, Standard, Quantized, Wide);
+
+/// A binary node. The first child always directly follows its parent.
+struct MeshBvhNode
+{
+  real mMin[3];
+  /// Leaf: the first primitive in MeshBvh::mPrimitives.
+  /// Internal: the index of the second child.
+  uint mIndex;
+  real mMax[3];
+  /// The primitive count, 0 for internal nodes.
+  uint mCount;
+};
+
+/// A binary node with the bounds quantized to the tree's bounds.
+struct MeshBvhQuantizedNode
+{
+  u16 mMin[3];
+  u16 mMax[3];
+  /// The index (see MeshBvhNode::mIndex) shifted up with the
+  /// primitive count in the lowest cMeshBvhCountBits.
+  uint mIndexAndCount;
+};
+
+/// Up to 4 children of a node (the binary tree collapsed). Unused
+/// slots have an invalid index and inverted bounds so they never hit.
+struct MeshBvhWideNode
+{
+  real mMinX[4];
+  real mMinY[4];
+  real mMinZ[4];
+  real mMaxX[4];
+  real mMaxY[4];
+  real mMaxZ[4];
+  /// Leaf: the first primitive. Internal: the index of the child wide node.
+  uint mIndex[4];
+  /// The primitive count, 0 for internal children.
+  uint mCount[4];
+};
+
+/// A ray prepared for the slab tests.
+struct MeshBvhRay
+{
+  MeshBvhRay(const Ray& ray);
+
+  /// The entry distance of the ray into the bounds if it hits
+  /// them before maxDistance.
+  bool Test(const real min[3], const real max[3], real maxDistance, real& distance) const;
+
+  real mStart[3];
+  real mInvDirection[3];
+};
+
+//-------------------------------------------------------------------MeshBvh
+/// Bounding volume hierarchy over the primitives (triangles) of a static mesh.
+/// The tree is built top down with binned surface area heuristic splits and
+/// flattened into one array in depth first order, so queries walk contiguous
+/// memory instead of chasing node pointers.
+class MeshBvh
+{
+public:
+  static const uint cInvalidIndex = (uint)-1;
+
+  MeshBvh();
+
+  /// Builds the tree over the given primitive bounds (indexed by primitive).
+  void Build(const Array<Aabb>& primitiveAabbs, MeshBvhLayout::Enum layout);
+  void Clear();
+
+  /// Fills out all primitives whose bounds overlap the aabb.
+  void Query(const Aabb& aabb, Array<uint>& primitives) const;
+
+  /// Visits the primitives whose bounds the ray hits, nearest nodes first.
+  /// The callback is called as "bool callback(uint primitive, real& maxDistance)",
+  /// it returns if the primitive was hit and shrinks maxDistance to the hit
+  /// so that farther nodes are skipped. Returns if any primitive was hit.
+  template <typename RayCallback>
+  bool CastRay(const Ray& ray, real maxDistance, RayCallback& callback) const;
+
+  MeshBvhLayout::Enum GetLayout() const { return mLayout; }
+  uint GetPrimitiveCount() const { return mPrimitives.Size(); }
+  /// The memory used by the nodes and primitive indices.
+  uint GetMemoryUsage() const;
+  /// Draw the bounds of the nodes at the given depth.
+  void Draw(uint depth) const;
+
+private:
+  void BuildBinary(const Array<Aabb>& primitiveAabbs);
+  void Quantize();
+  void Collapse();
+  void GetNodeAabb(uint nodeIndex, Aabb& aabb) const;
+
+  void QueryStandard(const Aabb& aabb, Array<uint>& primitives) const;
+  void QueryQuantized(const Aabb& aabb, Array<uint>& primitives) const;
+  void QueryWide(const Aabb& aabb, Array<uint>& primitives) const;
+
+  template <typename RayCallback>
+  bool CastRayBinary(const MeshBvhRay& ray, real maxDistance, RayCallback& callback) const;
+  template <typename RayCallback>
+  bool CastRayWide(const MeshBvhRay& ray, real maxDistance, RayCallback& callback) const;
+  template <typename RayCallback>
+  bool TestLeaf(uint first, uint count, real& maxDistance, RayCallback& callback) const;
+
+  /// The binary node bounds and links regardless of the layout.
+  void GetBounds(uint nodeIndex, real min[3], real max[3]) const;
+  void GetLink(uint nodeIndex, uint& index, uint& count) const;
+
+  MeshBvhLayout::Enum mLayout;
+  /// Only the array of the current layout is used.
+  Array<MeshBvhNode> mNodes;
+  Array<MeshBvhQuantizedNode> mQuantizedNodes;
+  Array<MeshBvhWideNode> mWideNodes;
+  /// Primitive indices in leaf order.
+  Array<uint> mPrimitives;
+
+  /// Quantized bounds are mQuantizeOrigin + q * mQuantizeScale
+  Vec3 mQuantizeOrigin;
+  Vec3 mQuantizeScale;
+};
+
+// The max depth of a traversal stack (the builder guarantees the tree depth)
+const uint cMeshBvhMaxDepth = 96;
+const uint cMeshBvhCountBits = 3;
+
+//-------------------------------------------------------------------MeshBvh Ray Casts
+template <typename RayCallback>
+bool MeshBvh::CastRay(const Ray& ray, real maxDistance, RayCallback& callback) const
+{
+  if(mPrimitives.Empty())
+    return false;
+
+  MeshBvhRay bvhRay(ray);
+  if(mLayout == MeshBvhLayout::Wide)
+    return CastRayWide(bvhRay, maxDistance, callback);
+  return CastRayBinary(bvhRay, maxDistance, callback);
+}
+
+template <typename RayCallback>
+bool MeshBvh::TestLeaf(uint first, uint count, real& maxDistance, RayCallback& callback) const
+{
+  bool hit = false;
+  for(uint i = 0; i < count; ++i)
+    hit |= callback(mPrimitives[first + i], maxDistance);
+  return hit;
+}
+
+template <typename RayCallback>
+bool MeshBvh::CastRayBinary(const MeshBvhRay& ray, real maxDistance, RayCallback& callback) const
+{
+  struct StackEntry
+  {
+    uint mNode;
+    real mDistance;
+  };
+  StackEntry stack[cMeshBvhMaxDepth + 1];
+  uint stackSize = 0;
+
+  real min[3], max[3];
+  real distance;
+  GetBounds(0, min, max);
+  if(!ray.Test(min, max, maxDistance, distance))
+    return false;
+
+  bool hit = false;
+  stack[stackSize].mNode = 0;
+  stack[stackSize].mDistance = distance;
+  ++stackSize;
+
+  while(stackSize != 0)
+  {
+    --stackSize;
+    uint nodeIndex = stack[stackSize].mNode;
+    // A closer hit was found since this node was pushed
+    if(stack[stackSize].mDistance > maxDistance)
+      continue;
+
+    while(true)
+    {
+      uint index, count;
+      GetLink(nodeIndex, index, count);
+      if(count != 0)
+      {
+        hit |= TestLeaf(index, count, maxDistance, callback);
+        break;
+      }
+
+      uint child0 = nodeIndex + 1;
+      uint child1 = index;
+      real distance0, distance1;
+      GetBounds(child0, min, max);
+      bool hit0 = ray.Test(min, max, maxDistance, distance0);
+      GetBounds(child1, min, max);
+      bool hit1 = ray.Test(min, max, maxDistance, distance1);
+
+      // Continue down the nearer child and come back for the farther one
+      if(hit0 && hit1)
+      {
+        if(distance1 < distance0)
+        {
+          Math::Swap(child0, child1);
+          Math::Swap(distance0, distance1);
+        }
+        stack[stackSize].mNode = child1;
+        stack[stackSize].mDistance = distance1;
+        ++stackSize;
+        nodeIndex = child0;
+      }
+      else if(hit0)
+        nodeIndex = child0;
+      else if(hit1)
+        nodeIndex = child1;
+      else
+        break;
+    }
+  }
+  return hit;
+}
+
+template <typename RayCallback>
+bool MeshBvh::CastRayWide(const MeshBvhRay& ray, real maxDistance, RayCallback& callback) const
+{
+  using namespace Math::Simd;
+
+  struct StackEntry
+  {
+    uint mIndex;
+    uint mCount;
+    real mDistance;
+  };
+  // Every node visited replaces itself with at most 4 children
+  StackEntry stack[cMeshBvhMaxDepth * 3 + 4];
+  uint stackSize = 0;
+
+  SimVec startX = Set(ray.mStart[0]);
+  SimVec startY = Set(ray.mStart[1]);
+  SimVec startZ = Set(ray.mStart[2]);
+  SimVec invX = Set(ray.mInvDirection[0]);
+  SimVec invY = Set(ray.mInvDirection[1]);
+  SimVec invZ = Set(ray.mInvDirection[2]);
+  SimVec noHit = Set(Math::PositiveMax());
+
+  bool hit = false;
+  stack[stackSize].mIndex = 0;
+  stack[stackSize].mCount = 0;
+  stack[stackSize].mDistance = 0;
+  ++stackSize;
+
+  while(stackSize != 0)
+  {
+    --stackSize;
+    StackEntry entry = stack[stackSize];
+    if(entry.mDistance > maxDistance)
+      continue;
+
+    if(entry.mCount != 0)
+    {
+      hit |= TestLeaf(entry.mIndex, entry.mCount, maxDistance, callback);
+      continue;
+    }
+
+    // Slab test all 4 children at once
+    const MeshBvhWideNode& node = mWideNodes[entry.mIndex];
+    SimVec x0 = Multiply(Subtract(UnAlignedLoad(node.mMinX), startX), invX);
+    SimVec x1 = Multiply(Subtract(UnAlignedLoad(node.mMaxX), startX), invX);
+    SimVec y0 = Multiply(Subtract(UnAlignedLoad(node.mMinY), startY), invY);
+    SimVec y1 = Multiply(Subtract(UnAlignedLoad(node.mMaxY), startY), invY);
+    SimVec z0 = Multiply(Subtract(UnAlignedLoad(node.mMinZ), startZ), invZ);
+    SimVec z1 = Multiply(Subtract(UnAlignedLoad(node.mMaxZ), startZ), invZ);
+
+    SimVec tMin = Max(Max(Min(x0, x1), Min(y0, y1)), Max(Min(z0, z1), ZeroOutVec()));
+    SimVec tMax = Min(Min(Max(x0, x1), Max(y0, y1)), Min(Max(z0, z1), Set(maxDistance)));
+    SimVec distances = Select(noHit, tMin, LessEqual(tMin, tMax));
+
+    real childDistances[4];
+    UnAlignedStore(distances, childDistances);
+
+    // Sort the hit children farthest first so the nearest is popped first
+    uint order[4];
+    uint hitCount = 0;
+    for(uint i = 0; i < 4; ++i)
+    {
+      if(childDistances[i] == Math::PositiveMax() || node.mIndex[i] == cInvalidIndex)
+        continue;
+
+      uint j = hitCount++;
+      for(; j > 0 && childDistances[order[j - 1]] < childDistances[i]; --j)
+        order[j] = order[j - 1];
+      order[j] = i;
+    }
+
+    for(uint i = 0; i < hitCount; ++i)
+    {
+      uint child = order[i];
+      stack[stackSize].mIndex = node.mIndex[child];
+      stack[stackSize].mCount = node.mCount[child];
+      stack[stackSize].mDistance = childDistances[child];
+      ++stackSize;
+    }
+  }
+  return hit;
+}
+
+}//namespace Zero
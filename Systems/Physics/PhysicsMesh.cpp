@@ -21,12 +21,27 @@ ZilchDefineType(PhysicsMesh, builder, type)
 
   ZilchBindMethod(CreateRuntime);
   ZilchBindMethod(RuntimeClone);
+  ZilchBindGetterSetter(BvhLayout);
+}
+
+PhysicsMesh::PhysicsMesh()
+{
+  mBvhLayout = MeshBvhLayout::Wide;
 }
 
 void PhysicsMesh::Serialize(Serializer& stream)
 {
   GenericPhysicsMesh::Serialize(stream);
-  SerializeAabbTree(stream, mTree);
+
+  // Older files end with the mid phase's StaticAabbTree. The bvh is always
+  // rebuilt from the triangles, so the tree is no longer saved and one read
+  // from an old file is thrown away. Newer files end after the indices,
+  // where the binary loader finds no polymorphic block and reads nothing.
+  if(stream.GetMode() == SerializerMode::Loading)
+  {
+    StaticAabbTree<uint> oldTree;
+    SerializeAabbTree(stream, oldTree);
+  }
 }
 
 void PhysicsMesh::Initialize()
@@ -37,7 +52,7 @@ void PhysicsMesh::Initialize()
 void PhysicsMesh::Unload()
 {
   GenericPhysicsMesh::Unload();
-  mTree.DeleteTree();
+  mBvh.Clear();
 }
 
 void PhysicsMesh::OnResourceModified()
@@ -66,71 +81,83 @@ void PhysicsMesh::GenerateInternalEdgeData()
   GenerateInternalEdgeInfo(this, &mInfoMap);
 }
 
-bool PhysicsMesh::CastRay(const Ray& localRay, ProxyResult& result, BaseCastFilter& filter)
+MeshBvhLayout::Enum PhysicsMesh::GetBvhLayout()
 {
-  bool triangleHit = false;
-  result.mTime = Math::PositiveMax();
+  return mBvhLayout;
+}
 
-  // Query the aabb tree for possible triangles. Test all triangles whose aabbs we hit.
-  forRangeBroadphaseTree(StaticAabbTree<uint>, mTree, Ray, localRay)
+void PhysicsMesh::SetBvhLayout(MeshBvhLayout::Enum layout)
+{
+  if(layout >= MeshBvhLayout::Size)
   {
-    uint triIndex = range.Front();
-    Triangle tri = GetTriangle(triIndex);
-    triangleHit |= CastRayTriangle(localRay, tri, triIndex, result, filter);
+    DoNotifyWarning("Invalid value", "BvhLayout must be set to a valid value from the MeshBvhLayout enum");
+    return;
   }
+  if(layout == mBvhLayout)
+    return;
 
-  return triangleHit;
+  mBvhLayout = layout;
+  // A mesh without a built bvh picks up the layout when it's built
+  if(mBvh.GetPrimitiveCount() != 0)
+    GenerateTree();
 }
 
-void PhysicsMesh::GetOverlappingTriangles(Aabb& aabb, TriangleArray& triangles, Array<uint>& triangleIds)
+// Tests the triangles of the leaves the ray hits
+struct PhysicsMeshRayCallback
 {
-  forRangeBroadphaseTree(StaticAabbTree<uint>, mTree, Aabb, aabb)
+  bool operator()(uint triIndex, real& maxDistance)
   {
-    // Get the triangle index
-    uint triIndex = range.Front();
-    triangles.PushBack(GetTriangle(triIndex));
-    triangleIds.PushBack(triIndex);
+    Triangle tri = mMesh->GetTriangle(triIndex);
+    bool hit = mMesh->CastRayTriangle(*mRay, tri, triIndex, *mResult, *mFilter);
+    maxDistance = mResult->mDistance;
+    return hit;
   }
+
+  PhysicsMesh* mMesh;
+  const Ray* mRay;
+  ProxyResult* mResult;
+  BaseCastFilter* mFilter;
+};
+
+bool PhysicsMesh::CastRay(const Ray& localRay, ProxyResult& result, BaseCastFilter& filter)
+{
+  result.mTime = Math::PositiveMax();
+
+  // Walk the bvh nearest first, nodes past the closest hit so far are skipped
+  PhysicsMeshRayCallback callback = {this, &localRay, &result, &filter};
+  return mBvh.CastRay(localRay, result.mTime, callback);
+}
+
+void PhysicsMesh::GetOverlappingTriangles(Aabb& aabb, TriangleArray& triangles, Array<uint>& triangleIds)
+{
+  uint start = triangleIds.Size();
+  mBvh.Query(aabb, triangleIds);
+
+  for(uint i = start; i < triangleIds.Size(); ++i)
+    triangles.PushBack(GetTriangle(triangleIds[i]));
 }
 
 void PhysicsMesh::CopyTo(PhysicsMesh* destination)
 {
+  destination->mBvhLayout = mBvhLayout;
   GenericPhysicsMesh::CopyTo(destination);
   ForceRebuild();
 }
 
-StaticAabbTree<uint>* PhysicsMesh::GetAabbTree()
+MeshBvh* PhysicsMesh::GetBvh()
 {
-  return &mTree;
+  return &mBvh;
 }
 
 void PhysicsMesh::GenerateTree()
 {
-  // Clear the old tree
-  mTree.DeleteTree();
-
-  // Build the Aabb-Tree
-  mTree.SetPartitionMethod(PartitionMethods::MinimizeVolumeSum);
-
-  // Dummy proxy. They will not be needed.
-  BroadPhaseProxy proxy;
-
   size_t triangleCount = GetTriangleCount();
+  Array<Aabb> triangleAabbs;
+  triangleAabbs.Resize(triangleCount);
   for(size_t triIndex = 0; triIndex < triangleCount; ++triIndex)
-  {
-    Triangle tri = GetTriangle(triIndex);
-    
-    // Create the broad phase data.
-    BaseBroadPhaseData<uint> data;
-    data.mClientData = triIndex;
-    data.mAabb = ToAabb(tri);
-
-    // Insert it into the tree
-    mTree.CreateProxy(proxy, data);
-  }
+    triangleAabbs[triIndex] = ToAabb(GetTriangle(triIndex));
 
-  // Construct the tree
-  mTree.Construct();
+  mBvh.Build(triangleAabbs, mBvhLayout);
 }
 
 //-------------------------------------------------------------------PhysicsMeshManager
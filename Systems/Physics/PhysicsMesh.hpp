@@ -18,6 +18,8 @@ public:
   ZilchDeclareType(TypeCopyMode::ReferenceType);
   typedef StaticAabbTree<uint> AabbTree;
 
+  PhysicsMesh();
+
   //-------------------------------------------------------------------Resource Interface
   void Serialize(Serializer& stream) override;
   void Initialize();
@@ -35,6 +37,12 @@ public:
   void RebuildMidPhase() override;
   void GenerateInternalEdgeData() override;
 
+  /// The node layout of the mid-phase bvh. Wide tests four children at a time,
+  /// Quantized uses the least memory. Changing it rebuilds the bvh.
+  /// Not saved with the mesh, so it only applies to this instance.
+  MeshBvhLayout::Enum GetBvhLayout();
+  void SetBvhLayout(MeshBvhLayout::Enum layout);
+
   //-------------------------------------------------------------------Internal
   
   /// Finds the first triangle hit by the local-space ray.
@@ -44,14 +52,15 @@ public:
   
   /// Copy all relevant info for runtime clone.
   void CopyTo(PhysicsMesh* destination);
-  /// Returns the mesh's Aabb tree.
-  StaticAabbTree<uint>* GetAabbTree();
+  /// Returns the mesh's bounding volume hierarchy.
+  MeshBvh* GetBvh();
   
 private:
   void GenerateTree();
 
-  /// Aabb Tree used for fast ray casts and triangle lookups.
-  StaticAabbTree<uint> mTree;
+  /// Bvh used for fast ray casts and triangle lookups.
+  MeshBvh mBvh;
+  MeshBvhLayout::Enum mBvhLayout;
 };
 
 //-------------------------------------------------------------------PhysicsMeshManager
@@ -97,6 +97,7 @@ void PhysicsQueue::ColliderToBroadPhaseData(Collider* collider, BroadPhaseData&
   data.mAabb = collider->mAabb;
   data.mClientData = (void*)collider;
   data.mBoundingSphere = collider->mBoundingSphere;
+  Physics::ExpandSpeculativeBroadPhaseData(collider, Physics::GetSpeculativeDt(collider->mSpace), data);
 }
 
 void PhysicsQueue::MarkUnQueued()
@@ -304,6 +304,7 @@ ZilchDefineType(PhysicsSolverConfig, builder, type)
   //ZilchBindGetterSetterProperty(SolverType);
 
   ZilchBindGetterSetterProperty(PositionCorrectionType);
+  ZilchBindGetterSetterProperty(ContinuousCollisionMode);
 }
 
 PhysicsSolverConfig::PhysicsSolverConfig()
@@ -312,6 +313,7 @@ PhysicsSolverConfig::PhysicsSolverConfig()
   mPositionCorrectionType = PhysicsSolverPositionCorrection::Baumgarte;
   mSolverType = PhysicsSolverType::Basic;
   mSubType = PhysicsSolverSubType::BasicSolving;
+  mContinuousCollisionMode = PhysicsContinuousCollisionMode::None;
 }
 
 PhysicsSolverConfig::~PhysicsSolverConfig()
@@ -331,6 +333,7 @@ void PhysicsSolverConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(PhysicsSolverPositionCorrection, mPositionCorrectionType, PhysicsSolverPositionCorrection::PostStabilization);
   SerializeEnumNameDefault(PhysicsSolverType, mSolverType, PhysicsSolverType::Basic);
   SerializeEnumNameDefault(PhysicsSolverSubType, mSubType, PhysicsSolverSubType::BlockSolving);
+  SerializeEnumNameDefault(PhysicsContinuousCollisionMode, mContinuousCollisionMode, PhysicsContinuousCollisionMode::None);
 
   // Serialize our composition of constraint config blocks
   BoundType* selfBoundType = this->ZilchGetDerivedType();
@@ -435,6 +438,21 @@ void PhysicsSolverConfig::SetSubCorrectionType(PhysicsSolverSubType::Enum subTyp
   mSubType = subType;
 }
 
+PhysicsContinuousCollisionMode::Enum PhysicsSolverConfig::GetContinuousCollisionMode()
+{
+  return mContinuousCollisionMode;
+}
+
+void PhysicsSolverConfig::SetContinuousCollisionMode(PhysicsContinuousCollisionMode::Enum mode)
+{
+  if(mode >= PhysicsContinuousCollisionMode::Size)
+  {
+    DoNotifyWarning("Invalid value", "ContinuousCollisionMode must be set to a valid value from the PhysicsContinuousCollisionMode enum");
+    return;
+  }
+  mContinuousCollisionMode = mode;
+}
+
 ConstraintConfigBlock& PhysicsSolverConfig::GetContactBlock()
 {
   return mContactBlock;
@@ -475,6 +493,7 @@ void PhysicsSolverConfig::CopyTo(PhysicsSolverConfig* destination)
   destination->mPositionCorrectionType = mPositionCorrectionType;
   destination->mSolverType = mSolverType;
   destination->mSubType = mSubType;
+  destination->mContinuousCollisionMode = mContinuousCollisionMode;
 
   // Clear the old blocks from our destination
   DeleteObjectsInContainer(destination->mBlocks);
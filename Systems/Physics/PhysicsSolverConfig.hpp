@@ -22,6 +22,11 @@ DeclareEnum3(ConstraintPositionCorrection, Baumgarte, PostStabilization, Inherit
 DeclareEnum2(PhysicsSolverSubType, BasicSolving, BlockSolving);
 /// How to compute the tangents for a contact point. Mainly for testing.
 DeclareEnum3(PhysicsContactTangentTypes, OrthonormalTangents, VelocityTangents, RandomTangents);
+/// How fast moving bodies are kept from passing through other objects.
+/// <param name="None">Only collide objects that are touching at the start of a step.</param>
+/// <param name="Speculative">Fast bodies also get contacts with objects they'll
+/// reach this step that only stop them once the gap is closed.</param>
+DeclareEnum2(PhysicsContinuousCollisionMode, None, Speculative);
 
 //-------------------------------------------------------------------ConstraintConfigBlock
 /// A block of information for solving a joint (or constraint) type.
@@ -137,6 +142,11 @@ public:
   /// What kind of solver to use for post stabilization. Mostly for testing.
   PhysicsSolverSubType::Enum GetSubCorrectionType();
   void SetSubCorrectionType(PhysicsSolverSubType::Enum subType);
+  /// How fast moving bodies are kept from tunneling through other objects. Speculative
+  /// adds contacts for convex pairs that will touch within the step (based upon their
+  /// velocities) so the normal solver stops them at the surface.
+  PhysicsContinuousCollisionMode::Enum GetContinuousCollisionMode();
+  void SetContinuousCollisionMode(PhysicsContinuousCollisionMode::Enum mode);
 
   //-------------------------------------------------------------------Internal
   ConstraintConfigBlock& GetContactBlock();
@@ -161,6 +171,7 @@ public:
   PhysicsSolverType::Enum mSolverType;
   PhysicsSolverPositionCorrection::Enum mPositionCorrectionType;
   PhysicsSolverSubType::Enum mSubType;
+  PhysicsContinuousCollisionMode::Enum mContinuousCollisionMode;
 
   Array<ConstraintConfigBlock*> mBlocks;
 
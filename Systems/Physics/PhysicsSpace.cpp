@@ -118,6 +118,209 @@ bool ClientPairSorter(ClientPair& a, ClientPair& b)
   return pairA > pairB;
 }
 
+//-------------------------------------------------------------------BroadPhaseChunkRange
+// Fewer colliders than this are queried against the static broad phase on the calling thread
+const uint cParallelBroadPhaseCount = 256;
+const uint cBroadPhaseChunkSize = 64;
+
+// Queries chunks of the dynamic colliders against the static broad phase on the
+// job workers (the queries only read the broad phase). Every chunk has its own
+// pair array so appending them in chunk order gives the serial results.
+struct BroadPhaseChunkRange
+{
+  BroadPhaseChunkRange(BroadPhasePackage* broadPhase, BroadPhaseDataArray& data,
+                       Array<ClientPairArray>& chunks)
+    : mBroadPhase(broadPhase), mData(&data), mChunks(&chunks)
+  {
+  }
+
+  void operator()(uint startChunk, uint endChunk)
+  {
+    ProfileScopeTree("BroadPhaseChunk", "BroadPhase", Color::Sienna);
+
+    for(uint chunkIndex = startChunk; chunkIndex < endChunk; ++chunkIndex)
+    {
+      ClientPairArray& results = (*mChunks)[chunkIndex];
+      uint start = chunkIndex * cBroadPhaseChunkSize;
+      uint end = Math::Min(start + cBroadPhaseChunkSize, mData->Size());
+      for(uint i = start; i < end; ++i)
+        mBroadPhase->Query((*mData)[i], results);
+    }
+  }
+
+  BroadPhasePackage* mBroadPhase;
+  BroadPhaseDataArray* mData;
+  Array<ClientPairArray>* mChunks;
+};
+
+//-------------------------------------------------------------------NarrowPhaseChunk
+// Fewer pairs than this are tested on the calling thread
+const uint cParallelNarrowPhasePairs = 256;
+const uint cNarrowPhaseChunkSize = 128;
+
+// Only pairs of primitive shapes are tested on the job workers. Their collide
+// functions only read the colliders' world data (updated before the narrow
+// phase), while mesh, height map and convex mesh colliders build caches lazily
+// during collision and stay on the calling thread.
+bool IsParallelNarrowPhasePair(Collider* collider1, Collider* collider2)
+{
+  return collider1->GetColliderType() <= Collider::cCapsule &&
+         collider2->GetColliderType() <= Collider::cCapsule;
+}
+
+// Tests one pair, the manifolds are appended and the speculative manifolds
+// are only generated if the pair isn't touching. Returns if the pair touched.
+bool TestNarrowPhasePair(CollisionManager* collisionManager, Physics::ManifoldCache* manifoldCache,
+                         ColliderPair& pair, real speculativeDt, Physics::ManifoldArray& manifolds,
+                         Physics::ManifoldArray& speculativeManifolds, Physics::ManifoldCacheResults& cacheResults)
+{
+  if(manifoldCache->TestCollision(collisionManager, pair, manifolds, cacheResults))
+    return true;
+
+  if(speculativeDt != real(0.0))
+    Physics::SpeculativeCollision(pair, speculativeDt, speculativeManifolds);
+  return false;
+}
+
+// Where one pair's results are in its chunk's arrays
+struct NarrowPhasePairResult
+{
+  uint ManifoldStart;
+  uint ManifoldEnd;
+  uint SpeculativeStart;
+  uint SpeculativeEnd;
+  bool Collided;
+  // Not tested on a worker, the calling thread tests it when merging
+  bool Deferred;
+};
+
+// The results of testing one contiguous chunk of the broad phase pairs
+struct NarrowPhaseChunk
+{
+  Physics::ManifoldArray Manifolds;
+  Physics::ManifoldArray SpeculativeManifolds;
+  Array<NarrowPhasePairResult> Pairs;
+  Physics::ManifoldCacheResults CacheResults;
+};
+
+// Tests chunks of the broad phase pairs on the job workers. Each chunk has
+// its own output and records each pair's results so merging them in pair
+// order gives the serial results.
+struct NarrowPhaseChunkRange
+{
+  NarrowPhaseChunkRange(CollisionManager* collisionManager, Physics::ManifoldCache* manifoldCache,
+                        Array<ClientPair>& pairs, Array<NarrowPhaseChunk>& chunks, real speculativeDt)
+    : mCollisionManager(collisionManager), mManifoldCache(manifoldCache), mPairs(&pairs),
+      mChunks(&chunks), mSpeculativeDt(speculativeDt)
+  {
+  }
+
+  void operator()(uint startChunk, uint endChunk)
+  {
+    ProfileScopeTree("NarrowPhaseChunk", "NarrowPhase", Color::LightSalmon);
+
+    for(uint chunkIndex = startChunk; chunkIndex < endChunk; ++chunkIndex)
+    {
+      NarrowPhaseChunk& chunk = (*mChunks)[chunkIndex];
+      uint start = chunkIndex * cNarrowPhaseChunkSize;
+      uint end = Math::Min(start + cNarrowPhaseChunkSize, mPairs->Size());
+      chunk.Pairs.Resize(end - start);
+
+      for(uint pairIndex = start; pairIndex < end; ++pairIndex)
+      {
+        ClientPair* clientPair = &(*mPairs)[pairIndex];
+        Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
+        Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
+
+        NarrowPhasePairResult& result = chunk.Pairs[pairIndex - start];
+        result.ManifoldStart = chunk.Manifolds.Size();
+        result.SpeculativeStart = chunk.SpeculativeManifolds.Size();
+        result.Collided = false;
+        result.Deferred = !IsParallelNarrowPhasePair(collider1, collider2);
+        if(!result.Deferred)
+        {
+          ColliderPair pair(collider1, collider2);
+          result.Collided = TestNarrowPhasePair(mCollisionManager, mManifoldCache, pair, mSpeculativeDt,
+                                                chunk.Manifolds, chunk.SpeculativeManifolds, chunk.CacheResults);
+        }
+        result.ManifoldEnd = chunk.Manifolds.Size();
+        result.SpeculativeEnd = chunk.SpeculativeManifolds.Size();
+      }
+    }
+  }
+
+  CollisionManager* mCollisionManager;
+  Physics::ManifoldCache* mManifoldCache;
+  Array<ClientPair>* mPairs;
+  Array<NarrowPhaseChunk>* mChunks;
+  real mSpeculativeDt;
+};
+
+//-------------------------------------------------------------------RayCastBatchRange
+// Fewer rays than this are cast on the calling thread
+const uint cParallelRayCastCount = 64;
+// Rays per chunk, each chunk is cast by one thread into its own results
+const uint cRayCastChunkSize = 32;
+// Every ray in a batch keeps a scratch array this large at most
+const uint cMaxBatchCountPerRay = 1024;
+
+// Casts a range of a batch's chunks of rays. Every chunk writes only its own
+// results array (and its rays' counts) so chunks can be cast on any thread.
+struct RayCastBatchRange
+{
+  RayCastBatchRange(BroadPhasePackage* broadPhase, RayCastBatch& batch, uint maxCountPerRay, BaseCastFilter& filter)
+    : mBroadPhase(broadPhase), mBatch(&batch), mMaxCountPerRay(maxCountPerRay), mFilter(&filter)
+  {
+  }
+
+  void operator()(uint startChunk, uint endChunk)
+  {
+    // One scratch array for every ray in the range
+    ProxyCastResultArray scratch(mMaxCountPerRay);
+    uint rayCount = mBatch->mRays.Size();
+    for(uint chunk = startChunk; chunk < endChunk; ++chunk)
+    {
+      CastResultArray& chunkResults = mBatch->mChunkResults[chunk];
+      chunkResults.Clear();
+
+      uint endRay = Math::Min((chunk + 1) * cRayCastChunkSize, rayCount);
+      for(uint rayIndex = chunk * cRayCastChunkSize; rayIndex < endRay; ++rayIndex)
+      {
+        const Ray& worldRay = mBatch->mRays[rayIndex];
+        ProxyCastResults results(scratch, *mFilter);
+        mBroadPhase->CastRay(worldRay.Start, worldRay.Direction.AttemptNormalized(), results);
+
+        uint count = results.GetCurrentSize();
+        for(uint i = 0; i < count; ++i)
+        {
+          ProxyResult& proxyResult = scratch[i];
+          CastResult& result = chunkResults.PushBack();
+          result.mObjectHit = static_cast<Collider*>(proxyResult.mObjectHit);
+          result.mPoints[0] = proxyResult.mPoints[0];
+          result.mPoints[1] = proxyResult.mPoints[1];
+          result.mContactNormal = proxyResult.mContactNormal;
+          result.mTime = proxyResult.mTime;
+          result.mShapeIndex = proxyResult.ShapeIndex;
+        }
+        mBatch->mCounts[rayIndex] = count;
+      }
+    }
+  }
+
+  BroadPhasePackage* mBroadPhase;
+  RayCastBatch* mBatch;
+  uint mMaxCountPerRay;
+  BaseCastFilter* mFilter;
+};
+
+// Casts against these walk their shape's resource (the height map's patches
+// or the mesh's triangles), batches are cast serially while any exist
+bool IsComplexCastCollider(Collider* collider)
+{
+  return collider->mType == Collider::cMultiConvexMesh || collider->mType == Collider::cMesh ||
+         collider->mType == Collider::cHeightMap;
+}
+
 //-------------------------------------------------------------------PhysicsSpace
 ZilchDefineType(PhysicsSpace, builder, type)
 {
@@ -137,6 +340,10 @@ ZilchDefineType(PhysicsSpace, builder, type)
   ZilchBindGetterSetterProperty(AllowSleep);
   ZilchBindGetterSetterProperty(Mode2D);
   ZilchBindGetterSetterProperty(Deterministic);
+  ZilchBindGetterSetterProperty(ParallelIslands);
+  ZilchBindGetterSetterProperty(CacheManifolds);
+  ZilchBindGetter(ManifoldCacheHits);
+  ZilchBindGetter(ManifoldCacheMisses);
   ZilchBindGetterSetterProperty(CollisionTable);
   ZilchBindGetterSetterProperty(PhysicsSolverConfig);
 
@@ -156,6 +363,8 @@ ZilchDefineType(PhysicsSpace, builder, type)
   ZilchBindOverloadedMethod(CastRayFirst, ZilchInstanceOverload(CastResult, const Ray&, CastFilter&));
   ZilchBindOverloadedMethod(CastRay, ZilchInstanceOverload(CastResultsRange, const Ray&, uint));
   ZilchBindOverloadedMethod(CastRay, ZilchInstanceOverload(CastResultsRange, const Ray&, uint, CastFilter&));
+  ZilchBindOverloadedMethod(CastRays, ZilchInstanceOverload(void, RayCastBatch*, uint));
+  ZilchBindOverloadedMethod(CastRays, ZilchInstanceOverload(void, RayCastBatch*, uint, CastFilter&));
   // Segment Cast
   ZilchBindOverloadedMethod(CastSegment, ZilchInstanceOverload(CastResultsRange, const Segment&, uint));
   ZilchBindOverloadedMethod(CastSegment, ZilchInstanceOverload(CastResultsRange, const Segment&, uint, CastFilter&));
@@ -206,6 +415,7 @@ PhysicsSpace::PhysicsSpace()
   mBroadPhase = nullptr;
   mContactManager = nullptr;
   mIslandManager = nullptr;
+  mManifoldCache = nullptr;
   mWorldCollider = nullptr;
   mNodeManager = nullptr;
 
@@ -214,6 +424,7 @@ PhysicsSpace::PhysicsSpace()
 
   mInvalidVelocityOccurred = false;
   mMaxVelocity = real(1e+10);
+  mComplexColliderCount = 0;
 }
 
 PhysicsSpace::~PhysicsSpace()
@@ -231,6 +442,7 @@ PhysicsSpace::~PhysicsSpace()
   Memory::HeapDeallocate(mHeap, mEventManager);
   Memory::HeapDeallocate(mHeap, mNodeManager);
   Memory::HeapDeallocate(mHeap, mIslandManager);
+  Memory::HeapDeallocate(mHeap, mManifoldCache);
   Memory::HeapDeallocate(mHeap, mContactManager);
 
   SafeDelete(mBroadPhase);
@@ -240,7 +452,7 @@ PhysicsSpace::~PhysicsSpace()
 
 void PhysicsSpace::Serialize(Serializer& stream)
 {
-  // Serialize AllowSleep and Deterministic.
+  // Serialize the flags (AllowSleep and Deterministic default to on).
   uint defaultFlags = PhysicsSpaceFlags::AllowSleep | PhysicsSpaceFlags::Deterministic;
   SerializeBits(stream, mStateFlags, PhysicsSpaceFlags::Names, 0, defaultFlags);
   SerializeNameDefault(mSubStepCount, 1u);
@@ -262,6 +474,9 @@ void PhysicsSpace::Initialize(CogInitializer& initializer)
 
   mIslandManager = Memory::HeapAllocate<Physics::IslandManager>(mHeap, mPhysicsSolverConfig);
   mIslandManager->SetSpace(this);
+  mIslandManager->mParallelIslands = GetParallelIslands();
+  mManifoldCache = Memory::HeapAllocate<Physics::ManifoldCache>(mHeap);
+  mManifoldCache->mEnabled = GetCacheManifolds();
   mNodeManager = Memory::HeapAllocate<Physics::PhysicsNodeManager>(mHeap);
   mEventManager = Memory::HeapAllocate<Physics::PhysicsEventManager>(mHeap);
   mEventManager->SetAllocator(mHeap);
@@ -529,6 +744,49 @@ void PhysicsSpace::SetDeterministic(bool state)
   mStateFlags.SetState(PhysicsSpaceFlags::Deterministic, state);
 }
 
+bool PhysicsSpace::GetParallelIslands() const
+{
+  return mStateFlags.IsSet(PhysicsSpaceFlags::ParallelIslands);
+}
+
+void PhysicsSpace::SetParallelIslands(bool state)
+{
+  mStateFlags.SetState(PhysicsSpaceFlags::ParallelIslands, state);
+  if(mIslandManager != nullptr)
+    mIslandManager->mParallelIslands = state;
+}
+
+bool PhysicsSpace::GetCacheManifolds() const
+{
+  return mStateFlags.IsSet(PhysicsSpaceFlags::CacheManifolds);
+}
+
+void PhysicsSpace::SetCacheManifolds(bool state)
+{
+  mStateFlags.SetState(PhysicsSpaceFlags::CacheManifolds, state);
+  if(mManifoldCache != nullptr)
+  {
+    mManifoldCache->mEnabled = state;
+    mManifoldCache->Clear();
+  }
+}
+
+void PhysicsSpace::InvalidateCachedManifolds(Collider* collider)
+{
+  if(mManifoldCache != nullptr)
+    mManifoldCache->Invalidate(collider);
+}
+
+uint PhysicsSpace::GetManifoldCacheHits() const
+{
+  return mManifoldCache->mHits;
+}
+
+uint PhysicsSpace::GetManifoldCacheMisses() const
+{
+  return mManifoldCache->mMisses;
+}
+
 CollisionGroupInstance* PhysicsSpace::GetCollisionGroupInstance(ResourceId groupId) const
 {
   return mCollisionTable->GetGroupInstance(groupId);
@@ -766,6 +1024,7 @@ void PhysicsSpace::BroadPhase()
   BroadPhaseData broadPhaseData;
   BroadPhaseDataArray dataArray;
   dataArray.Reserve(mPossiblePairs.capacity());
+  real speculativeDt = Physics::GetSpeculativeDt(this);
 
   ColliderList::range range = mDynamicColliders.All();
 
@@ -783,6 +1042,8 @@ void PhysicsSpace::BroadPhase()
     }
 
     ColliderToBroadPhaseData(&collider, broadPhaseData);
+    // Fast bodies look for everything they can reach this step
+    Physics::ExpandSpeculativeBroadPhaseData(&collider, speculativeDt, broadPhaseData);
     dataArray.PushBack(broadPhaseData);
     range.PopFront();
   }
@@ -790,8 +1051,24 @@ void PhysicsSpace::BroadPhase()
   mBroadPhase->RegisterCollisions();
   // Query the dynamic broad phase
   mBroadPhase->SelfQuery(mPossiblePairs);
-  // Query the static broad phase
-  mBroadPhase->BatchQuery(dataArray, mPossiblePairs);
+
+  // Query the static broad phase. The tracker records statistics
+  // per query so it always runs on this thread.
+  uint dataCount = dataArray.Size();
+  if(dataCount >= cParallelBroadPhaseCount && Z::gJobs != nullptr && !mBroadPhase->IsTracking())
+  {
+    Array<ClientPairArray> chunks;
+    chunks.Resize((dataCount + cBroadPhaseChunkSize - 1) / cBroadPhaseChunkSize);
+    BroadPhaseChunkRange chunkRange(mBroadPhase, dataArray, chunks);
+    Z::gJobs->ParallelFor(0, chunks.Size(), 1, chunkRange);
+
+    for(uint chunkIndex = 0; chunkIndex < chunks.Size(); ++chunkIndex)
+      mPossiblePairs.Append(chunks[chunkIndex].All());
+  }
+  else
+  {
+    mBroadPhase->BatchQuery(dataArray, mPossiblePairs);
+  }
 
   // Sort the pairs for determinism!
   if(GetDeterministic())
@@ -805,28 +1082,64 @@ void PhysicsSpace::NarrowPhase()
   HeapAllocator allocator(mHeap);
   Physics::ManifoldArray tempManifolds;
   tempManifolds.SetAllocator(allocator);
+  Physics::ManifoldArray speculativeManifolds;
+  speculativeManifolds.SetAllocator(allocator);
 
   Array<NodePointerPair> Collisions;
   Collisions.SetAllocator(allocator);
 
+  // Non-touching pairs that will touch this step (0 if continuous collision is off)
+  real speculativeDt = Physics::GetSpeculativeDt(this);
+  bool tracking = mBroadPhase->IsTracking();
+
+  // With enough pairs, test the primitive pairs in parallel chunks first
   uint size = mPossiblePairs.Size();
-  for(unsigned pairIndex = 0; pairIndex < size; ++pairIndex)
+  Array<NarrowPhaseChunk> chunks;
+  if(size >= cParallelNarrowPhasePairs && Z::gJobs != nullptr)
+  {
+    chunks.Resize((size + cNarrowPhaseChunkSize - 1) / cNarrowPhaseChunkSize);
+    NarrowPhaseChunkRange chunkRange(mCollisionManager, mManifoldCache, mPossiblePairs, chunks, speculativeDt);
+    Z::gJobs->ParallelFor(0, chunks.Size(), 1, chunkRange);
+  }
+
+  // Go through the pairs in order, taking the results of pairs tested in a
+  // chunk and testing the rest, so the contacts come out the same either way
+  Physics::ManifoldCacheResults cacheResults;
+  for(uint pairIndex = 0; pairIndex < size; ++pairIndex)
   {
     ClientPair* clientPair = &mPossiblePairs[pairIndex];
-    Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
-    Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
-    // Convert the proxy to a collider
-    ColliderPair pair(collider1, collider2);
+    bool collided;
 
-    // Test for collision
-    if(!mCollisionManager->TestCollision(pair, tempManifolds))
+    NarrowPhaseChunk* chunk = chunks.Empty() ? nullptr : &chunks[pairIndex / cNarrowPhaseChunkSize];
+    NarrowPhasePairResult* result = chunk ? &chunk->Pairs[pairIndex % cNarrowPhaseChunkSize] : nullptr;
+    if(result != nullptr && !result->Deferred)
+    {
+      collided = result->Collided;
+      for(uint i = result->ManifoldStart; i < result->ManifoldEnd; ++i)
+        tempManifolds.PushBack(chunk->Manifolds[i]);
+      for(uint i = result->SpeculativeStart; i < result->SpeculativeEnd; ++i)
+        speculativeManifolds.PushBack(chunk->SpeculativeManifolds[i]);
+    }
+    else
+    {
+      // Convert the proxy to a collider
+      Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
+      Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
+      ColliderPair pair(collider1, collider2);
+
+      // Test for collision
+      collided = TestNarrowPhasePair(mCollisionManager, mManifoldCache, pair, speculativeDt,
+                                     tempManifolds, speculativeManifolds, cacheResults);
+    }
+
+    if(!collided)
     {
       tempManifolds.Clear();
       continue;
     }
 
     // If tracking is enabled, we need to record the collision
-    if(mBroadPhase->IsTracking())
+    if(tracking)
     {
       NodePointerPair nodePair(clientPair->mClientData[0],
                                clientPair->mClientData[1]);
@@ -844,6 +1157,15 @@ void PhysicsSpace::NarrowPhase()
     tempManifolds.Clear();
   }
 
+  // Speculative contacts are added after all touching ones
+  for(uint i = 0; i < speculativeManifolds.Size(); ++i)
+    mContactManager->AddManifold(speculativeManifolds[i], true);
+
+  for(uint chunkIndex = 0; chunkIndex < chunks.Size(); ++chunkIndex)
+    mManifoldCache->Commit(chunks[chunkIndex].CacheResults);
+  mManifoldCache->Commit(cacheResults);
+  mManifoldCache->EndFrame();
+
   mBroadPhase->RecordFrameResults(Collisions);
 
   // We have all connections for the frame so build the islands.
@@ -974,6 +1296,59 @@ CastResultsRange PhysicsSpace::CastRay(const Ray& worldRay, uint maxCount, CastF
   return CastResultsRange(results);
 }
 
+void PhysicsSpace::CastRays(RayCastBatch* batch, uint maxCountPerRay)
+{
+  CastFilter filter;
+  CastRays(batch, maxCountPerRay, filter);
+}
+
+void PhysicsSpace::CastRays(RayCastBatch* batch, uint maxCountPerRay, CastFilter& filter)
+{
+  if(batch == nullptr)
+  {
+    DoNotifyException("Invalid batch", "Cannot cast a null RayCastBatch.");
+    return;
+  }
+
+  PushBroadPhaseQueue();
+
+  // Lower than CastResults' limit since every worker keeps a scratch array this large
+  maxCountPerRay = Math::Clamp(maxCountPerRay, 1u, cMaxBatchCountPerRay);
+  uint rayCount = batch->mRays.Size();
+  uint chunkCount = (rayCount + cRayCastChunkSize - 1) / cRayCastChunkSize;
+  batch->mCounts.Resize(rayCount);
+  batch->mOffsets.Resize(rayCount);
+  if(batch->mChunkResults.Size() < chunkCount)
+    batch->mChunkResults.Resize(chunkCount);
+
+  // The filter callback dispatches events so it can only be called from this
+  // thread, and casts against complex shapes are kept on it as well
+  bool parallel = rayCount >= cParallelRayCastCount && Z::gJobs != nullptr &&
+                  filter.mCallbackObject == nullptr && mComplexColliderCount == 0;
+  RayCastBatchRange castRange(mBroadPhase, *batch, maxCountPerRay, filter);
+  if(parallel)
+    Z::gJobs->ParallelFor(0, chunkCount, 1, castRange);
+  else
+    castRange(0, chunkCount);
+
+  // The chunks are in ray order, so appending them packs every ray's results
+  uint resultCount = 0;
+  for(uint rayIndex = 0; rayIndex < rayCount; ++rayIndex)
+  {
+    batch->mOffsets[rayIndex] = resultCount;
+    resultCount += batch->mCounts[rayIndex];
+  }
+
+  batch->mResults.Resize(resultCount);
+  CastResult* packed = batch->mResults.Data();
+  for(uint chunk = 0; chunk < chunkCount; ++chunk)
+  {
+    CastResultArray& chunkResults = batch->mChunkResults[chunk];
+    for(uint i = 0; i < chunkResults.Size(); ++i)
+      *packed++ = chunkResults[i];
+  }
+}
+
 void PhysicsSpace::CastSegment(const Segment& segment, CastResults& results)
 {
   BaseCastFilter& filter = results.mResults.Filter;
@@ -1604,6 +1979,9 @@ void PhysicsSpace::AddComponent(Collider* collider)
     mDynamicColliders.PushBack(collider);
   else
     mStaticColliders.PushBack(collider);
+
+  if(IsComplexCastCollider(collider))
+    ++mComplexColliderCount;
 }
 
 void PhysicsSpace::RemoveComponent(Collider* collider)
@@ -1611,6 +1989,9 @@ void PhysicsSpace::RemoveComponent(Collider* collider)
   mIslandManager->RemoveCollider(collider);
   ColliderList::Unlink(collider);
 
+  if(IsComplexCastCollider(collider))
+    --mComplexColliderCount;
+
   //////////////////////////////////////////////////////////////////////////
   // Doesn't work now because the id we have at this point is already gone.
   // Valid code below for when the id problem is fixed
@@ -12,7 +12,7 @@ namespace Zero
 class BroadPhasePackage;
 typedef Array<Collider*> ColliderArray;
 
-DeclareBitField3(PhysicsSpaceFlags, AllowSleep, Mode2D, Deterministic);
+DeclareBitField5(PhysicsSpaceFlags, AllowSleep, Mode2D, Deterministic, ParallelIslands, CacheManifolds);
 
 namespace Tags
 {
@@ -132,6 +132,21 @@ public:
   /// Performs extra work to help enforce determinism in the simulation.
   bool GetDeterministic() const;
   void SetDeterministic(bool state);
+  /// Solves independent islands on the job system's worker threads.
+  /// Useful for scenes with many separate piles of objects.
+  bool GetParallelIslands() const;
+  void SetParallelIslands(bool state);
+  /// Reuses the contacts of touching pairs that barely moved relative to each
+  /// other instead of running the full collision test every frame. Off by
+  /// default since the reused contacts differ slightly from a full test.
+  bool GetCacheManifolds() const;
+  void SetCacheManifolds(bool state);
+  /// Drops the cached contacts of the collider's pairs (its material or shape changed).
+  void InvalidateCachedManifolds(Collider* collider);
+  /// How many touching pairs reused their cached contacts last frame.
+  uint GetManifoldCacheHits() const;
+  /// How many pairs needed a full collision test last frame.
+  uint GetManifoldCacheMisses() const;
 
   /// Helper for a collider. Returns this space's instance for a CollisionGroup.
   CollisionGroupInstance* GetCollisionGroupInstance(ResourceId groupId) const;
@@ -201,6 +216,15 @@ public:
   /// given filter. This returns up to maxCount number of objects.
   CastResultsRange CastRay(const Ray& worldRay, uint maxCount, CastFilter& filter);
 
+  /// Casts all rays in the batch, each finds up to maxCountPerRay colliders.
+  /// The results are stored in the batch. A default CastFilter will be used.
+  void CastRays(RayCastBatch* batch, uint maxCountPerRay);
+  /// Casts all rays in the batch using the given filter, each finds up to
+  /// maxCountPerRay (at most 1024) colliders. Large batches are cast across
+  /// the job workers unless the filter has a callback object or the space
+  /// has mesh, multi convex mesh or height map colliders.
+  void CastRays(RayCastBatch* batch, uint maxCountPerRay, CastFilter& filter);
+
   //------------------------------------------------------------ Segment Casting
   /// Returns the results of a Segment Cast.  The results of the segment cast
   /// are stored in the passed in vector sorted by time of collision. The
@@ -366,6 +390,7 @@ private:
   Physics::CollisionManager* mCollisionManager;
   Physics::ContactManager* mContactManager;
   Physics::IslandManager* mIslandManager;
+  Physics::ManifoldCache* mManifoldCache;
   // Stores the objects returned from the broad phase for that frame.  It is
   // not created on the stack each frame to avoid allocations.
   ClientPairArray mPossiblePairs;
@@ -390,6 +415,9 @@ private:
   // Separate dynamic and static components to reduce queries.
   ColliderList   mDynamicColliders;
   ColliderList   mStaticColliders;
+  /// Mesh, multi convex mesh and height map colliders (casts
+  /// against them keep ray batches on the calling thread).
+  uint           mComplexColliderCount;
   RegionList     mRegions;
 
   typedef InList<PhysicsCar, &PhysicsCar::SpaceLink> CarList;
@@ -33,6 +33,7 @@ ZilchDefineEnum(PhysicsSolverSubType);
 ZilchDefineEnum(PhysicsIslandType);
 ZilchDefineEnum(PhysicsIslandPreProcessingMode);
 ZilchDefineEnum(PhysicsContactTangentTypes);
+ZilchDefineEnum(PhysicsContinuousCollisionMode);
 ZilchDefineEnum(JointFrameOfReference);
 ZilchDefineEnum(AxisDirection);
 ZilchDefineEnum(PhysicsEffectInterpolationType);
@@ -44,6 +45,7 @@ ZilchDefineEnum(CollisionFilterBlockType);
 ZilchDefineEnum(SpringDebugDrawMode);
 ZilchDefineEnum(SpringDebugDrawType);
 ZilchDefineEnum(SpringSortOrder);
+ZilchDefineEnum(MeshBvhLayout);
 
 // Bind the joint types special because they're generated using the #define #include trick
 ZilchDefineExternalBaseType(JointTypes::Enum, TypeCopyMode::ValueType, builder, type)
@@ -82,6 +84,7 @@ ZilchDefineStaticLibrary(PhysicsLibrary)
   ZilchInitializeEnum(PhysicsIslandType);
   ZilchInitializeEnum(PhysicsIslandPreProcessingMode);
   ZilchInitializeEnum(PhysicsContactTangentTypes);
+  ZilchInitializeEnum(PhysicsContinuousCollisionMode);
   ZilchInitializeEnum(JointFrameOfReference);
   ZilchInitializeEnum(AxisDirection);
   ZilchInitializeEnum(PhysicsEffectInterpolationType);
@@ -93,6 +96,7 @@ ZilchDefineStaticLibrary(PhysicsLibrary)
   ZilchInitializeEnum(SpringDebugDrawMode);
   ZilchInitializeEnum(SpringDebugDrawType);
   ZilchInitializeEnum(SpringSortOrder);
+  ZilchInitializeEnum(MeshBvhLayout);
   ZilchInitializeEnum(JointTypes);
 
   // Meta Components
@@ -196,6 +200,7 @@ ZilchDefineStaticLibrary(PhysicsLibrary)
   ZilchInitializeType(CastFilter);
   ZilchInitializeType(CastResult);
   ZilchInitializeType(CastResults);
+  ZilchInitializeType(RayCastBatch);
   ZilchInitializeType(SweepResult);
 
   // Misc
@@ -61,6 +61,7 @@ public:
 #include "CollisionTable.hpp"
 #include "Physics/PhysicsMeshBoundData.hpp"
 #include "GenericPhysicsMesh.hpp"
+#include "MeshBvh.hpp"
 #include "ConvexMesh.hpp"
 #include "MultiConvexMesh.hpp"
 #include "PhysicsMesh.hpp"
@@ -146,6 +147,7 @@ public:
 #include "Joints/TemplatedFragments.hpp"
 #include "Joints/ThreadedFragments.hpp"
 #include "Joints/ThreadedSolver.hpp"
+#include "Joints/WideContactSolver.hpp"
 
 #include "RayCast.hpp"
 #include "Manifold.hpp"
@@ -156,6 +158,8 @@ public:
 // NarrowPhase
 #include "CollisionManager.hpp"
 #include "ContactManager.hpp"
+#include "ManifoldCache.hpp"
+#include "SpeculativeContacts.hpp"
 #include "CustomCollisionEventTracker.hpp"
 #include "TimeOfImpact.hpp"
 
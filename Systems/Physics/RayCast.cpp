@@ -360,4 +360,78 @@ uint CastResultsRange::Size()
   return mRange.Size();
 }
 
+//------------------------------------------------------------RayCastBatch
+ZilchDefineType(RayCastBatch, builder, type)
+{
+  type->CreatableInScript = true;
+
+  ZeroBindDocumented();
+  ZilchBindDefaultCopyDestructor();
+
+  ZilchBindMethod(AddRay);
+  ZilchBindMethod(Clear);
+  ZilchBindGetterProperty(RayCount);
+  ZilchBindMethod(GetResultCount);
+  ZilchBindMethod(GetResult);
+  ZilchBindMethod(GetFirst);
+}
+
+RayCastBatch::RayCastBatch()
+{
+}
+
+uint RayCastBatch::AddRay(const Ray& worldRay)
+{
+  mRays.PushBack(worldRay);
+  return mRays.Size() - 1;
+}
+
+void RayCastBatch::Clear()
+{
+  mRays.Clear();
+  mResults.Clear();
+  mOffsets.Clear();
+  mCounts.Clear();
+}
+
+uint RayCastBatch::GetRayCount()
+{
+  return mRays.Size();
+}
+
+uint RayCastBatch::GetResultCount(uint rayIndex)
+{
+  if(rayIndex >= mCounts.Size())
+    return 0;
+  return mCounts[rayIndex];
+}
+
+CastResult RayCastBatch::GetResult(uint rayIndex, uint resultIndex)
+{
+  if(resultIndex >= GetResultCount(rayIndex))
+  {
+    String msg = String::Format("Ray %d has no result at index %d", rayIndex, resultIndex);
+    DoNotifyException("Invalid index", msg);
+    return CastResult();
+  }
+  return mResults[mOffsets[rayIndex] + resultIndex];
+}
+
+CastResult RayCastBatch::GetFirst(uint rayIndex)
+{
+  if(GetResultCount(rayIndex) == 0)
+    return CastResult();
+  return mResults[mOffsets[rayIndex]];
+}
+
+CastResultArray::range RayCastBatch::GetResults(uint rayIndex)
+{
+  uint count = GetResultCount(rayIndex);
+  if(count == 0)
+    return CastResultArray::range(mResults.Begin(), mResults.Begin());
+
+  CastResult* begin = mResults.Begin() + mOffsets[rayIndex];
+  return CastResultArray::range(begin, begin + count);
+}
+
 }//namespace Zero
@@ -189,4 +189,40 @@ struct CastResultsRange
   CastResultArray mArray;
 };
 
+//-------------------------------------------------------------------RayCastBatch
+/// Rays cast together with PhysicsSpace::CastRays (across the job workers
+/// for large batches). The results of every ray are packed into one array
+/// that is reused, so casting a batch again every frame doesn't allocate.
+class RayCastBatch
+{
+public:
+  ZilchDeclareType(TypeCopyMode::ReferenceType);
+
+  RayCastBatch();
+
+  /// Adds a world-space ray to the batch. Returns the index of the ray.
+  uint AddRay(const Ray& worldRay);
+  /// Removes all rays (and their results) from the batch.
+  void Clear();
+  /// The number of rays in the batch.
+  uint GetRayCount();
+
+  /// How many colliders the ray at the given index hit in the last cast.
+  uint GetResultCount(uint rayIndex);
+  /// The result of the ray at the given index, sorted by distance.
+  CastResult GetResult(uint rayIndex, uint resultIndex);
+  /// The closest result of the ray at the given index (empty if nothing was hit).
+  CastResult GetFirst(uint rayIndex);
+  /// All results of the ray at the given index, sorted by distance.
+  CastResultArray::range GetResults(uint rayIndex);
+
+  Array<Ray> mRays;
+  /// The results of every ray in ray order, ray i's start at mOffsets[i].
+  CastResultArray mResults;
+  Array<uint> mOffsets;
+  Array<uint> mCounts;
+  /// Results of each chunk of rays while they're being cast.
+  Array<CastResultArray> mChunkResults;
+};
+
 }//namespace Zero
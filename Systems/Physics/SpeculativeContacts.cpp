@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+// A pair only gets speculative contacts if it moves further than this
+// fraction of the smaller collider's bounding radius in one step
+// (slower pairs are caught by the normal collision detection).
+const real cSpeculativeMotionRatio = real(0.25);
+
+// A collider moved by its step's motion: the convex hull of the collider
+// at the start and at the end of the step (a collider swept along a line).
+struct SweptSupportData
+{
+  Intersection::SupportShape* mShape;
+  Vec3 mMotion;
+};
+
+void SweptSupport(const Intersection::SupportShape* shape, void* data, Vec3Param direction, Vec3Ptr support)
+{
+  SweptSupportData* sweptData = static_cast<SweptSupportData*>(data);
+  sweptData->mShape->Support(direction, support);
+  if(Math::Dot(sweptData->mMotion, direction) > real(0.0))
+    *support += sweptData->mMotion;
+}
+
+Vec3 GetBodyVelocity(Collider* collider)
+{
+  RigidBody* body = collider->GetActiveBody();
+  if(body == nullptr)
+    return Vec3::cZero;
+  return body->mVelocity;
+}
+
+bool IsSpeculativeType(Collider* collider)
+{
+  // Only the convex types have a support function
+  return collider->mType <= Collider::cConvexMesh;
+}
+
+real GetSpeculativeDt(PhysicsSpace* space)
+{
+  if(space == nullptr)
+    return real(0.0);
+
+  PhysicsSolverConfig* config = space->GetPhysicsSolverConfig();
+  if(config == nullptr || config->mContinuousCollisionMode != PhysicsContinuousCollisionMode::Speculative)
+    return real(0.0);
+  return space->mIterationDt;
+}
+
+void ExpandSpeculativeBroadPhaseData(Collider* collider, real dt, BroadPhaseData& data)
+{
+  if(dt == real(0.0) || !IsSpeculativeType(collider))
+    return;
+
+  Vec3 motion = GetBodyVelocity(collider) * dt;
+  real distance = motion.Length();
+  if(distance <= cSpeculativeMotionRatio * collider->mBoundingSphere.mRadius)
+    return;
+
+  Aabb movedAabb = data.mAabb;
+  movedAabb.Translate(motion);
+  data.mAabb.Combine(movedAabb);
+
+  data.mBoundingSphere.mCenter += motion * real(0.5);
+  data.mBoundingSphere.mRadius += distance * real(0.5);
+}
+
+bool SpeculativeCollision(ColliderPair& pair, real dt, ManifoldArray& manifolds)
+{
+  Collider* colliderA = pair.A;
+  Collider* colliderB = pair.B;
+  if(!IsSpeculativeType(colliderA) || !IsSpeculativeType(colliderB))
+    return false;
+
+  // Everything is done in B's frame: A moves by the relative motion
+  Vec3 motion = (GetBodyVelocity(colliderA) - GetBodyVelocity(colliderB)) * dt;
+  real minRadius = Math::Min(colliderA->mBoundingSphere.mRadius, colliderB->mBoundingSphere.mRadius);
+  if(motion.LengthSq() <= Math::Sq(cSpeculativeMotionRatio * minRadius))
+    return false;
+
+  // Ghosts never resolve so there's nothing to stop
+  if(colliderA->GetGhost() || colliderB->GetGhost())
+    return false;
+  if(!colliderA->ShouldCollide(colliderB))
+    return false;
+
+  Intersection::SupportShape shapeA = colliderA->GetSupportShape();
+  Intersection::SupportShape shapeB = colliderB->GetSupportShape();
+
+  SweptSupportData sweptData;
+  sweptData.mShape = &shapeA;
+  sweptData.mMotion = motion;
+  Vec3 centerA;
+  shapeA.GetCenter(&centerA);
+  Intersection::SupportShape sweptA(centerA + motion * real(0.5), &SweptSupport, &sweptData);
+
+  // If A swept over the step doesn't hit B then they can't touch this step
+  Intersection::Mpr mpr;
+  Intersection::Manifold iManifold;
+  if(mpr.Test(&sweptA, &shapeB, &iManifold) < (Intersection::Type)0)
+    return false;
+  FlipSupportShapeManifoldInfo(sweptA, shapeB, &iManifold);
+
+  // Only pairs closing along the normal need a speculative contact
+  Vec3 normal = iManifold.Normal;
+  if(Math::Dot(motion, normal) <= real(0.0))
+    return false;
+
+  // The closest features of the un-swept shapes along the normal. Their
+  // distance along the normal is a lower bound of the actual gap, so the
+  // contact is conservative (it may stop the bodies a little early).
+  ManifoldPoint point;
+  shapeA.Support(normal, &point.WorldPoints[0]);
+  shapeB.Support(-normal, &point.WorldPoints[1]);
+  point.Normal = normal;
+  point.Penetration = Math::Dot(point.WorldPoints[0] - point.WorldPoints[1], normal);
+
+  Manifold* manifold = &manifolds.PushBack();
+  manifold->ContactId = 0;
+  manifold->SetPair(pair);
+  manifold->ContactCount = 0;
+  manifold->SetPolicy(AddingPolicy::NormalManifold);
+  manifold->AddPoints(&point, 1);
+  return true;
+}
+
+}//namespace Physics
+
+}//namespace Zero
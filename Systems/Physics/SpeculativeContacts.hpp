@@ -0,0 +1,35 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+/// Speculative contacts are the continuous collision of the solver. A fast
+/// body that isn't touching something yet, but will reach it by the end of the
+/// step, gets a contact with a negative penetration (the gap). The contact only
+/// pushes back once the bodies would close more than the gap in one step, so the
+/// body is stopped at the surface instead of tunneling through it.
+
+/// The step size to use for speculative contacts in the given space, 0 if
+/// the space's solver config has them turned off.
+real GetSpeculativeDt(PhysicsSpace* space);
+
+/// Grows the broad phase data of a fast collider to cover where
+/// its body's velocity will move it over the step.
+void ExpandSpeculativeBroadPhaseData(Collider* collider, real dt, BroadPhaseData& data);
+
+/// Tests a pair that isn't touching for a speculative contact. Only convex
+/// pairs that move fast relative to their size are tested. Read only, so
+/// different pairs can be tested from different threads.
+bool SpeculativeCollision(ColliderPair& pair, real dt, ManifoldArray& manifolds);
+
+}//namespace Physics
+
+}//namespace Zero
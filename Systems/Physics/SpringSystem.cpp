@@ -71,6 +71,34 @@ void PointGraph::Build()
     }
   }
 }
+//-------------------------------------------------------------------SpringEdgeBatchRange
+// Systems with fewer edges than this solve them one at a time in order (the
+// order matters most for ropes, where sorted edges propagate from the anchors)
+const uint cSpringBatchMinEdges = 256;
+// A point can be in at most this many batches, other edges are solved one at a time
+const uint cSpringMaxBatches = 64;
+// Batches with fewer edges than this are solved on the calling thread
+const uint cParallelSpringEdges = 1024;
+const uint cSpringEdgeGrainSize = 256;
+
+// Solves a range of 4 edge groups of one batch. None of a batch's
+// edges share a point so any ranges can be solved at the same time.
+struct SpringEdgeBatchRange
+{
+  SpringEdgeBatchRange(SpringSystem* system, uint batchStart)
+    : mSystem(system), mBatchStart(batchStart)
+  {
+  }
+
+  void operator()(uint startGroup, uint endGroup)
+  {
+    mSystem->SolveEdgeBatch(mBatchStart + startGroup * 4, mBatchStart + endGroup * 4);
+  }
+
+  SpringSystem* mSystem;
+  uint mBatchStart;
+};
+
 //-------------------------------------------------------------------
 
 ZilchDefineType(SpringSystem, builder, type)
@@ -349,17 +377,26 @@ void SpringSystem::SolveSpringForces()
 
 void SpringSystem::RelaxSprings()
 {
-  //solve all internal edges
-  for(uint i = 0; i < mEdges.Size(); ++i)
+  //solve all internal edges, a batch at a time
+  EdgeBatches& batches = mEdgeBatches;
+  for(uint batch = 0; batch + 1 < batches.mStarts.Size(); ++batch)
   {
-    Edge& edge = mEdges[i];
-
-    PointMass& p0 = mPointMasses[edge.mIndex0];
-    PointMass& p1 = mPointMasses[edge.mIndex1];
-
-    SolveEdge(p0, p1, edge.mRestLength);
+    uint start = batches.mStarts[batch];
+    uint end = batches.mStarts[batch + 1];
+    uint edgeCount = end - start;
+    if(edgeCount >= cParallelSpringEdges && Z::gJobs != nullptr)
+    {
+      SpringEdgeBatchRange batchRange(this, start);
+      Z::gJobs->ParallelFor(0, edgeCount / 4, cSpringEdgeGrainSize / 4, batchRange);
+    }
+    else
+      SolveEdgeBatch(start, end);
   }
 
+  //the edges that aren't in a batch are solved in order
+  for(uint i = batches.mSerialStart; i < batches.mIndex0.Size(); ++i)
+    SolveEdge(mSolverPoints, batches.mIndex0[i], mSolverPoints, batches.mIndex1[i], batches.mRestLength[i]);
+
   //solve all connected edges (only the ones we own to avoid a double solve)
   for(OwnedEdgeList::range range = mOwnedEdges.All(); !range.Empty(); range.PopFront())
   {
@@ -369,24 +406,28 @@ void SpringSystem::RelaxSprings()
     {
       Edge& edge = connection.mEdges[edgeIndex];
       
-      PointMass& p0 = connection.mOwningSystem->mPointMasses[edge.mIndex0];
-      PointMass& p1 = connection.mOtherSystem->mPointMasses[edge.mIndex1];
+      SolverPoints& points0 = connection.mOwningSystem->mSolverPoints;
+      SolverPoints& points1 = connection.mOtherSystem->mSolverPoints;
     
-      SolveEdge(p0, p1, edge.mRestLength);
+      SolveEdge(points0, edge.mIndex0, points1, edge.mIndex1, edge.mRestLength);
     }
   }
 }
 
-void SpringSystem::SolveEdge(PointMass& p0, PointMass& p1, real restLength)
+void SpringSystem::SolveEdge(SolverPoints& points0, uint index0, SolverPoints& points1, uint index1, real restLength)
 {
-  real invMassSum = p1.mInvMass + p0.mInvMass;
+  real invMass0 = points0.mInvMass[index0];
+  real invMass1 = points1.mInvMass[index1];
+  real invMassSum = invMass1 + invMass0;
   //should pre-sort the edges so we don't solve ones with a zero inverse sum
   if(invMassSum == 0)
     return;
 
   //based up a Jakobsen spring which is corrected by just snapping each
   //particle to be at the rest length (after doing mass ratios and whatnot)
-  Vec3 posDiff = p1.mPosition - p0.mPosition;
+  Vec3 p0(points0.mX[index0], points0.mY[index0], points0.mZ[index0]);
+  Vec3 p1(points1.mX[index1], points1.mY[index1], points1.mZ[index1]);
+  Vec3 posDiff = p1 - p0;
   real length = posDiff.Length();
   if(length == real(0.0))
     return;
@@ -396,8 +437,207 @@ void SpringSystem::SolveEdge(PointMass& p0, PointMass& p1, real restLength)
 
   Vec3 impulse = posDiff * diff * mCorrectionPercent;
 
-  p0.mPosition -= p0.mInvMass * impulse;
-  p1.mPosition += p1.mInvMass * impulse;
+  p0 -= invMass0 * impulse;
+  p1 += invMass1 * impulse;
+  points0.mX[index0] = p0.x;
+  points0.mY[index0] = p0.y;
+  points0.mZ[index0] = p0.z;
+  points1.mX[index1] = p1.x;
+  points1.mY[index1] = p1.y;
+  points1.mZ[index1] = p1.z;
+}
+
+void SpringSystem::SolveEdgeBatch(uint start, uint end)
+{
+  using namespace Math::Simd;
+
+  SolverPoints& points = mSolverPoints;
+  EdgeBatches& batches = mEdgeBatches;
+  SimVec zero = ZeroOutVec();
+  SimVec one = Set(real(1.0));
+  SimVec correctionPercent = Set(mCorrectionPercent);
+
+  real x0[4], y0[4], z0[4], w0[4];
+  real x1[4], y1[4], z1[4], w1[4];
+  for(uint i = start; i < end; i += 4)
+  {
+    const uint* indices0 = &batches.mIndex0[i];
+    const uint* indices1 = &batches.mIndex1[i];
+
+    //gather the points of the 4 edges into the lanes
+    for(uint lane = 0; lane < 4; ++lane)
+    {
+      uint index0 = indices0[lane];
+      uint index1 = indices1[lane];
+      x0[lane] = points.mX[index0];
+      y0[lane] = points.mY[index0];
+      z0[lane] = points.mZ[index0];
+      w0[lane] = points.mInvMass[index0];
+      x1[lane] = points.mX[index1];
+      y1[lane] = points.mY[index1];
+      z1[lane] = points.mZ[index1];
+      w1[lane] = points.mInvMass[index1];
+    }
+
+    SimVec px0 = UnAlignedLoad(x0);
+    SimVec py0 = UnAlignedLoad(y0);
+    SimVec pz0 = UnAlignedLoad(z0);
+    SimVec invMass0 = UnAlignedLoad(w0);
+    SimVec px1 = UnAlignedLoad(x1);
+    SimVec py1 = UnAlignedLoad(y1);
+    SimVec pz1 = UnAlignedLoad(z1);
+    SimVec invMass1 = UnAlignedLoad(w1);
+
+    //the same Jakobsen correction as SolveEdge
+    SimVec dx = Subtract(px1, px0);
+    SimVec dy = Subtract(py1, py0);
+    SimVec dz = Subtract(pz1, pz0);
+    SimVec length = Sqrt(MultiplyAdd(dz, dz, MultiplyAdd(dy, dy, Multiply(dx, dx))));
+    SimVec invMassSum = Add(invMass0, invMass1);
+
+    //lanes with no mass or no length (including the padding) don't move, they
+    //divide by one instead of zero and then have their correction masked off
+    SimVec valid = AndVec(Greater(invMassSum, zero), Greater(length, zero));
+    SimVec denominator = Select(one, Multiply(length, invMassSum), valid);
+    SimVec restLength = UnAlignedLoad(&batches.mRestLength[i]);
+    SimVec diff = Divide(Subtract(restLength, length), denominator);
+    diff = AndVec(Multiply(diff, correctionPercent), valid);
+
+    SimVec impulseX = Multiply(dx, diff);
+    SimVec impulseY = Multiply(dy, diff);
+    SimVec impulseZ = Multiply(dz, diff);
+    UnAlignedStore(Subtract(px0, Multiply(invMass0, impulseX)), x0);
+    UnAlignedStore(Subtract(py0, Multiply(invMass0, impulseY)), y0);
+    UnAlignedStore(Subtract(pz0, Multiply(invMass0, impulseZ)), z0);
+    UnAlignedStore(MultiplyAdd(invMass1, impulseX, px1), x1);
+    UnAlignedStore(MultiplyAdd(invMass1, impulseY, py1), y1);
+    UnAlignedStore(MultiplyAdd(invMass1, impulseZ, pz1), z1);
+
+    //scatter the results back (the padding only ever writes the massless point)
+    for(uint lane = 0; lane < 4; ++lane)
+    {
+      uint index0 = indices0[lane];
+      uint index1 = indices1[lane];
+      points.mX[index0] = x0[lane];
+      points.mY[index0] = y0[lane];
+      points.mZ[index0] = z0[lane];
+      points.mX[index1] = x1[lane];
+      points.mY[index1] = y1[lane];
+      points.mZ[index1] = z1[lane];
+    }
+  }
+}
+
+void SpringSystem::GatherSolverPoints()
+{
+  EdgeBatches& batches = mEdgeBatches;
+  if(batches.mStarts.Empty() || batches.mPointCount != mPointMasses.Size() ||
+     batches.mEdgeCount != mEdges.Size())
+    BuildEdgeBatches();
+
+  uint pointCount = mPointMasses.Size();
+  mSolverPoints.Resize(pointCount + 1);
+  for(uint i = 0; i < pointCount; ++i)
+  {
+    PointMass& p = mPointMasses[i];
+    mSolverPoints.mX[i] = p.mPosition.x;
+    mSolverPoints.mY[i] = p.mPosition.y;
+    mSolverPoints.mZ[i] = p.mPosition.z;
+    mSolverPoints.mInvMass[i] = p.mInvMass;
+  }
+
+  //the massless point used by the padding edges
+  mSolverPoints.mX[pointCount] = real(0.0);
+  mSolverPoints.mY[pointCount] = real(0.0);
+  mSolverPoints.mZ[pointCount] = real(0.0);
+  mSolverPoints.mInvMass[pointCount] = real(0.0);
+}
+
+void SpringSystem::ScatterSolverPoints()
+{
+  for(uint i = 0; i < mPointMasses.Size(); ++i)
+  {
+    PointMass& p = mPointMasses[i];
+    p.mPosition.Set(mSolverPoints.mX[i], mSolverPoints.mY[i], mSolverPoints.mZ[i]);
+  }
+}
+
+void SpringSystem::BuildEdgeBatches()
+{
+  EdgeBatches& batches = mEdgeBatches;
+  batches.mIndex0.Clear();
+  batches.mIndex1.Clear();
+  batches.mRestLength.Clear();
+  batches.mStarts.Clear();
+
+  uint edgeCount = mEdges.Size();
+  uint padIndex = mPointMasses.Size();
+  batches.mPointCount = padIndex;
+  batches.mEdgeCount = edgeCount;
+
+  //greedily put each edge (in the sorted order) into the first batch that neither
+  //of its points is in yet, the bits of each point are the batches it's in
+  Array<uint> edgeBatches;
+  edgeBatches.Resize(edgeCount, cSpringMaxBatches);
+  Array<uint> batchSizes;
+  if(edgeCount >= cSpringBatchMinEdges)
+  {
+    Array<u64> pointBatches;
+    pointBatches.Resize(mPointMasses.Size(), 0);
+    for(uint i = 0; i < edgeCount; ++i)
+    {
+      Edge& edge = mEdges[i];
+      u64 used = pointBatches[edge.mIndex0] | pointBatches[edge.mIndex1];
+      for(uint batch = 0; batch < cSpringMaxBatches; ++batch)
+      {
+        u64 bit = u64(1) << batch;
+        if(used & bit)
+          continue;
+
+        pointBatches[edge.mIndex0] |= bit;
+        pointBatches[edge.mIndex1] |= bit;
+        edgeBatches[i] = batch;
+        if(batch >= batchSizes.Size())
+          batchSizes.Resize(batch + 1, 0);
+        ++batchSizes[batch];
+        break;
+      }
+    }
+  }
+
+  //lay out the batches (each padded to a multiple of 4) followed by the serial edges
+  Array<uint> offsets;
+  offsets.Resize(batchSizes.Size());
+  uint offset = 0;
+  for(uint batch = 0; batch < batchSizes.Size(); ++batch)
+  {
+    batches.mStarts.PushBack(offset);
+    offsets[batch] = offset;
+    offset += (batchSizes[batch] + 3) & ~3u;
+  }
+  batches.mSerialStart = offset;
+  batches.mStarts.PushBack(offset);
+
+  batches.mIndex0.Resize(offset, padIndex);
+  batches.mIndex1.Resize(offset, padIndex);
+  batches.mRestLength.Resize(offset, real(0.0));
+  for(uint i = 0; i < edgeCount; ++i)
+  {
+    Edge& edge = mEdges[i];
+    uint batch = edgeBatches[i];
+    if(batch == cSpringMaxBatches)
+    {
+      batches.mIndex0.PushBack(edge.mIndex0);
+      batches.mIndex1.PushBack(edge.mIndex1);
+      batches.mRestLength.PushBack(edge.mRestLength);
+      continue;
+    }
+
+    uint index = offsets[batch]++;
+    batches.mIndex0[index] = edge.mIndex0;
+    batches.mIndex1[index] = edge.mIndex1;
+    batches.mRestLength[index] = edge.mRestLength;
+  }
 }
 
 void SpringSystem::UpdateVelocities(real dt)
@@ -444,6 +684,7 @@ SpringSystem::Edge& SpringSystem::AddEdge(uint index0, uint index1, real errCorr
   Vec3 pos1 = mPointMasses[index1].mPosition;
   Edge& edge = mEdges.PushBack();
   edge.Set(index0, index1, pos0, pos1);
+  mEdgeBatches.mStarts.Clear();
   //To help with certain systems (ropes) it's useful to add a correction term to improve stiffness.
   //This is because each link will have a small amount of error so shortening each
   //edge by a small percentage will help to mitigate that error.
@@ -456,6 +697,7 @@ void SpringSystem::AddPointMass(Vec3Param position)
   PointMass point;
   point.mOldPosition = point.mPosition = position;
   mPointMasses.PushBack(point);
+  mEdgeBatches.mStarts.Clear();
 }
 
 void SpringSystem::SetPointMassAnchor(uint index, Cog* anchorCog)
@@ -676,6 +918,7 @@ void SpringSystem::SortEdges()
     newEdge.mIndex1AnchorDistance = edges[i].mPoint1->mDistanceFromAnchor;
   }
   mEdges.Swap(newEdges);
+  mEdgeBatches.mStarts.Clear();
 }
 
 SpringDebugDrawMode::Enum SpringSystem::GetDebugDrawMode()
@@ -738,6 +981,14 @@ bool SpringSystem::Cast(RayParam ray, Face& resultFace, Vec3Ref intersectionPoin
 }
 
 //-------------------------------------------------------------------SpringSystem::PointMass
+void SpringSystem::SolverPoints::Resize(uint pointCount)
+{
+  mX.Resize(pointCount);
+  mY.Resize(pointCount);
+  mZ.Resize(pointCount);
+  mInvMass.Resize(pointCount);
+}
+
 void SpringSystem::PointMass::Serialize(Serializer& stream)
 {
   SerializeNameDefault(mInitialOffset, Vec3::cZero);
@@ -925,6 +1176,7 @@ void DecorativeCloth::LoadPointMeshData(const Array<Vec3>& verts, bool clearOldD
 
   if(mPointMasses.Size() != verts.Size())
     mPointMasses.Resize(verts.Size());
+  mEdgeBatches.mStarts.Clear();
 
   Transform* t = GetOwner()->has(Transform);
 
@@ -943,6 +1195,7 @@ void DecorativeCloth::LoadFromMeshData(const Array<Vec3>& verts, const Array<uin
   LoadPointMeshData(verts, clearOldData);
 
   mEdges.Clear();
+  mEdgeBatches.mStarts.Clear();
   mFaces.Clear();
 
   PointGraph graph;
@@ -1177,6 +1430,7 @@ void DecorativeRope::CreateLinks()
 
   mPointMasses.Clear();
   mEdges.Clear();
+  mEdgeBatches.mStarts.Clear();
 
   //Since we might connect to another object or a spring system, we might not actually
   //create all of the normal links. If we're connected to a spring system we'll
@@ -1255,6 +1509,7 @@ void SpringGroup::Solve(PhysicsSpace* space, real dt)
     ApplyGlobalEffects(space, &system);
     system.IntegrateVelocity(dt);
     system.IntegratePosition(dt);
+    system.GatherSolverPoints();
   }
 
   //solve the springs together (it's important that this is interleaved)
@@ -1277,6 +1532,7 @@ void SpringGroup::Solve(PhysicsSpace* space, real dt)
   {
     SpringSystem& system = range.Front();
 
+    system.ScatterSolverPoints();
     system.UpdateVelocities(dt);
     system.Commit();
   }
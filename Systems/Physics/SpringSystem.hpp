@@ -75,6 +75,7 @@ public:
   struct Edge;
   struct Face;
   struct SystemConnection;
+  struct SolverPoints;
 
   /// Small helper to remove a connection between spring systems.
   void RemoveConnection(SystemConnection* connection);
@@ -88,9 +89,18 @@ public:
   void SolveSpringForces();
   /// Iterate through all edges, iteratively solving them,
   /// to try to relax the system to a better global solution.
+  /// Only valid between GatherSolverPoints and ScatterSolverPoints.
   void RelaxSprings();
   /// Solve one edge to be at the exact rest length based upon the mass ratio of the points.
-  void SolveEdge(PointMass& p0, PointMass& p1, real restLength);
+  void SolveEdge(SolverPoints& points0, uint index0, SolverPoints& points1, uint index1, real restLength);
+  /// Solve the batched edges in [start, end) four at a time (start and end are multiples of 4).
+  void SolveEdgeBatch(uint start, uint end);
+  /// Copy the point masses into the solver points (and rebuild the edge batches if needed).
+  void GatherSolverPoints();
+  /// Copy the relaxed positions back to the point masses.
+  void ScatterSolverPoints();
+  /// Group the edges into batches that don't share any points.
+  void BuildEdgeBatches();
   /// Approximate the velocity of a point based upon its old position and new position.
   void UpdateVelocities(real dt);
   void IntegrateVelocity(real dt);
@@ -210,6 +220,40 @@ public:
   typedef Array<Edge> Edges;
   Edges mEdges;
 
+  /// The point mass positions and inverse masses in structure of array form while
+  /// the springs are relaxed. There's one extra point with no mass at the end
+  /// that the padding edges of the batches use.
+  struct SolverPoints
+  {
+    void Resize(uint pointCount);
+
+    Array<real> mX;
+    Array<real> mY;
+    Array<real> mZ;
+    Array<real> mInvMass;
+  };
+  SolverPoints mSolverPoints;
+
+  /// The edges in the order they're solved. Edges in the same batch never share a
+  /// point, so a batch is solved 4 edges at a time with simd (each batch is padded
+  /// to a multiple of 4) and large batches are split across the job workers.
+  /// The edges after mSerialStart didn't fit in a batch and are solved one at a time.
+  struct EdgeBatches
+  {
+    Array<uint> mIndex0;
+    Array<uint> mIndex1;
+    Array<real> mRestLength;
+    /// Where each batch starts followed by mSerialStart. Empty when the
+    /// edges or points have changed and the batches need to be rebuilt.
+    Array<uint> mStarts;
+    uint mSerialStart;
+    /// The point and edge counts the batches were built with. The padding
+    /// edges point at the point one past the last, so any change rebuilds.
+    uint mPointCount;
+    uint mEdgeCount;
+  };
+  EdgeBatches mEdgeBatches;
+
   /// A triangle face for the mesh. Used to update for rendering and also to apply
   /// several physics effects that are based upon the hit surface area.
   struct Face
@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file FlatHashMapTest.cpp
+///  Unit tests and timings for FlatHashMap and FlatHashSet.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Containers/HashMap.hpp"
+#include "Containers/FlatHashMap.hpp"
+#include "Containers/FlatHashSet.hpp"
+#include "String/ToString.hpp"
+
+#include "WindowsDebugTimer.hpp"
+
+using Zero::FlatHashMap;
+using Zero::FlatHashSet;
+using Zero::HashMap;
+using Zero::String;
+
+TEST(FlatHashMap_InsertFind)
+{
+  FlatHashMap<int, int> map;
+  for(int i = 0; i < 1000; ++i)
+    map.Insert(i, i * 2);
+
+  CHECK_EQUAL(1000, map.Size());
+  for(int i = 0; i < 1000; ++i)
+    CHECK_EQUAL(i * 2, map.FindValue(i, -1));
+
+  CHECK_EQUAL(-1, map.FindValue(1000, -1));
+  CHECK(map.FindPointer(-5) == nullptr);
+  CHECK(map.Find(1001).Empty());
+  CHECK_EQUAL(4, map.Find(2).Front().second);
+}
+
+TEST(FlatHashMap_Overwrite)
+{
+  FlatHashMap<int, int> map;
+  CHECK(map.Insert(5, 1).mIsNewInsert);
+  CHECK(!map.Insert(5, 2).mIsNewInsert);
+  CHECK_EQUAL(2, map[5]);
+
+  CHECK(!map.InsertNoOverwrite(5, 3).mIsNewInsert);
+  CHECK_EQUAL(2, map[5]);
+  CHECK_EQUAL(1, map.Size());
+
+  map[7] = 9;
+  CHECK_EQUAL(9, map.FindValue(7, 0));
+  CHECK_EQUAL(2, map.Size());
+}
+
+TEST(FlatHashMap_Erase)
+{
+  FlatHashMap<int, int> map;
+  for(int i = 0; i < 500; ++i)
+    map.Insert(i, i);
+
+  // Erasing shifts probe runs back, every remaining key must still be found
+  for(int i = 0; i < 500; i += 3)
+    CHECK(map.Erase(i));
+  CHECK(!map.Erase(0));
+
+  for(int i = 0; i < 500; ++i)
+  {
+    bool erased = (i % 3) == 0;
+    CHECK_EQUAL(!erased, map.ContainsKey(i));
+  }
+
+  // Re-insert into the shifted table
+  for(int i = 0; i < 500; i += 3)
+    map.Insert(i, -i);
+  CHECK_EQUAL(500, map.Size());
+  CHECK_EQUAL(-3, map.FindValue(3, 0));
+}
+
+TEST(FlatHashMap_Range)
+{
+  FlatHashMap<int, int> map;
+  for(int i = 0; i < 100; ++i)
+    map.Insert(i, 1);
+
+  int count = 0;
+  int sum = 0;
+  forRange(auto& pair, map.All())
+  {
+    ++count;
+    sum += pair.second;
+  }
+  CHECK_EQUAL(100, count);
+  CHECK_EQUAL(100, sum);
+
+  int keySum = 0;
+  forRange(int key, map.Keys())
+    keySum += key;
+  CHECK_EQUAL(4950, keySum);
+
+  map.Clear();
+  CHECK(map.All().Empty());
+  CHECK(map.Empty());
+}
+
+TEST(FlatHashMap_StringKeys)
+{
+  FlatHashMap<String, int> map;
+  for(int i = 0; i < 256; ++i)
+    map.Insert(Zero::ToString(i), i);
+
+  for(int i = 0; i < 256; ++i)
+    CHECK_EQUAL(i, map.FindValue(Zero::ToString(i), -1));
+
+  FlatHashMap<String, int> copy(map);
+  CHECK_EQUAL(256, copy.Size());
+  CHECK_EQUAL(42, copy.FindValue("42", -1));
+}
+
+TEST(FlatHashSet_Basic)
+{
+  FlatHashSet<int> set;
+  for(int i = 0; i < 100; ++i)
+    set.Insert(i * 7);
+
+  CHECK_EQUAL(100, set.Size());
+  CHECK(set.Contains(14));
+  CHECK(!set.Contains(15));
+
+  set.Erase(14);
+  CHECK(!set.Contains(14));
+  CHECK_EQUAL(99, set.Size());
+  CHECK(!set.InsertNoOverwrite(21));
+}
+
+// Timings are written to the debug output (compare against the HashMap lines)
+const int cBenchmarkCount = 200000;
+
+TEST(FlatHashMap_BenchmarkInt)
+{
+  int found = 0;
+  {
+    HashMap<int, int> map;
+    WindowsDebugTimer timer("HashMap<int,int> insert + find");
+    for(int i = 0; i < cBenchmarkCount; ++i)
+      map.Insert(i * 31, i);
+    for(int pass = 0; pass < 4; ++pass)
+      for(int i = 0; i < cBenchmarkCount; ++i)
+        found += map.ContainsKey(i * 17) ? 1 : 0;
+  }
+
+  int flatFound = 0;
+  {
+    FlatHashMap<int, int> map;
+    WindowsDebugTimer timer("FlatHashMap<int,int> insert + find");
+    for(int i = 0; i < cBenchmarkCount; ++i)
+      map.Insert(i * 31, i);
+    for(int pass = 0; pass < 4; ++pass)
+      for(int i = 0; i < cBenchmarkCount; ++i)
+        flatFound += map.ContainsKey(i * 17) ? 1 : 0;
+  }
+
+  CHECK_EQUAL(found, flatFound);
+}
+
+TEST(FlatHashMap_BenchmarkString)
+{
+  Zero::Array<String> keys;
+  keys.Reserve(cBenchmarkCount / 4);
+  for(int i = 0; i < cBenchmarkCount / 4; ++i)
+    keys.PushBack(String::Format("Events::Event%d", i));
+
+  int found = 0;
+  {
+    HashMap<String, int> map;
+    WindowsDebugTimer timer("HashMap<String,int> insert + find");
+    for(uint i = 0; i < keys.Size(); ++i)
+      map.Insert(keys[i], i);
+    for(int pass = 0; pass < 4; ++pass)
+      for(uint i = 0; i < keys.Size(); ++i)
+        found += map.FindValue(keys[i], 0);
+  }
+
+  int flatFound = 0;
+  {
+    FlatHashMap<String, int> map;
+    WindowsDebugTimer timer("FlatHashMap<String,int> insert + find");
+    for(uint i = 0; i < keys.Size(); ++i)
+      map.Insert(keys[i], i);
+    for(int pass = 0; pass < 4; ++pass)
+      for(uint i = 0; i < keys.Size(); ++i)
+        flatFound += map.FindValue(keys[i], 0);
+  }
+
+  CHECK_EQUAL(found, flatFound);
+}
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file FrameAllocatorTest.cpp
+///  Unit tests for the per frame arenas.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Memory/FrameAllocator.hpp"
+
+using Zero::FrameAllocator;
+using Zero::Memory::FrameArena;
+
+TEST(FrameArena_Linear)
+{
+  FrameArena arena;
+  byte* first = (byte*)arena.Allocate(10);
+  byte* second = (byte*)arena.Allocate(10);
+  CHECK_EQUAL(0, (size_t)first % 16);
+  CHECK_EQUAL(0, (size_t)second % 16);
+  CHECK(first != second);
+  CHECK_EQUAL(32, arena.GetUsedBytes());
+
+  arena.Reset();
+  CHECK_EQUAL(0, arena.GetUsedBytes());
+  CHECK_EQUAL(32, arena.GetHighWaterMark());
+}
+
+TEST(FrameArena_Overflow)
+{
+  FrameArena arena;
+
+  // The first frame has no block and overflows, the reset then sizes
+  // the block so the same amount fits in one block next frame
+  for(uint i = 0; i < 1000; ++i)
+    memset(arena.Allocate(1000), 0xCD, 1000);
+  size_t used = arena.GetUsedBytes();
+  arena.Reset();
+
+  size_t dedicated = arena.GetDedicatedBytes();
+  CHECK(dedicated >= used);
+
+  for(uint i = 0; i < 1000; ++i)
+    arena.Allocate(1000);
+  arena.Reset();
+  CHECK_EQUAL(dedicated, arena.GetDedicatedBytes());
+}
+
+TEST(FrameAllocator_DoubleBuffered)
+{
+  FrameAllocator::EndFrame();
+
+  Zero::Array<int, FrameAllocator> lastFrame;
+  for(int i = 0; i < 100; ++i)
+    lastFrame.PushBack(i);
+
+  // Memory from the previous frame is still valid this frame
+  FrameAllocator::EndFrame();
+  Zero::Array<int, FrameAllocator> thisFrame;
+  for(int i = 0; i < 100; ++i)
+    thisFrame.PushBack(-i);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    CHECK_EQUAL(i, lastFrame[i]);
+    CHECK_EQUAL(-i, thisFrame[i]);
+  }
+
+  CHECK(FrameAllocator::GetHighWaterMark() >= 100 * sizeof(int));
+
+  // Release the arrays before their memory is reused
+  lastFrame.Clear();
+  thisFrame.Clear();
+  FrameAllocator::EndFrame();
+  FrameAllocator::EndFrame();
+}
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file MpscRingTest.cpp
+///  Unit tests and stress benchmark for the lock-free MpscRing.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Containers/MpscRing.hpp"
+#include "Containers/BitStream.hpp"
+#include "Platform/Thread.hpp"
+
+#include "WindowsDebugTimer.hpp"
+
+using Zero::MpscRing;
+
+struct RingMessage
+{
+  RingMessage() : Producer(0), Sequence(0) {}
+  RingMessage(uint producer, uint sequence) : Producer(producer), Sequence(sequence) {}
+
+  uint Producer;
+  uint Sequence;
+};
+
+TEST(MpscRing_Basic)
+{
+  MpscRing<int> ring(5);
+  CHECK_EQUAL(8, ring.Capacity());
+  CHECK(ring.Empty());
+
+  for(int i = 0; i < 8; ++i)
+    CHECK(ring.TryPush(i));
+  CHECK(!ring.TryPush(8));
+
+  int value = -1;
+  CHECK(ring.TryPop(value));
+  CHECK_EQUAL(0, value);
+  CHECK(ring.TryPush(8));
+
+  Zero::Array<int> values;
+  CHECK_EQUAL(3, ring.PopBatch(values, 3));
+  CHECK_EQUAL(5, ring.PopClaimed(values));
+  CHECK(ring.Empty());
+  CHECK(!ring.TryPop(value));
+
+  // In order across the wrap around
+  CHECK_EQUAL(8, values.Size());
+  for(int i = 0; i < 8; ++i)
+    CHECK_EQUAL(i + 1, values[i]);
+}
+
+TEST(MpscRing_Move)
+{
+  MpscRing<Zero::BitStream> ring(2);
+
+  // Buffers are handed through the ring without being copied
+  Zero::BitStream first;
+  first.Reserve(1500);
+  first.Write(uint(7));
+  const byte* firstBuffer = first.GetData();
+  CHECK(ring.TryPush(Zero::ZeroMove(first)));
+  CHECK(first.GetData() == nullptr);
+
+  Zero::BitStream second;
+  second.Reserve(1500);
+  const byte* secondBuffer = second.GetData();
+  CHECK(ring.TryPush(Zero::ZeroMove(second)));
+
+  // A failed push leaves the value alone
+  Zero::BitStream third;
+  third.Reserve(1500);
+  CHECK(!ring.TryPush(Zero::ZeroMove(third)));
+  CHECK(third.GetData() != nullptr);
+
+  Zero::BitStream popped;
+  CHECK(ring.TryPopMove(popped));
+  CHECK(popped.GetData() == firstBuffer);
+  uint value = 0;
+  CHECK(popped.Read(value));
+  CHECK_EQUAL(7, value);
+
+  Zero::Array<Zero::BitStream> streams;
+  CHECK_EQUAL(1, ring.PopBatchMove(streams));
+  CHECK(streams[0].GetData() == secondBuffer);
+  CHECK(ring.Empty());
+}
+
+const uint cMessagesPerProducer = 200000;
+
+struct RingProducer
+{
+  MpscRing<RingMessage>* Ring;
+  uint Index;
+  uint Retries;
+
+  Zero::OsInt Run()
+  {
+    for(uint i = 0; i < cMessagesPerProducer; ++i)
+    {
+      // Full, wait for the consumer to catch up
+      while(!Ring->TryPush(RingMessage(Index, i)))
+        ++Retries;
+    }
+    return 0;
+  }
+};
+
+TEST(MpscRing_Stress)
+{
+  const uint cProducerCount = 4;
+  MpscRing<RingMessage> ring(1024);
+  RingProducer producers[cProducerCount];
+  Zero::Thread threads[cProducerCount];
+  uint nextSequence[cProducerCount] = {0};
+
+  WindowsDebugTimer timer("MpscRing 4 producers");
+  for(uint i = 0; i < cProducerCount; ++i)
+  {
+    producers[i].Ring = &ring;
+    producers[i].Index = i;
+    producers[i].Retries = 0;
+    threads[i].Initialize(&Zero::Thread::ObjectEntryCreator<RingProducer, &RingProducer::Run>,
+                          &producers[i], "MpscRingProducer");
+    threads[i].Resume();
+  }
+
+  // Drain in batches on this thread like ThreadDispatch does
+  const uint cTotal = cProducerCount * cMessagesPerProducer;
+  uint received = 0;
+  bool inOrder = true;
+  Zero::Array<RingMessage> batch;
+  while(received < cTotal)
+  {
+    batch.Clear();
+    ring.PopBatch(batch, 256);
+    for(uint i = 0; i < batch.Size(); ++i)
+    {
+      RingMessage& message = batch[i];
+      // Each producer's messages arrive in the order they were pushed
+      inOrder &= (message.Sequence == nextSequence[message.Producer]);
+      nextSequence[message.Producer] = message.Sequence + 1;
+    }
+    received += batch.Size();
+  }
+
+  for(uint i = 0; i < cProducerCount; ++i)
+  {
+    threads[i].WaitForCompletion();
+    CHECK_EQUAL(cMessagesPerProducer, nextSequence[i]);
+  }
+
+  CHECK(inOrder);
+  CHECK(ring.Empty());
+}
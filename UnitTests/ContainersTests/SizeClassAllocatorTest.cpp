@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file SizeClassAllocatorTest.cpp
+///  Unit tests for the thread cached size class allocator behind Memory::Heap.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Memory/Heap.hpp"
+#include "Memory/SizeClassAllocator.hpp"
+#include "Platform/Thread.hpp"
+
+#include "WindowsDebugTimer.hpp"
+
+using Zero::Memory::SizeClassAllocator;
+using Zero::Memory::Heap;
+
+TEST(SizeClassAllocator_Sizes)
+{
+  Zero::Array<byte*> allocations;
+  for(size_t size = 0; size <= SizeClassAllocator::cMaxSize; ++size)
+  {
+    byte* memory = (byte*)SizeClassAllocator::Allocate(size);
+    CHECK(memory != nullptr);
+    CHECK_EQUAL(0, (size_t)memory % 16);
+    CHECK(SizeClassAllocator::Owns(memory));
+    memset(memory, (int)size, size);
+    allocations.PushBack(memory);
+  }
+
+  // Nothing was overwritten by a neighbor
+  for(size_t size = 0; size <= SizeClassAllocator::cMaxSize; ++size)
+  {
+    byte* memory = allocations[size];
+    for(size_t i = 0; i < size; ++i)
+      CHECK_EQUAL((byte)size, memory[i]);
+    CHECK(SizeClassAllocator::Deallocate(memory));
+  }
+
+  CHECK(SizeClassAllocator::Allocate(SizeClassAllocator::cMaxSize + 1) == nullptr);
+
+  void* systemMemory = malloc(32);
+  CHECK(!SizeClassAllocator::Owns(systemMemory));
+  CHECK(!SizeClassAllocator::Deallocate(systemMemory));
+  free(systemMemory);
+}
+
+TEST(SizeClassAllocator_Reuse)
+{
+  void* first = SizeClassAllocator::Allocate(48);
+  SizeClassAllocator::Deallocate(first);
+  void* second = SizeClassAllocator::Allocate(40);
+  CHECK(first == second);
+  SizeClassAllocator::Deallocate(second);
+}
+
+TEST(SizeClassAllocator_HeapStats)
+{
+  Heap* heap = new Heap("SizeClassTest", nullptr);
+  void* small = heap->Allocate(64);
+  void* large = heap->Allocate(4096);
+  CHECK(SizeClassAllocator::Owns(small));
+  CHECK(!SizeClassAllocator::Owns(large));
+  CHECK_EQUAL(2, heap->mData.Active);
+  CHECK_EQUAL(4160, heap->mData.BytesAllocated);
+
+  heap->Deallocate(small, 64);
+  heap->Deallocate(large, 4096);
+  CHECK_EQUAL(0, heap->mData.Active);
+  CHECK_EQUAL(0, heap->mData.BytesAllocated);
+  CHECK_EQUAL(4160, heap->mData.PeakAllocated);
+
+  // Size class memory can always be released through zDeallocate
+  void* object = heap->Allocate(24);
+  Zero::zDeallocate(object);
+  delete heap;
+}
+
+const uint cObjectsPerThread = 20000;
+
+// Allocates on its own thread and frees everything the previous thread allocated
+struct CrossThreadFreer
+{
+  Zero::Array<void*> Allocated;
+  Zero::Array<void*>* ToFree;
+
+  Zero::OsInt Run()
+  {
+    for(uint i = 0; i < cObjectsPerThread; ++i)
+      Allocated.PushBack(SizeClassAllocator::Allocate(i % SizeClassAllocator::cMaxSize));
+
+    if(ToFree)
+    {
+      for(uint i = 0; i < ToFree->Size(); ++i)
+        SizeClassAllocator::Deallocate((*ToFree)[i]);
+    }
+    return 0;
+  }
+};
+
+TEST(SizeClassAllocator_CrossThread)
+{
+  const uint cThreadCount = 4;
+  CrossThreadFreer freers[cThreadCount];
+  Zero::Thread threads[cThreadCount];
+
+  WindowsDebugTimer timer("SizeClassAllocator cross thread free");
+  for(uint i = 0; i < cThreadCount; ++i)
+  {
+    freers[i].ToFree = i > 0 ? &freers[i - 1].Allocated : nullptr;
+    threads[i].Initialize(&Zero::Thread::ObjectEntryCreator<CrossThreadFreer, &CrossThreadFreer::Run>,
+                          &freers[i], "SizeClassTest");
+    threads[i].Resume();
+    threads[i].WaitForCompletion();
+  }
+
+  // The remote frees end up back in the released caches and are reused
+  for(uint i = 0; i < freers[cThreadCount - 1].Allocated.Size(); ++i)
+    CHECK(SizeClassAllocator::Deallocate(freers[cThreadCount - 1].Allocated[i]));
+}
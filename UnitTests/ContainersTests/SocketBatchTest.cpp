@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file SocketBatchTest.cpp
+///  Loopback unit test and throughput timings for batched socket I/O.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+// Only the POSIX socket batches with sendmmsg/recvmmsg, elsewhere the batch
+// calls loop over SendTo/ReceiveFrom and there is nothing to compare
+#if defined(__linux__)
+
+#include "ContainerTestStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+#include "Platform/Socket.hpp"
+#include "Platform/Timer.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+using Zero::Socket;
+using Zero::SocketAddress;
+using Zero::SocketDatagram;
+using Zero::Status;
+
+const size_t cBatchDatagrams = 32;
+const size_t cDatagramBytes = 64;
+
+// Opens a UDP socket bound to any available loopback port, stops at the
+// first step that fails
+bool OpenLoopbackSocket(Socket& socket, SocketAddress& address)
+{
+  Status status;
+  socket.Open(status, Zero::SocketAddressFamily::InternetworkV4, Zero::SocketType::Datagram, Zero::SocketProtocol::Udp);
+  if(status.Failed())
+    return false;
+
+  address.SetIpv4(status, "127.0.0.1", Zero::AnyPort);
+  if(status.Failed())
+    return false;
+
+  socket.Bind(status, address);
+  if(status.Failed())
+    return false;
+
+  address = socket.GetBoundLocalAddress();
+  return true;
+}
+
+void ReportThroughput(const char* name, size_t packets, double seconds)
+{
+  printf("%s %.0f packets/sec\n", name, double(packets) / seconds);
+}
+
+TEST(SocketBatch_Loopback)
+{
+  Socket receiver, sender;
+  SocketAddress receiverAddress, senderAddress;
+  CHECK(OpenLoopbackSocket(receiver, receiverAddress));
+  CHECK(OpenLoopbackSocket(sender, senderAddress));
+
+  const size_t cCount = 8;
+  byte sendData[cCount][cDatagramBytes];
+  byte receiveData[cCount][cDatagramBytes];
+  SocketDatagram datagrams[cCount];
+  for(uint i = 0; i < cCount; ++i)
+  {
+    memset(sendData[i], int(i + 1), cDatagramBytes);
+    datagrams[i].mData = sendData[i];
+    datagrams[i].mDataLength = cDatagramBytes;
+    datagrams[i].mAddress = receiverAddress;
+  }
+
+  Status status;
+  CHECK_EQUAL(cCount, sender.SendToBatch(status, datagrams, cCount));
+  CHECK(status.Succeeded());
+  for(uint i = 0; i < cCount; ++i)
+    CHECK_EQUAL(cDatagramBytes, datagrams[i].mBytes);
+
+  // Only waits for the first datagram, so keep receiving until all arrive
+  size_t received = 0;
+  while(received < cCount && status.Succeeded())
+  {
+    for(size_t i = received; i < cCount; ++i)
+    {
+      datagrams[i].mData = receiveData[i];
+      datagrams[i].mDataLength = cDatagramBytes;
+    }
+    received += receiver.ReceiveFromBatch(status, datagrams + received, cCount - received);
+  }
+  CHECK(status.Succeeded());
+
+  // Loopback datagrams arrive in the order they were sent
+  CHECK_EQUAL(cCount, received);
+  for(uint i = 0; i < cCount; ++i)
+  {
+    CHECK_EQUAL(cDatagramBytes, datagrams[i].mBytes);
+    CHECK_EQUAL(i + 1, receiveData[i][0]);
+    CHECK(datagrams[i].mAddress == senderAddress);
+  }
+}
+
+// Sends rounds of datagrams over loopback one call per datagram or one call
+// per batch, receiving each round before the next so the buffer never fills.
+// Returns the number of datagrams received, or 0 if the sockets fail.
+size_t RunLoopbackRounds(bool batched, size_t rounds)
+{
+  Socket receiver, sender;
+  SocketAddress receiverAddress, senderAddress;
+  if(!OpenLoopbackSocket(receiver, receiverAddress) || !OpenLoopbackSocket(sender, senderAddress))
+    return 0;
+
+  Status status;
+  receiver.SetBlocking(status, false);
+  if(status.Failed())
+    return 0;
+
+  byte data[cBatchDatagrams][cDatagramBytes] = {};
+  SocketDatagram datagrams[cBatchDatagrams];
+
+  size_t totalReceived = 0;
+  for(size_t round = 0; round < rounds; ++round)
+  {
+    for(size_t i = 0; i < cBatchDatagrams; ++i)
+    {
+      datagrams[i].mData = data[i];
+      datagrams[i].mDataLength = cDatagramBytes;
+      datagrams[i].mAddress = receiverAddress;
+    }
+
+    if(batched)
+    {
+      sender.SendToBatch(status, datagrams, cBatchDatagrams);
+    }
+    else
+    {
+      for(size_t i = 0; i < cBatchDatagrams && status.Succeeded(); ++i)
+        sender.SendTo(status, data[i], cDatagramBytes, receiverAddress);
+    }
+    if(status.Failed())
+      return 0;
+
+    // Give up on the round after enough empty polls (a datagram was dropped)
+    size_t received = 0;
+    for(uint emptyPolls = 0; received < cBatchDatagrams && emptyPolls < 1000;)
+    {
+      Status receiveStatus;
+      size_t count = 0;
+      if(batched)
+      {
+        count = receiver.ReceiveFromBatch(receiveStatus, datagrams, cBatchDatagrams - received);
+      }
+      else
+      {
+        receiver.ReceiveFrom(receiveStatus, data[0], cDatagramBytes, datagrams[0].mAddress);
+        count = receiveStatus.Succeeded() ? 1 : 0;
+      }
+
+      if(count == 0)
+        ++emptyPolls;
+      received += count;
+    }
+    totalReceived += received;
+  }
+  return totalReceived;
+}
+
+TEST(SocketBatch_Throughput)
+{
+  const size_t cRounds = 5000;
+
+  Zero::Timer timer;
+  size_t singleReceived = RunLoopbackRounds(false, cRounds);
+  ReportThroughput("Loopback sendto/recvfrom", singleReceived, timer.UpdateAndGetTime());
+
+  timer.Reset();
+  size_t batchedReceived = RunLoopbackRounds(true, cRounds);
+  ReportThroughput("Loopback sendmmsg/recvmmsg", batchedReceived, timer.UpdateAndGetTime());
+
+  CHECK(singleReceived > 0);
+  CHECK(batchedReceived > 0);
+}
+
+#endif
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ComponentStoreTest.cpp
+///  Tests for the space component queries.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// Counts the range's components and checks none of them repeat
+template <typename RangeType>
+uint CountUnique(RangeType range, bool& repeated)
+{
+  HashSet<Component*> visited;
+  repeated = false;
+  for(; !range.Empty(); range.PopFront())
+  {
+    Component* component = range.Front();
+    repeated = repeated || visited.Contains(component);
+    visited.Insert(component);
+  }
+  return visited.Size();
+}
+
+// 3 cogs with a BoxCollider and RigidBody, 5 with only a
+// SphereCollider and 1 with only a RigidBody
+void CreateQueryCogs(Space* space)
+{
+  for(uint i = 0; i < 9; ++i)
+  {
+    Cog* cog = CreateTestCog(space, Vec3(real(i) * 10, 0, 0));
+    if(i < 3)
+    {
+      cog->AddComponentByName("BoxCollider");
+      cog->AddComponentByName("RigidBody");
+    }
+    else if(i < 8)
+    {
+      cog->AddComponentByName("SphereCollider");
+    }
+    else
+    {
+      cog->AddComponentByName("RigidBody");
+    }
+  }
+}
+
+TEST(ComponentStore_QueryWithRequiredType)
+{
+  Space* space = CreateTestSpace();
+  CreateQueryCogs(space);
+
+  bool repeated;
+  CHECK_EQUAL(8, CountUnique(space->Query<Collider>(), repeated));
+  CHECK(!repeated);
+
+  // Fewer RigidBodies than Colliders, the RigidBodies are walked
+  CHECK_EQUAL(3, CountUnique(space->Query<Collider, RigidBody>(), repeated));
+  CHECK(!repeated);
+  forRange(Collider* collider, space->Query<Collider, RigidBody>())
+    CHECK(collider->GetOwner()->has(RigidBody) != nullptr);
+
+  // Same pairs walking the queried type
+  CHECK_EQUAL(3, CountUnique(space->Query<RigidBody, Collider>(), repeated));
+  CHECK(!repeated);
+  forRange(RigidBody* body, space->Query<RigidBody, Collider>())
+    CHECK(body->GetOwner()->has(Collider) != nullptr);
+
+  // Every cog has a Transform
+  CHECK_EQUAL(4, CountUnique(space->Query<Transform, RigidBody>(), repeated));
+  CHECK(!repeated);
+  CHECK_EQUAL(8, CountUnique(space->Query<Collider, Transform>(), repeated));
+  CHECK(!repeated);
+
+  DestroyTestSpace(space);
+}
+
+TEST(ComponentStore_RemoveWhileIterating)
+{
+  Space* space = CreateTestSpace();
+  CreateQueryCogs(space);
+
+  // Removing the front swaps the last component into its place, that one is
+  // skipped but nothing past the end of the shrinking array is read
+  uint visited = 0;
+  forRange(SphereCollider* collider, space->Query<SphereCollider>())
+  {
+    CHECK(collider->GetOwner() != nullptr);
+    collider->GetOwner()->RemoveComponent(collider);
+    ++visited;
+  }
+
+  bool repeated;
+  uint remaining = CountUnique(space->Query<SphereCollider>(), repeated);
+  CHECK(visited != 0);
+  CHECK_EQUAL(5, visited + remaining);
+
+  // Same while walking the required type
+  visited = 0;
+  forRange(Collider* collider, space->Query<Collider, RigidBody>())
+  {
+    collider->GetOwner()->RemoveComponentByName("RigidBody");
+    ++visited;
+  }
+  CHECK(visited != 0);
+  CHECK_EQUAL(3 - visited, CountUnique(space->Query<Collider, RigidBody>(), repeated));
+
+  DestroyTestSpace(space);
+}
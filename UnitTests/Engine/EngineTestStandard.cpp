@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file EngineTestStandard.cpp
+///  Helpers for tests that need a running engine.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+namespace Zero
+{
+
+System* CreateTimeSystem();
+System* CreatePhysicsSystem();
+
+// The default space has graphics and sound components that need their systems
+const cstr cTestSpace =
+  "[Version:1]\n"
+  "Space\n"
+  "{\n"
+  "  var Name = \"TestSpace\"\n"
+  "  TimeSpace\n"
+  "  {\n"
+  "  }\n"
+  "  PhysicsSpace\n"
+  "  {\n"
+  "    var AllowSleep = false\n"
+  "  }\n"
+  "  NetSpace\n"
+  "  {\n"
+  "  }\n"
+  "}\n";
+
+Engine* InitializeTestEngine(ZeroStartup& startup)
+{
+  ZeroStartupSettings settings;
+  settings.mTweakableFileName = "UnitTestTweakables";
+  settings.mEmbeddedPackage = false;
+  Engine* engine = startup.Initialize(settings);
+
+  engine->AddSystem(CreateTimeSystem());
+  engine->AddSystem(CreatePhysicsSystem());
+
+  SystemInitializer initializer;
+  initializer.mEngine = engine;
+  initializer.Config = engine->GetConfigCog();
+  engine->Initialize(initializer);
+
+  Z::gContentSystem->EnumerateLibraries();
+  bool coreContent = LoadContentLibrary("FragmentCore", true);
+  coreContent = coreContent && LoadContentLibrary("Loading", true);
+  coreContent = coreContent && LoadContentLibrary("ZeroCore", true);
+  ErrorIf(!coreContent, "Failed to load the core content, resources need to be in the working directory.");
+  return engine;
+}
+
+void ShutdownTestEngine(ZeroStartup& startup)
+{
+  // Running a terminated engine skips straight to shutting down its systems
+  Z::gEngine->Terminate();
+  Z::gEngine->Run();
+  startup.Shutdown();
+}
+
+Space* CreateTestSpace()
+{
+  GameSession* game = Z::gEngine->CreateGameSession();
+
+  Status status;
+  DataTreeLoader loader;
+  loader.OpenBuffer(status, cTestSpace);
+  ErrorIf(status.Failed(), "Failed to read the test space: %s", status.Message.c_str());
+  return Z::gFactory->CreateSpaceFromStream(loader, CreationFlags::Default, game);
+}
+
+void DestroyTestSpace(Space* space)
+{
+  space->GetGameSession()->Destroy();
+  Z::gTracker->ClearDeletedObjects();
+}
+
+Cog* CreateTestCog(Space* space, Vec3Param position)
+{
+  return space->CreateAt(CoreArchetypes::Transform, position);
+}
+
+void StepPhysics(Space* space, uint frames)
+{
+  const float cDt = 1.0f / 60.0f;
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  for(uint i = 0; i < frames; ++i)
+  {
+    UpdateEvent updateEvent(cDt, cDt, cDt * float(i + 1), cDt * float(i + 1));
+    physicsSpace->SystemLogicUpdate(&updateEvent);
+  }
+}
+
+PhysicsSolverConfig* CloneSolverConfig(Space* space)
+{
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  HandleOf<PhysicsSolverConfig> config = physicsSpace->GetPhysicsSolverConfig()->RuntimeClone();
+  physicsSpace->SetPhysicsSolverConfig(config);
+  return config;
+}
+
+BenchmarkTimer::BenchmarkTimer(StringParam name)
+  : mName(name)
+{
+}
+
+BenchmarkTimer::~BenchmarkTimer()
+{
+  ZPrint("%s %.6fs\n", mName.c_str(), mTimer.UpdateAndGetTime());
+}
+
+}//namespace Zero
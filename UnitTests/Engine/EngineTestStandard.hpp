@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file EngineTestStandard.hpp
+///  Helpers for tests that need a running engine.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Startup/StartupStandard.hpp"
+#include "CppUnitLite2/CppUnitLite2.h"
+
+namespace Zero
+{
+
+/// Starts the engine with only the systems the tests use (no graphics,
+/// sound or window) and loads the core content.
+Engine* InitializeTestEngine(ZeroStartup& startup);
+void ShutdownTestEngine(ZeroStartup& startup);
+
+/// Creates a space in its own game session with a TimeSpace, PhysicsSpace
+/// and NetSpace. Nothing updates it unless a test does.
+Space* CreateTestSpace();
+/// Destroys the space's game session and deletes its objects right away.
+void DestroyTestSpace(Space* space);
+
+/// Creates a cog with only a Transform at the given position.
+Cog* CreateTestCog(Space* space, Vec3Param position);
+
+/// Runs the space's physics for the frame count at 60 frames per second.
+void StepPhysics(Space* space, uint frames);
+/// Gives the space a runtime copy of its PhysicsSolverConfig and returns it to be changed.
+PhysicsSolverConfig* CloneSolverConfig(Space* space);
+
+/// Times a benchmark from construction to destruction and prints the time
+/// to the console (the debug output when run from Visual Studio).
+class BenchmarkTimer
+{
+public:
+  BenchmarkTimer(StringParam name);
+  ~BenchmarkTimer();
+
+  String mName;
+  Timer mTimer;
+};
+
+}//namespace Zero
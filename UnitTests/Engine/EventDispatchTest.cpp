@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file EventDispatchTest.cpp
+///  Benchmark of sending an event to many listening cogs.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+const EventName cDispatchBenchmarkEvent("DispatchBenchmark");
+
+const uint cDispatchBenchmarkCogs = 50000;
+const uint cDispatchBenchmarkFrames = 10;
+
+class DispatchCounter : public EventObject
+{
+public:
+  DispatchCounter() : mCount(0) {}
+
+  void OnEvent(Event* event) { ++mCount; }
+
+  uint mCount;
+};
+
+// Sends the event to every cog once a frame, like TransformUpdated or a
+// collision event sent to each cog's own dispatcher
+template <typename EventIdType>
+void DispatchToCogs(Array<Cog*>& cogs, const EventIdType& eventId)
+{
+  for(uint frame = 0; frame < cDispatchBenchmarkFrames; ++frame)
+  {
+    for(uint i = 0; i < cogs.Size(); ++i)
+    {
+      Event event;
+      cogs[i]->GetDispatcher()->Dispatch(eventId, &event);
+    }
+  }
+}
+
+// Timings are written to the console (compare the String and EventName lines)
+TEST(EventDispatch_Benchmark50kCogs)
+{
+  Space* space = CreateTestSpace();
+  DispatchCounter counter;
+
+  Array<Cog*> cogs;
+  cogs.Reserve(cDispatchBenchmarkCogs);
+  for(uint i = 0; i < cDispatchBenchmarkCogs; ++i)
+  {
+    Cog* cog = CreateTestCog(space, Vec3(real(i % 256), real(i / 256), 0));
+    Zero::Connect(cog, cDispatchBenchmarkEvent, &counter, &DispatchCounter::OnEvent);
+    cogs.PushBack(cog);
+  }
+
+  // The String API finds the interned id by name on every send, a declared
+  // EventName already carries its id
+  String eventName = cDispatchBenchmarkEvent;
+  {
+    BenchmarkTimer timer("50k cogs dispatch by String");
+    DispatchToCogs(cogs, eventName);
+  }
+  uint stringCount = counter.mCount;
+
+  {
+    BenchmarkTimer timer("50k cogs dispatch by EventName");
+    DispatchToCogs(cogs, cDispatchBenchmarkEvent);
+  }
+
+  CHECK_EQUAL(cDispatchBenchmarkCogs * cDispatchBenchmarkFrames, stringCount);
+  CHECK_EQUAL(2 * cDispatchBenchmarkCogs * cDispatchBenchmarkFrames, counter.mCount);
+
+  DestroyTestSpace(space);
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file EventOrderTest.cpp
+///  Tests that batched events reach their receivers in connection order.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+const EventName cBatchedOrderEvent("BatchedOrderTest", true);
+
+// Ids of the receivers in the order they received the event
+static Array<uint> sReceivedOrder;
+
+// Member function receivers are batched, the second function records its id plus 100
+class OrderReceiver : public EventObject
+{
+public:
+  OrderReceiver(uint id) : mId(id), mConnectOnEvent(nullptr), mSource(nullptr) {}
+
+  void OnFirst(Event* event) { sReceivedOrder.PushBack(mId); }
+  void OnSecond(Event* event) { sReceivedOrder.PushBack(mId + 100); }
+
+  // Connects the other receiver the first time it's received
+  void OnConnect(Event* event)
+  {
+    sReceivedOrder.PushBack(mId);
+    if(mConnectOnEvent)
+      Zero::Connect(mSource, cBatchedOrderEvent, mConnectOnEvent, &OrderReceiver::OnFirst);
+    mConnectOnEvent = nullptr;
+  }
+
+  uint mId;
+  OrderReceiver* mConnectOnEvent;
+  EventObject* mSource;
+};
+
+// Static function receivers can't be batched (like script receivers)
+void OnStaticFirst(Event* event) { sReceivedOrder.PushBack(50); }
+void OnStaticSecond(Event* event) { sReceivedOrder.PushBack(51); }
+
+void ConnectStatic(EventObject* source, OrderReceiver* owner, void (*function)(Event*))
+{
+  StaticFunctionConnection<Event>* connection = new StaticFunctionConnection<Event>(function);
+  connection->EventType = ZilchTypeId(Event);
+  connection->ConnectToReceiverAndDispatcher(cBatchedOrderEvent, owner->GetReceiver(), source->GetDispatcher());
+}
+
+// Dispatches the event and returns true if the receivers got it in the given order
+bool ReceivedInOrder(EventObject* source, const uint* expected, uint expectedCount)
+{
+  sReceivedOrder.Clear();
+  Event event;
+  source->DispatchEvent(cBatchedOrderEvent, &event);
+
+  if(sReceivedOrder.Size() != expectedCount)
+    return false;
+  for(uint i = 0; i < expectedCount; ++i)
+  {
+    if(sReceivedOrder[i] != expected[i])
+      return false;
+  }
+  return true;
+}
+
+TEST(EventOrder_BatchedKeepsConnectionOrder)
+{
+  EventObject source;
+  OrderReceiver first(1), second(2), third(3), fourth(4);
+  OrderReceiver* staticOwner = new OrderReceiver(0);
+
+  // Batched and unbatched receivers interleaved
+  Zero::Connect(&source, cBatchedOrderEvent, &first, &OrderReceiver::OnFirst);
+  ConnectStatic(&source, staticOwner, &OnStaticFirst);
+  Zero::Connect(&source, cBatchedOrderEvent, &second, &OrderReceiver::OnFirst);
+  Zero::Connect(&source, cBatchedOrderEvent, &third, &OrderReceiver::OnSecond);
+  Zero::Connect(&source, cBatchedOrderEvent, &fourth, &OrderReceiver::OnFirst);
+  ConnectStatic(&source, staticOwner, &OnStaticSecond);
+
+  const uint cExpected[] = {1, 50, 2, 103, 4, 51};
+  CHECK(ReceivedInOrder(&source, cExpected, 6));
+  CHECK(ReceivedInOrder(&source, cExpected, 6));
+
+  // Removing receivers keeps the order of the rest, even once the
+  // batches of the same function left next to each other are merged
+  source.GetDispatcher()->Disconnect(&third);
+  delete staticOwner;
+  const uint cRemoved[] = {1, 2, 4};
+  CHECK(ReceivedInOrder(&source, cRemoved, 3));
+  CHECK(ReceivedInOrder(&source, cRemoved, 3));
+
+  // New receivers come last
+  Zero::Connect(&source, cBatchedOrderEvent, &third, &OrderReceiver::OnSecond);
+  Zero::Connect(&source, cBatchedOrderEvent, &third, &OrderReceiver::OnFirst);
+  const uint cAdded[] = {1, 2, 4, 103, 3};
+  CHECK(ReceivedInOrder(&source, cAdded, 5));
+}
+
+TEST(EventOrder_ConnectDuringDispatch)
+{
+  EventObject source;
+  OrderReceiver connecting(1), first(2), added(3);
+  connecting.mSource = &source;
+  connecting.mConnectOnEvent = &added;
+
+  // The added receiver joins the batch of the last receiver,
+  // but only receives the dispatches after it was connected
+  Zero::Connect(&source, cBatchedOrderEvent, &connecting, &OrderReceiver::OnConnect);
+  Zero::Connect(&source, cBatchedOrderEvent, &first, &OrderReceiver::OnFirst);
+
+  const uint cDuring[] = {1, 2};
+  CHECK(ReceivedInOrder(&source, cDuring, 2));
+  const uint cAfter[] = {1, 2, 3};
+  CHECK(ReceivedInOrder(&source, cAfter, 3));
+}
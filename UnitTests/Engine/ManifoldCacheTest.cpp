@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ManifoldCacheTest.cpp
+///  Tests for reusing manifolds when several pairs share one array.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+const uint cCachePairCount = 2;
+
+// Each pair is a small box resting near the edge of a large static box. The
+// large box is created first so it's the pair's Bot and turning it only changes
+// the relative rotation, the small box has a body so the pair collides.
+void CreateRestingPairs(Space* space, ColliderPair* pairs)
+{
+  for(uint i = 0; i < cCachePairCount; ++i)
+  {
+    Vec3 offset(real(i) * real(100.0), 0, 0);
+    Cog* ground = CreateTestCog(space, offset);
+    ground->AddComponentByName("BoxCollider");
+    ground->has(BoxCollider)->SetSize(Vec3(10, 10, 10));
+
+    // 0.01 into the ground and hanging half a unit off of its edge
+    Cog* box = CreateTestCog(space, offset + Vec3(real(4.5), real(5.49), 0));
+    box->AddComponentByName("RigidBody");
+    box->AddComponentByName("BoxCollider");
+
+    pairs[i] = ColliderPair(ground->has(BoxCollider), box->has(BoxCollider));
+  }
+  space->has(PhysicsSpace)->FlushPhysicsQueue();
+}
+
+bool IsPairManifold(Physics::Manifold& manifold, ColliderPair& pair)
+{
+  return (manifold.Objects.Top == pair.Top && manifold.Objects.Bot == pair.Bot) ||
+         (manifold.Objects.Top == pair.Bot && manifold.Objects.Bot == pair.Top);
+}
+
+// Tests every pair into one array like a narrow phase chunk does, the
+// manifolds of each pair are checked to be in their own range.
+void TestPairs(Physics::ManifoldCache& cache, Physics::CollisionManager* collisionManager, ColliderPair* pairs,
+               Physics::ManifoldArray& manifolds, uint* ends, Physics::ManifoldCacheResults& results)
+{
+  manifolds.Clear();
+  for(uint i = 0; i < cCachePairCount; ++i)
+  {
+    uint start = manifolds.Size();
+    cache.TestCollision(collisionManager, pairs[i], manifolds, results);
+    ends[i] = manifolds.Size();
+
+    for(uint j = start; j < ends[i]; ++j)
+      CHECK(IsPairManifold(manifolds[j], pairs[i]));
+  }
+}
+
+TEST(ManifoldCache_SharedArrayHits)
+{
+  Space* space = CreateTestSpace();
+  ColliderPair pairs[cCachePairCount];
+  CreateRestingPairs(space, pairs);
+
+  Physics::CollisionManager* collisionManager = space->has(PhysicsSpace)->GetCollisionManager();
+  Physics::ManifoldCache cache;
+  cache.mEnabled = true;
+
+  Physics::ManifoldArray manifolds;
+  uint firstEnds[cCachePairCount];
+  Physics::ManifoldCacheResults firstResults;
+  TestPairs(cache, collisionManager, pairs, manifolds, firstEnds, firstResults);
+  CHECK_EQUAL(0, firstResults.mHits);
+  CHECK_EQUAL(cCachePairCount, firstResults.mMisses);
+  CHECK(firstEnds[0] != 0);
+  CHECK(firstEnds[1] != firstEnds[0]);
+  cache.Commit(firstResults);
+  cache.EndFrame();
+
+  // Nothing moved, each pair only gets back what it cached (not the
+  // manifolds of the pairs before it in the array)
+  uint ends[cCachePairCount];
+  Physics::ManifoldCacheResults results;
+  TestPairs(cache, collisionManager, pairs, manifolds, ends, results);
+  CHECK_EQUAL(cCachePairCount, results.mHits);
+  CHECK_EQUAL(0, results.mMisses);
+  for(uint i = 0; i < cCachePairCount; ++i)
+    CHECK_EQUAL(firstEnds[i], ends[i]);
+
+  DestroyTestSpace(space);
+}
+
+TEST(ManifoldCache_FailedRefreshKeepsEarlierPairs)
+{
+  Space* space = CreateTestSpace();
+  ColliderPair pairs[cCachePairCount];
+  CreateRestingPairs(space, pairs);
+
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  Physics::CollisionManager* collisionManager = physicsSpace->GetCollisionManager();
+  Physics::ManifoldCache cache;
+  cache.mEnabled = true;
+
+  Physics::ManifoldArray manifolds;
+  uint firstEnds[cCachePairCount];
+  Physics::ManifoldCacheResults firstResults;
+  TestPairs(cache, collisionManager, pairs, manifolds, firstEnds, firstResults);
+  cache.Commit(firstResults);
+  cache.EndFrame();
+
+  // Turn the last ground box under the angular threshold. Its top face
+  // drops ~0.04 under the small box so the cached points separate past the
+  // breaking threshold and the refresh fails after adding its manifolds.
+  uint last = cCachePairCount - 1;
+  Transform* ground = pairs[last].Bot->GetOwner()->has(Transform);
+  ground->SetRotation(Math::ToQuaternion(Vec3::cZAxis, real(-0.009)));
+  physicsSpace->FlushPhysicsQueue();
+
+  manifolds.Clear();
+  Physics::ManifoldCacheResults results;
+  for(uint i = 0; i < last; ++i)
+    CHECK(cache.TestCollision(collisionManager, pairs[i], manifolds, results));
+  CHECK_EQUAL(firstEnds[last - 1], manifolds.Size());
+
+  // The full test finds the boxes apart, only the failed refresh's
+  // manifolds are removed
+  CHECK(!cache.TestCollision(collisionManager, pairs[last], manifolds, results));
+  CHECK_EQUAL(last, results.mHits);
+  CHECK_EQUAL(1, results.mMisses);
+  CHECK_EQUAL(firstEnds[last - 1], manifolds.Size());
+  for(uint i = 0; i < last; ++i)
+  {
+    uint start = (i == 0) ? 0 : firstEnds[i - 1];
+    for(uint j = start; j < firstEnds[i]; ++j)
+      CHECK(IsPairManifold(manifolds[j], pairs[i]));
+  }
+
+  DestroyTestSpace(space);
+}
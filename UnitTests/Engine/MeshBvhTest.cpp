@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file MeshBvhTest.cpp
+///  Benchmark of ray casts and triangle queries on each physics mesh bvh layout.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// A 708 x 708 grid of quads, 1002528 triangles in all
+const uint cBvhGridSize = 708;
+const uint cBvhRayCount = 100000;
+const uint cBvhQueryCount = 100000;
+// Casts and queries also checked against testing every triangle
+const uint cBvhBruteForceCount = 4;
+
+// Uploads a rolling terrain of triangles, like a level's static geometry
+HandleOf<PhysicsMesh> CreateGridMesh()
+{
+  uint rowSize = cBvhGridSize + 1;
+  Array<Vec3> vertices;
+  vertices.Reserve(rowSize * rowSize);
+  for(uint z = 0; z < rowSize; ++z)
+  {
+    for(uint x = 0; x < rowSize; ++x)
+    {
+      real height = Math::Sin(real(x) * real(0.37)) * Math::Cos(real(z) * real(0.23)) * real(2);
+      vertices.PushBack(Vec3(real(x), height, real(z)));
+    }
+  }
+
+  Array<uint> indices;
+  indices.Reserve(cBvhGridSize * cBvhGridSize * 6);
+  for(uint z = 0; z < cBvhGridSize; ++z)
+  {
+    for(uint x = 0; x < cBvhGridSize; ++x)
+    {
+      uint corner = z * rowSize + x;
+      indices.PushBack(corner);
+      indices.PushBack(corner + rowSize);
+      indices.PushBack(corner + 1);
+      indices.PushBack(corner + 1);
+      indices.PushBack(corner + rowSize);
+      indices.PushBack(corner + rowSize + 1);
+    }
+  }
+
+  HandleOf<PhysicsMesh> mesh = PhysicsMesh::CreateRuntime();
+  mesh->Upload(vertices, indices);
+  return mesh;
+}
+
+// Rays from above the grid, tilted so they cross many cells before hitting
+Ray GetBvhRay(uint index)
+{
+  real x = real((index * 7919) % (cBvhGridSize * 16)) / real(16);
+  real z = real((index * 104729) % (cBvhGridSize * 16)) / real(16);
+  Vec3 direction(real(index % 5) - real(2), real(-4), real(index % 3) - real(1));
+  return Ray(Vec3(x, real(10), z), Math::Normalized(direction));
+}
+
+// Boxes about the size of a character's collider
+Aabb GetBvhQuery(uint index)
+{
+  real x = real((index * 7919) % (cBvhGridSize * 16)) / real(16);
+  real z = real((index * 104729) % (cBvhGridSize * 16)) / real(16);
+  Vec3 center(x, real(index % 4) - real(1.5), z);
+  return Aabb(center, Vec3(real(0.5), real(1), real(0.5)));
+}
+
+// Counts the queried triangles that actually overlap the aabb, as leaves can
+// return triangles that only overlap the leaf's bounds
+uint CountOverlapping(const Aabb& aabb, TriangleArray& triangles)
+{
+  uint count = 0;
+  for(uint i = 0; i < triangles.Size(); ++i)
+    count += ToAabb(triangles[i]).Overlap(aabb) ? 1 : 0;
+  return count;
+}
+
+// Times the casts and queries on the layout, recording the distance of each
+// hit (or -1 for a miss) and the number of overlapping triangles of each query
+void RunBvhLayout(PhysicsMesh* mesh, MeshBvhLayout::Enum layout, cstr name,
+                  Array<real>& hitDistances, Array<uint>& overlapCounts)
+{
+  mesh->SetBvhLayout(layout);
+  BaseCastFilter filter;
+
+  {
+    BenchmarkTimer timer(String::Format("1M triangle mesh %s bvh ray casts", name));
+    for(uint i = 0; i < cBvhRayCount; ++i)
+    {
+      ProxyResult result;
+      bool hit = mesh->CastRay(GetBvhRay(i), result, filter);
+      hitDistances.PushBack(hit ? result.mDistance : real(-1));
+    }
+  }
+
+  TriangleArray triangles;
+  Array<uint> triangleIds;
+  {
+    BenchmarkTimer timer(String::Format("1M triangle mesh %s bvh triangle queries", name));
+    for(uint i = 0; i < cBvhQueryCount; ++i)
+    {
+      triangles.Clear();
+      triangleIds.Clear();
+      Aabb aabb = GetBvhQuery(i);
+      mesh->GetOverlappingTriangles(aabb, triangles, triangleIds);
+      overlapCounts.PushBack(CountOverlapping(aabb, triangles));
+    }
+  }
+}
+
+bool DistancesMatch(const Array<real>& lhs, const Array<real>& rhs)
+{
+  for(uint i = 0; i < lhs.Size(); ++i)
+  {
+    if(Math::Abs(lhs[i] - rhs[i]) > real(0.0001))
+      return false;
+  }
+  return lhs.Size() == rhs.Size();
+}
+
+bool CountsMatch(const Array<uint>& lhs, const Array<uint>& rhs)
+{
+  for(uint i = 0; i < lhs.Size(); ++i)
+  {
+    if(lhs[i] != rhs[i])
+      return false;
+  }
+  return lhs.Size() == rhs.Size();
+}
+
+TEST(MeshBvh_LayoutSetting)
+{
+  HandleOf<PhysicsMesh> meshHandle = CreateGridMesh();
+  PhysicsMesh* mesh = meshHandle;
+  CHECK(mesh->GetBvhLayout() == MeshBvhLayout::Wide);
+  CHECK(mesh->GetBvh()->GetLayout() == MeshBvhLayout::Wide);
+
+  // Setting the layout rebuilds the bvh in place
+  mesh->SetBvhLayout(MeshBvhLayout::Quantized);
+  CHECK(mesh->GetBvh()->GetLayout() == MeshBvhLayout::Quantized);
+  CHECK_EQUAL(cBvhGridSize * cBvhGridSize * 2, mesh->GetBvh()->GetPrimitiveCount());
+
+  // Runtime clones keep the layout
+  HandleOf<PhysicsMesh> cloneHandle = mesh->RuntimeClone();
+  PhysicsMesh* clone = cloneHandle;
+  CHECK(clone->GetBvhLayout() == MeshBvhLayout::Quantized);
+  clone->ForceRebuild();
+  CHECK(clone->GetBvh()->GetLayout() == MeshBvhLayout::Quantized);
+
+  // Invalid values are ignored
+  mesh->SetBvhLayout(MeshBvhLayout::Size);
+  CHECK(mesh->GetBvhLayout() == MeshBvhLayout::Quantized);
+}
+
+// Timings are written to the console (compare the Standard, Quantized and Wide lines)
+TEST(MeshBvh_BenchmarkLayouts)
+{
+  HandleOf<PhysicsMesh> meshHandle = CreateGridMesh();
+  PhysicsMesh* mesh = meshHandle;
+
+  Array<real> standardDistances, quantizedDistances, wideDistances;
+  Array<uint> standardCounts, quantizedCounts, wideCounts;
+  RunBvhLayout(mesh, MeshBvhLayout::Standard, "Standard", standardDistances, standardCounts);
+  RunBvhLayout(mesh, MeshBvhLayout::Quantized, "Quantized", quantizedDistances, quantizedCounts);
+  RunBvhLayout(mesh, MeshBvhLayout::Wide, "Wide", wideDistances, wideCounts);
+
+  // Every layout finds the same hits and overlaps
+  CHECK(DistancesMatch(standardDistances, quantizedDistances));
+  CHECK(DistancesMatch(standardDistances, wideDistances));
+  CHECK(CountsMatch(standardCounts, quantizedCounts));
+  CHECK(CountsMatch(standardCounts, wideCounts));
+
+  // Which are the ones found by testing every triangle
+  BaseCastFilter filter;
+  bool castsMatch = true;
+  bool queriesMatch = true;
+  for(uint i = 0; i < cBvhBruteForceCount; ++i)
+  {
+    ProxyResult result;
+    real distance = real(-1);
+    if(mesh->CastRayGeneric(GetBvhRay(i), result, filter))
+      distance = result.mDistance;
+    castsMatch = castsMatch && Math::Abs(distance - standardDistances[i]) <= real(0.0001);
+
+    Aabb aabb = GetBvhQuery(i);
+    uint count = 0;
+    for(uint triIndex = 0; triIndex < mesh->GetTriangleCount(); ++triIndex)
+      count += ToAabb(mesh->GetTriangle(triIndex)).Overlap(aabb) ? 1 : 0;
+    queriesMatch = queriesMatch && count == standardCounts[i];
+  }
+  CHECK(castsMatch);
+  CHECK(queriesMatch);
+}
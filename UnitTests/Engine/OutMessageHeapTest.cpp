@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file OutMessageHeapTest.cpp
+///  Allocation count tests for outgoing messages.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ReplicatorTestStandard.hpp"
+
+using namespace Zero;
+
+TEST(OutMessageHeap_OneNodePerMessage)
+{
+  TestReplicator server(Role::Server);
+  TestReplicator client(Role::Client);
+  TestReplicator* clients[1] = {&client};
+  CHECK(server.Open());
+  CHECK(client.Open());
+  CHECK(ConnectClients(server, clients, 1));
+  UpdatePeers(server, clients, 1, 10);
+
+  PeerLink* link = server.GetLinkTo(client)->GetLink();
+  Memory::Heap* heap = Memory::GetNamedHeap("OutMessages");
+  MemCounterType allocationsBefore = heap->mData.Allocations;
+  MemCounterType activeBefore = heap->mData.Active;
+
+  // Each send allocates just its node from the heap, the data is moved in
+  const uint cMessageCount = 50;
+  bool sent = true;
+  for(uint i = 0; i < cMessageCount; ++i)
+  {
+    Message message(MessageType(0));
+    message.GetData().Write(i);
+    Status status;
+    link->Send(status, ZeroMove(message), true);
+    sent = sent && status.Succeeded();
+  }
+  CHECK(sent);
+  CHECK_EQUAL(cMessageCount, heap->mData.Allocations - allocationsBefore);
+  CHECK_EQUAL(cMessageCount, heap->mData.Active - activeBefore);
+
+  // Every node is returned once its message is acknowledged
+  bool released = false;
+  for(uint frame = 0; frame < 500 && !released; ++frame)
+  {
+    UpdatePeers(server, clients, 1, 1);
+    released = heap->mData.Active <= activeBefore;
+  }
+  CHECK(released);
+}
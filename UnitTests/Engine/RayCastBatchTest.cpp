@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file RayCastBatchTest.cpp
+///  Tests for casting batches of rays against a physics space.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// A row of spheres along x, every other one a box, so
+// rays along x hit several colliders at different distances
+void CreateRayTargets(Space* space)
+{
+  for(uint i = 0; i < 8; ++i)
+  {
+    Cog* cog = CreateTestCog(space, Vec3(real(i) * 4, 0, 0));
+    if(i % 2 == 0)
+      cog->AddComponentByName("SphereCollider");
+    else
+      cog->AddComponentByName("BoxCollider");
+  }
+  space->has(PhysicsSpace)->FlushPhysicsQueue();
+}
+
+// Rays along x through the targets at several heights, some of which miss
+void AddTestRays(RayCastBatch& batch, uint count)
+{
+  for(uint i = 0; i < count; ++i)
+  {
+    real height = real(i % 7) * real(0.25) - real(0.75);
+    real side = real(i % 3) * real(0.2);
+    real start = real(-4) + real(i % 5) * real(4);
+    batch.AddRay(Ray(Vec3(start, height, side), Vec3(1, 0, 0)));
+  }
+}
+
+// The batch's results for the ray match casting the ray on its own
+bool MatchesSingleCast(PhysicsSpace* physicsSpace, RayCastBatch& batch, uint rayIndex, uint maxCount)
+{
+  CastResultsRange single = physicsSpace->CastRay(batch.mRays[rayIndex], maxCount);
+  if(single.Size() != batch.GetResultCount(rayIndex))
+    return false;
+
+  for(uint i = 0; !single.Empty(); single.PopFront(), ++i)
+  {
+    CastResult& expected = single.Front();
+    CastResult result = batch.GetResult(rayIndex, i);
+    if(result.mObjectHit != expected.mObjectHit || Math::Abs(result.mTime - expected.mTime) > real(0.0001))
+      return false;
+  }
+  return true;
+}
+
+TEST(RayCastBatch_MatchesCastRay)
+{
+  Space* space = CreateTestSpace();
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  CreateRayTargets(space);
+
+  // Enough rays to be split across the job workers
+  const uint cRayCount = 300;
+  RayCastBatch batch;
+  AddTestRays(batch, cRayCount);
+
+  const uint maxCounts[] = {1, 3, 20};
+  for(uint maxIndex = 0; maxIndex < 3; ++maxIndex)
+  {
+    uint maxCount = maxCounts[maxIndex];
+    physicsSpace->CastRays(&batch, maxCount);
+
+    uint totalCount = 0;
+    bool matches = true;
+    for(uint rayIndex = 0; rayIndex < cRayCount; ++rayIndex)
+    {
+      matches = matches && MatchesSingleCast(physicsSpace, batch, rayIndex, maxCount);
+      totalCount += batch.GetResultCount(rayIndex);
+    }
+    CHECK(matches);
+
+    // Only the hits are stored
+    CHECK(totalCount > 0);
+    CHECK_EQUAL(totalCount, batch.mResults.Size());
+  }
+
+  // A huge count is limited instead of reserving space for every ray
+  physicsSpace->CastRays(&batch, 1000000);
+  CHECK(batch.mResults.Size() <= cRayCount * 8);
+  CHECK(MatchesSingleCast(physicsSpace, batch, cRayCount - 1, 8));
+
+  DestroyTestSpace(space);
+}
+
+TEST(RayCastBatch_SmallBatch)
+{
+  Space* space = CreateTestSpace();
+  PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+  CreateRayTargets(space);
+
+  // Cast on the calling thread, with a ray that misses everything
+  RayCastBatch batch;
+  AddTestRays(batch, 10);
+  uint missIndex = batch.AddRay(Ray(Vec3(0, 10, 0), Vec3(1, 0, 0)));
+  physicsSpace->CastRays(&batch, 4);
+
+  for(uint rayIndex = 0; rayIndex < batch.GetRayCount(); ++rayIndex)
+    CHECK(MatchesSingleCast(physicsSpace, batch, rayIndex, 4));
+  CHECK_EQUAL(0, batch.GetResultCount(missIndex));
+  CHECK(batch.GetFirst(missIndex).mObjectHit == nullptr);
+
+  // Clearing and re-casting fewer rays only keeps their results
+  batch.Clear();
+  AddTestRays(batch, 2);
+  physicsSpace->CastRays(&batch, 4);
+  CHECK_EQUAL(batch.GetResultCount(0) + batch.GetResultCount(1), batch.mResults.Size());
+
+  DestroyTestSpace(space);
+}
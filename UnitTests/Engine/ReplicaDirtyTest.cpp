@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ReplicaDirtyTest.cpp
+///  Tests for replica property dirty flag change detection.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ReplicatorTestStandard.hpp"
+
+using namespace Zero;
+
+// Spawns a replica on the server (there are no clients to send it to)
+TestReplica* SpawnTestReplica(TestReplicator& server, uint dirtyCount)
+{
+  TestReplica* replica = server.CreateReplica(dirtyCount);
+  server.SpawnReplica(replica, Route::None);
+  return replica;
+}
+
+void ObserveDirtyChannels(TestReplicator& server, uint64 frameId)
+{
+  server.GetValueChannelType()->ObserveAndReplicateDirtyChanges(server.mPeer.GetLocalTime(), frameId);
+}
+
+TEST(ReplicaDirty_MarkDirtyQueuesChannel)
+{
+  TestReplicator server(Role::Server);
+  CHECK(server.Open());
+  ReplicaChannelType* channelType = server.GetValueChannelType();
+
+  // Every value is hooked, the channel is only queued once marked dirty
+  TestReplica* replica = SpawnTestReplica(server, cTestValueCount);
+  ReplicaChannel* channel = replica->GetValueChannel();
+  CHECK(channel->IsObservedWhenDirty());
+  CHECK(!channel->IsScheduled());
+  CHECK(channelType->mDirtyChannels.Empty());
+
+  replica->SetValue(0, 5);
+  replica->SetValue(2, 7);
+  CHECK(replica->GetValueProperty(0)->IsDirty());
+  CHECK(!replica->GetValueProperty(1)->IsDirty());
+  CHECK(replica->GetValueProperty(2)->IsDirty());
+  CHECK_EQUAL(1, channelType->mDirtyChannels.Size());
+
+  // Unmarked values aren't compared
+  replica->mValues[1] = 3;
+  CHECK(!replica->GetValueProperty(1)->HasChanged());
+  CHECK(replica->GetValueProperty(1)->HasChangedAtAll());
+
+  // Observation takes the channel off of the queue and consumes its flags
+  ObserveDirtyChannels(server, 1);
+  CHECK(channelType->mDirtyChannels.Empty());
+  CHECK(!channel->mIsDirtyQueued);
+  CHECK(!replica->GetValueProperty(0)->IsDirty());
+  CHECK(!replica->GetValueProperty(0)->HasChangedAtAll());
+  CHECK(!replica->GetValueProperty(2)->HasChangedAtAll());
+  CHECK(replica->GetValueProperty(1)->HasChangedAtAll());
+  CHECK_EQUAL(1, channel->GetLastChangeFrameId());
+
+  server.ForgetReplica(replica, Route::None);
+}
+
+TEST(ReplicaDirty_UnhookedPropertiesArePolled)
+{
+  TestReplicator server(Role::Server);
+  CHECK(server.Open());
+
+  // The type uses dirty flags but no setter calls MarkDirty
+  TestReplica* unhooked = server.CreateReplica(cTestValueCount);
+  for(uint i = 0; i < cTestValueCount; ++i)
+    unhooked->GetValueProperty(i)->SetHasDirtyHook(false);
+  server.SpawnReplica(unhooked, Route::None);
+
+  ReplicaChannel* channel = unhooked->GetValueChannel();
+  CHECK(!channel->IsObservedWhenDirty());
+  CHECK(channel->IsScheduled());
+  CHECK(!unhooked->GetValueProperty(0)->UsesDirtyFlag());
+
+  // Changes made without marking are still detected
+  unhooked->mValues[0] = 4;
+  CHECK(unhooked->GetValueProperty(0)->HasChanged());
+
+  // Mixed channels are polled, only their hooked values wait to be marked
+  TestReplica* mixed = SpawnTestReplica(server, 1);
+  CHECK(!mixed->GetValueChannel()->IsObservedWhenDirty());
+  CHECK(mixed->GetValueChannel()->IsScheduled());
+  CHECK(mixed->GetValueProperty(0)->UsesDirtyFlag());
+  CHECK(!mixed->GetValueProperty(1)->UsesDirtyFlag());
+
+  mixed->mValues[0] = 1;
+  mixed->mValues[1] = 1;
+  CHECK(!mixed->GetValueProperty(0)->HasChanged());
+  CHECK(mixed->GetValueProperty(1)->HasChanged());
+  mixed->SetValue(0, 2);
+  CHECK(mixed->GetValueProperty(0)->HasChanged());
+  CHECK(server.GetValueChannelType()->mDirtyChannels.Empty());
+
+  server.ForgetReplica(unhooked, Route::None);
+  server.ForgetReplica(mixed, Route::None);
+}
+
+TEST(ReplicaDirty_DetectionInterval)
+{
+  TestReplicator server(Role::Server, 3, 6);
+  CHECK(server.Open());
+  ReplicaChannelType* channelType = server.GetValueChannelType();
+
+  TestReplica* replica = SpawnTestReplica(server, cTestValueCount);
+  ReplicaChannel* channel = replica->GetValueChannel();
+
+  // Stays queued until its awake detection frame
+  replica->SetValue(0, 1);
+  ObserveDirtyChannels(server, 1);
+  ObserveDirtyChannels(server, 2);
+  CHECK_EQUAL(1, channelType->mDirtyChannels.Size());
+  CHECK(replica->GetValueProperty(0)->IsDirty());
+
+  ObserveDirtyChannels(server, 3);
+  CHECK(channelType->mDirtyChannels.Empty());
+  CHECK(!replica->GetValueProperty(0)->IsDirty());
+  CHECK_EQUAL(3, channel->GetLastChangeFrameId());
+
+  // Napping channels wait for their nap detection frame
+  channel->TakeNap();
+  replica->SetValue(1, 1);
+  ObserveDirtyChannels(server, 3);
+  CHECK_EQUAL(1, channelType->mDirtyChannels.Size());
+
+  ObserveDirtyChannels(server, 6);
+  CHECK(channelType->mDirtyChannels.Empty());
+  CHECK(channel->IsAwake());
+  CHECK_EQUAL(6, channel->GetLastChangeFrameId());
+
+  server.ForgetReplica(replica, Route::None);
+}
+
+TEST(ReplicaDirty_UnscheduleRemovesQueuedChannel)
+{
+  TestReplicator server(Role::Server);
+  CHECK(server.Open());
+  ReplicaChannelType* channelType = server.GetValueChannelType();
+
+  // Forgetting a queued replica takes it off of the queue
+  TestReplica* queued = SpawnTestReplica(server, cTestValueCount);
+  queued->SetValue(0, 1);
+  CHECK_EQUAL(1, channelType->mDirtyChannels.Size());
+  server.ForgetReplica(queued, Route::None);
+  CHECK(channelType->mDirtyChannels.Empty());
+  CHECK(!queued->GetValueChannel()->mIsDirtyQueued);
+  ObserveDirtyChannels(server, 0);
+
+  // Marking a forgotten replica doesn't queue it
+  queued->SetValue(0, 2);
+  CHECK(channelType->mDirtyChannels.Empty());
+
+  // Forgetting a replica while the queue is being observed skips it
+  TestReplica* first = SpawnTestReplica(server, cTestValueCount);
+  TestReplica* second = SpawnTestReplica(server, cTestValueCount);
+  first->SetValue(0, 1);
+  second->SetValue(0, 1);
+  server.mForgetOnChange = second;
+  ObserveDirtyChannels(server, 1);
+  CHECK(second->IsInvalid());
+  CHECK_EQUAL(1, first->GetValueChannel()->GetLastChangeFrameId());
+  CHECK(channelType->mDirtyChannels.Empty());
+  CHECK(channelType->mObservingDirtyChannels.Empty());
+  CHECK_EQUAL(0, second->GetValueChannel()->GetLastChangeFrameId());
+
+  server.ForgetReplica(first, Route::None);
+}
@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ReplicaRelevanceTest.cpp
+///  Tests for server relevance filtering with several loopback clients.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ReplicatorTestStandard.hpp"
+
+using namespace Zero;
+
+// Server where every client views one grid cell and every replica lives in
+// one, a replica is relevant to a client within one cell of it (like the
+// net peer's relevance grid). Replicas without a cell are always relevant.
+class RelevanceTestServer : public TestReplicator
+{
+public:
+  RelevanceTestServer()
+    : TestReplicator(Role::Server)
+  {
+    SetRelevanceInterval(1);
+  }
+
+  void SetViewerCell(TestReplicator& client, IntVec2Param cell)
+  {
+    mViewerCells[client.mPeer.GetLocalIpv4Address().GetPort()] = cell;
+  }
+
+  bool IsReplicaRelevant(ReplicatorLink* link, Replica* replica) override
+  {
+    IntVec2* replicaCell = mReplicaCells.FindPointer(replica);
+    IntVec2* viewerCell = mViewerCells.FindPointer(link->GetLink()->GetTheirIpAddress().GetPort());
+    if(replicaCell == nullptr || viewerCell == nullptr)
+      return true;
+
+    IntVec2 offset = *replicaCell - *viewerCell;
+    return Math::Abs(offset.x) <= 1 && Math::Abs(offset.y) <= 1;
+  }
+
+  HashMap<uint, IntVec2> mViewerCells;
+  HashMap<Replica*, IntVec2> mReplicaCells;
+};
+
+const uint cRelevanceClientCount = 3;
+
+// Updates until every client has the server's replica
+bool WaitForReplica(TestReplicator& server, TestReplicator** clients, uint clientCount, Replica* replica)
+{
+  for(uint frame = 0; frame < 500; ++frame)
+  {
+    bool received = true;
+    for(uint i = 0; i < clientCount; ++i)
+      received = received && clients[i]->FindReplica(replica) != nullptr;
+    if(received)
+      return true;
+
+    UpdatePeers(server, clients, clientCount, 1);
+  }
+  return false;
+}
+
+int GetClientValue(TestReplicator* client, Replica* replica, uint index)
+{
+  TestReplica* clientReplica = client->FindReplica(replica);
+  return clientReplica ? clientReplica->mValues[index] : -1;
+}
+
+TEST(ReplicaRelevance_IrrelevantReplicasAreNotSent)
+{
+  RelevanceTestServer server;
+  TestReplicator nearClient(Role::Client), farClient(Role::Client), diagonalClient(Role::Client);
+  TestReplicator* clients[cRelevanceClientCount] = {&nearClient, &farClient, &diagonalClient};
+  CHECK(server.Open());
+  for(uint i = 0; i < cRelevanceClientCount; ++i)
+    CHECK(clients[i]->Open());
+  CHECK(ConnectClients(server, clients, cRelevanceClientCount));
+
+  server.SetViewerCell(nearClient, IntVec2(0, 0));
+  server.SetViewerCell(farClient, IntVec2(10, 0));
+  server.SetViewerCell(diagonalClient, IntVec2(1, 1));
+
+  // Irrelevant replicas are still spawned, only their changes stop
+  TestReplica* replica = server.CreateReplica(cTestValueCount);
+  server.mReplicaCells[replica] = IntVec2(0, 0);
+  CHECK(server.SpawnReplica(replica));
+  CHECK(WaitForReplica(server, clients, cRelevanceClientCount, replica));
+  CHECK(!server.GetLinkTo(nearClient)->IsReplicaIrrelevant(replica));
+  CHECK(server.GetLinkTo(farClient)->IsReplicaIrrelevant(replica));
+  CHECK(!server.GetLinkTo(diagonalClient)->IsReplicaIrrelevant(replica));
+
+  replica->SetValue(0, 5);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  CHECK_EQUAL(5, GetClientValue(&nearClient, replica, 0));
+  CHECK_EQUAL(0, GetClientValue(&farClient, replica, 0));
+  CHECK_EQUAL(5, GetClientValue(&diagonalClient, replica, 0));
+
+  // Moving the replica away makes it irrelevant to everyone
+  server.mReplicaCells[replica] = IntVec2(-20, 20);
+  UpdatePeers(server, clients, cRelevanceClientCount, 2);
+  replica->SetValue(1, 3);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  for(uint i = 0; i < cRelevanceClientCount; ++i)
+  {
+    CHECK(server.GetLinkTo(*clients[i])->IsReplicaIrrelevant(replica));
+    CHECK_EQUAL(0, GetClientValue(clients[i], replica, 1));
+  }
+}
+
+TEST(ReplicaRelevance_ResumesWithFullState)
+{
+  RelevanceTestServer server;
+  TestReplicator nearClient(Role::Client), farClient(Role::Client), diagonalClient(Role::Client);
+  TestReplicator* clients[cRelevanceClientCount] = {&nearClient, &farClient, &diagonalClient};
+  CHECK(server.Open());
+  for(uint i = 0; i < cRelevanceClientCount; ++i)
+    CHECK(clients[i]->Open());
+  CHECK(ConnectClients(server, clients, cRelevanceClientCount));
+
+  server.SetViewerCell(nearClient, IntVec2(4, 4));
+  server.SetViewerCell(farClient, IntVec2(-8, 4));
+  server.SetViewerCell(diagonalClient, IntVec2(5, 5));
+
+  TestReplica* replica = server.CreateReplica(cTestValueCount);
+  server.mReplicaCells[replica] = IntVec2(4, 4);
+  CHECK(server.SpawnReplica(replica));
+  CHECK(WaitForReplica(server, clients, cRelevanceClientCount, replica));
+
+  // Missed while irrelevant
+  replica->SetValue(0, 7);
+  replica->SetValue(2, 9);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  CHECK_EQUAL(0, GetClientValue(&farClient, replica, 0));
+
+  // Becoming relevant sends every value, not just later changes
+  server.SetViewerCell(farClient, IntVec2(3, 5));
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  CHECK(!server.GetLinkTo(farClient)->IsReplicaIrrelevant(replica));
+  CHECK_EQUAL(7, GetClientValue(&farClient, replica, 0));
+  CHECK_EQUAL(9, GetClientValue(&farClient, replica, 2));
+
+  // Later changes reach every client again
+  replica->SetValue(1, 4);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  for(uint i = 0; i < cRelevanceClientCount; ++i)
+    CHECK_EQUAL(4, GetClientValue(clients[i], replica, 1));
+
+  // Disabling relevance resumes every irrelevant replica
+  server.SetViewerCell(nearClient, IntVec2(40, 40));
+  UpdatePeers(server, clients, cRelevanceClientCount, 2);
+  CHECK(server.GetLinkTo(nearClient)->IsReplicaIrrelevant(replica));
+  replica->SetValue(3, 6);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  CHECK_EQUAL(0, GetClientValue(&nearClient, replica, 3));
+
+  server.SetRelevanceInterval(0);
+  UpdatePeers(server, clients, cRelevanceClientCount, 20);
+  CHECK(!server.GetLinkTo(nearClient)->IsReplicaIrrelevant(replica));
+  CHECK_EQUAL(6, GetClientValue(&nearClient, replica, 3));
+}
+
+TEST(ReplicaRelevance_QueuedChangesFlushAtMaxFrames)
+{
+  RelevanceTestServer server;
+  TestReplicator client(Role::Client);
+  TestReplicator* clients[1] = {&client};
+  CHECK(server.Open());
+  CHECK(client.Open());
+  CHECK(ConnectClients(server, clients, 1));
+  server.SetViewerCell(client, IntVec2(0, 0));
+
+  TestReplica* replica = server.CreateReplica(cTestValueCount);
+  server.mReplicaCells[replica] = IntVec2(0, 0);
+  CHECK(server.SpawnReplica(replica));
+  CHECK(WaitForReplica(server, clients, 1, replica));
+
+  // No frame budget at all, queued changes only go out once they've waited too long
+  server.SetPrioritizeChanges(true);
+  server.SetFrameFillSkip(0);
+  ReplicatorLink* link = server.GetLinkTo(client);
+
+  replica->SetValue(0, 5);
+  UpdatePeers(server, clients, 1, MaxQueuedChangeFrames / 2);
+  CHECK_EQUAL(1, link->mQueuedChanges.Size());
+  CHECK_EQUAL(0, GetClientValue(&client, replica, 0));
+
+  // Later changes wait with the first and are sent in order with it
+  replica->SetValue(0, 6);
+  replica->SetValue(1, 2);
+  UpdatePeers(server, clients, 1, MaxQueuedChangeFrames);
+  CHECK(link->mQueuedChanges.Empty());
+  UpdatePeers(server, clients, 1, 10);
+  CHECK_EQUAL(6, GetClientValue(&client, replica, 0));
+  CHECK_EQUAL(2, GetClientValue(&client, replica, 1));
+
+  // Becoming irrelevant drops the queued change, resuming sends the current state
+  replica->SetValue(2, 8);
+  UpdatePeers(server, clients, 1, 2);
+  CHECK_EQUAL(1, link->mQueuedChanges.Size());
+  server.mReplicaCells[replica] = IntVec2(9, 9);
+  UpdatePeers(server, clients, 1, 2);
+  CHECK(link->mQueuedChanges.Empty());
+
+  server.mReplicaCells[replica] = IntVec2(0, 1);
+  UpdatePeers(server, clients, 1, 10);
+  CHECK_EQUAL(8, GetClientValue(&client, replica, 2));
+}
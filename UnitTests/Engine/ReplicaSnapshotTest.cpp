@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ReplicaSnapshotTest.cpp
+///  Round trip tests for replica channel snapshot deltas.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// A snapshot of count values, each offset by the seed
+BitStream MakeSnapshot(uint seed, uint count = 16)
+{
+  BitStream snapshot;
+  for(uint i = 0; i < count; ++i)
+    snapshot.Write(uint(i * 1000 + seed));
+  return snapshot;
+}
+
+bool SnapshotsMatch(const BitStream& lhs, const BitStream& rhs)
+{
+  return lhs.GetBitsWritten() == rhs.GetBitsWritten()
+      && memcmp(lhs.GetData(), rhs.GetData(), lhs.GetBytesWritten()) == 0;
+}
+
+// Reads the baseline age written by Encode (0 if sent without a baseline)
+uint ReadBaselineAge(const BitStream& bitStream)
+{
+  SnapshotId snapshotId;
+  uint age = 0;
+  bitStream.Read(snapshotId);
+  bitStream.ReadQuantized(age, uint(0), uint(SnapshotBaselineWindow - 1));
+  bitStream.ClearBitsRead();
+  return age;
+}
+
+// Encodes the snapshot, returning its snapshot ID
+SnapshotId EncodeSnapshot(OutgoingSnapshots& outgoing, const BitStream& snapshot, BitStream& bitStream)
+{
+  bitStream.Clear(false);
+  return outgoing.Encode(snapshot, bitStream);
+}
+
+// Decodes the snapshot, returns true if it matches the expected snapshot
+bool DecodeSnapshot(IncomingSnapshots& incoming, const BitStream& bitStream, const BitStream& expected)
+{
+  BitStream snapshot;
+  bitStream.ClearBitsRead();
+  return incoming.Decode(bitStream, snapshot) && SnapshotsMatch(snapshot, expected);
+}
+
+// Acknowledges the encoded snapshot, making it the outgoing baseline
+void AcknowledgeSnapshot(OutgoingSnapshots& outgoing, SnapshotId snapshotId, const BitStream& snapshot)
+{
+  MessageReceiptId receiptId = MessageReceiptId(snapshotId.value() + 1);
+  outgoing.AddPending(snapshotId, receiptId, snapshot);
+  outgoing.HandleReceipt(receiptId, Receipt::ACK);
+}
+
+TEST(ReplicaSnapshot_NoBaseline)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  // Without an acknowledged baseline every snapshot is sent whole
+  BitStream bitStream;
+  BitStream first = MakeSnapshot(1);
+  EncodeSnapshot(outgoing, first, bitStream);
+  CHECK_EQUAL(0, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(incoming, bitStream, first));
+
+  BitStream second = MakeSnapshot(2, 20);
+  EncodeSnapshot(outgoing, second, bitStream);
+  CHECK_EQUAL(0, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(incoming, bitStream, second));
+
+  // An empty snapshot round trips too
+  BitStream empty;
+  EncodeSnapshot(outgoing, empty, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, empty));
+}
+
+TEST(ReplicaSnapshot_MatchingBaseline)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  BitStream bitStream;
+  BitStream baseline = MakeSnapshot(1);
+  SnapshotId baselineId = EncodeSnapshot(outgoing, baseline, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, baseline));
+  Bits keyBits = bitStream.GetBitsWritten();
+  AcknowledgeSnapshot(outgoing, baselineId, baseline);
+
+  // A small change is sent against the baseline in far fewer bits
+  BitStream changed = MakeSnapshot(1);
+  changed.GetDataExposed()[5] ^= 0x10;
+  EncodeSnapshot(outgoing, changed, bitStream);
+  CHECK_EQUAL(1, ReadBaselineAge(bitStream));
+  CHECK(bitStream.GetBitsWritten() < keyBits / 4);
+  CHECK(DecodeSnapshot(incoming, bitStream, changed));
+
+  // Later snapshots keep referencing the same baseline until another is acknowledged
+  BitStream grown = MakeSnapshot(3, 24);
+  EncodeSnapshot(outgoing, grown, bitStream);
+  CHECK_EQUAL(2, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(incoming, bitStream, grown));
+
+  BitStream shrunk = MakeSnapshot(1, 4);
+  EncodeSnapshot(outgoing, shrunk, bitStream);
+  CHECK_EQUAL(3, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(incoming, bitStream, shrunk));
+
+  // A lost (NAKed) snapshot never becomes the baseline
+  SnapshotId lostId = EncodeSnapshot(outgoing, grown, bitStream);
+  outgoing.AddPending(lostId, 1000, grown);
+  CHECK(outgoing.HandleReceipt(1000, Receipt::NAK));
+  CHECK(outgoing.mBaselineSnapshotId == baselineId);
+}
+
+TEST(ReplicaSnapshot_BaselineOutsideWindow)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  // Acknowledge snapshot 1, then never acknowledge another
+  BitStream bitStream;
+  BitStream snapshot = MakeSnapshot(1);
+  outgoing.mNextSnapshotId = SnapshotId(1);
+  SnapshotId baselineId = EncodeSnapshot(outgoing, snapshot, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, snapshot));
+  AcknowledgeSnapshot(outgoing, baselineId, snapshot);
+
+  // Referenced while within the window, sent whole once it's too old
+  bool agesMatch = true;
+  bool decoded = true;
+  for(uint id = 2; id <= SnapshotBaselineWindow + 2; ++id)
+  {
+    snapshot = MakeSnapshot(id);
+    SnapshotId snapshotId = EncodeSnapshot(outgoing, snapshot, bitStream);
+    uint age = uint((snapshotId - baselineId).value());
+    bool isKey = (id % SnapshotKeyInterval) == 0;
+    uint expectedAge = (isKey || age >= SnapshotBaselineWindow) ? 0 : age;
+    agesMatch = agesMatch && ReadBaselineAge(bitStream) == expectedAge;
+    decoded = decoded && DecodeSnapshot(incoming, bitStream, snapshot);
+  }
+  CHECK(agesMatch);
+  CHECK(decoded);
+
+  // Which a peer that never saw the baseline can still decode
+  IncomingSnapshots lateIncoming;
+  CHECK_EQUAL(0, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(lateIncoming, bitStream, snapshot));
+}
+
+TEST(ReplicaSnapshot_MissingBaseline)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  BitStream bitStream;
+  BitStream baseline = MakeSnapshot(1);
+  SnapshotId baselineId = EncodeSnapshot(outgoing, baseline, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, baseline));
+  AcknowledgeSnapshot(outgoing, baselineId, baseline);
+
+  BitStream delta;
+  BitStream changed = MakeSnapshot(2);
+  EncodeSnapshot(outgoing, changed, delta);
+  CHECK_EQUAL(1, ReadBaselineAge(delta));
+
+  // A peer that never received the baseline can't decode the delta
+  IncomingSnapshots missingIncoming;
+  CHECK(!DecodeSnapshot(missingIncoming, delta, changed));
+
+  // Nor can one whose history slot was since reused by a newer snapshot
+  OutgoingSnapshots newerOutgoing;
+  newerOutgoing.mNextSnapshotId = baselineId + SnapshotId(SnapshotHistorySize);
+  BitStream newer = MakeSnapshot(3);
+  EncodeSnapshot(newerOutgoing, newer, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, newer));
+  CHECK(!DecodeSnapshot(incoming, delta, changed));
+
+  // A failed decode doesn't remember the snapshot as a baseline
+  CHECK(!incoming.mHistory[(baselineId.value() + 1) % SnapshotHistorySize].mIsValid);
+}
+
+TEST(ReplicaSnapshot_KeyInterval)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  // Acknowledge the snapshot just before a key snapshot
+  BitStream bitStream;
+  BitStream baseline = MakeSnapshot(1);
+  outgoing.mNextSnapshotId = SnapshotId(SnapshotKeyInterval - 1);
+  SnapshotId baselineId = EncodeSnapshot(outgoing, baseline, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, baseline));
+  AcknowledgeSnapshot(outgoing, baselineId, baseline);
+
+  // The key snapshot ignores the fresh baseline, so a peer that lost it recovers
+  BitStream key = MakeSnapshot(2);
+  SnapshotId keyId = EncodeSnapshot(outgoing, key, bitStream);
+  CHECK_EQUAL(0, keyId.value() % SnapshotKeyInterval);
+  CHECK_EQUAL(0, ReadBaselineAge(bitStream));
+  IncomingSnapshots recoveringIncoming;
+  CHECK(DecodeSnapshot(recoveringIncoming, bitStream, key));
+  CHECK(DecodeSnapshot(incoming, bitStream, key));
+
+  // The snapshot after it goes back to the baseline
+  BitStream next = MakeSnapshot(3);
+  EncodeSnapshot(outgoing, next, bitStream);
+  CHECK_EQUAL(2, ReadBaselineAge(bitStream));
+  CHECK(DecodeSnapshot(incoming, bitStream, next));
+  CHECK(!DecodeSnapshot(recoveringIncoming, bitStream, next));
+}
+
+TEST(ReplicaSnapshot_TruncatedStream)
+{
+  OutgoingSnapshots outgoing;
+  IncomingSnapshots incoming;
+
+  BitStream bitStream;
+  BitStream baseline = MakeSnapshot(1);
+  SnapshotId baselineId = EncodeSnapshot(outgoing, baseline, bitStream);
+  CHECK(DecodeSnapshot(incoming, bitStream, baseline));
+  AcknowledgeSnapshot(outgoing, baselineId, baseline);
+
+  // Every bit of the delta is needed, any shorter stream is rejected
+  BitStream grown = MakeSnapshot(2, 20);
+  EncodeSnapshot(outgoing, grown, bitStream);
+  bool rejected = true;
+  for(Bits bits = 0; bits < bitStream.GetBitsWritten(); ++bits)
+  {
+    BitStream truncated = bitStream;
+    truncated.SetBitsWritten(bits);
+    rejected = rejected && !DecodeSnapshot(incoming, truncated, grown);
+  }
+  CHECK(rejected);
+  CHECK(DecodeSnapshot(incoming, bitStream, grown));
+
+  // A size larger than the remaining data is rejected without reading it
+  BitStream oversized;
+  oversized.Write(SnapshotId(5));
+  oversized.WriteQuantized(uint(0), uint(0), uint(SnapshotBaselineWindow - 1));
+  oversized.Write(false);
+  oversized.Write(Bytes(1000000));
+  oversized.Write(false);
+  CHECK(!DecodeSnapshot(incoming, oversized, grown));
+}
@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ReplicatorTestStandard.cpp
+///  Replicator and replica used to test replication without net objects.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "ReplicatorTestStandard.hpp"
+
+namespace Zero
+{
+
+void IgnoreCustomPacket(Peer* peer, InPacket& packet)
+{
+}
+
+bool IgnoreCustomMessage(PeerLink* link, Message& message)
+{
+  return true;
+}
+
+//---------------------------------------------------------------------------------//
+//                                 TestReplica                                     //
+//---------------------------------------------------------------------------------//
+
+TestReplica::TestReplica(TestReplicator* replicator, uint dirtyCount)
+  : Replica(CreateContext(String("TestContext")), ReplicaType(dirtyCount))
+{
+  ReplicaChannel* channel = AddReplicaChannel(ReplicaChannelPtr(new ReplicaChannel("Values", replicator->GetValueChannelType())));
+  for(uint i = 0; i < cTestValueCount; ++i)
+  {
+    mValues[i] = 0;
+
+    cstr typeName = (i < dirtyCount) ? "DirtyValue" : "Value";
+    ReplicaPropertyType* propertyType = replicator->GetReplicaPropertyType(typeName);
+    String name = String::Format("Value%u", i);
+    ReplicaProperty* property = channel->AddReplicaProperty(ReplicaPropertyPtr(new ReplicaProperty(name, propertyType, Variant(&mValues[i]))));
+    property->SetHasDirtyHook(i < dirtyCount);
+  }
+}
+
+void TestReplica::SetValue(uint index, int value)
+{
+  mValues[index] = value;
+  GetValueProperty(index)->MarkDirty();
+}
+
+ReplicaChannel* TestReplica::GetValueChannel()
+{
+  return GetReplicaChannel("Values");
+}
+
+ReplicaProperty* TestReplica::GetValueProperty(uint index)
+{
+  return GetValueChannel()->GetReplicaProperty(String::Format("Value%u", index));
+}
+
+//---------------------------------------------------------------------------------//
+//                                TestReplicator                                   //
+//---------------------------------------------------------------------------------//
+
+TestReplicator::TestReplicator(Role::Enum role, uint awakeDetectionInterval, uint napDetectionInterval)
+  : Replicator(role),
+    mPeer(IgnoreCustomPacket, IgnoreCustomMessage),
+    mForgetOnChange(nullptr)
+{
+  ReplicaChannelType* channelType = new ReplicaChannelType("Values");
+  channelType->SetDetectionMode(DetectionMode::Automatic);
+  channelType->SetNotifyOnOutgoingPropertyChange(true);
+  channelType->SetAwakeDetectionInterval(awakeDetectionInterval);
+  channelType->SetNapDetectionInterval(napDetectionInterval);
+  AddReplicaChannelType(ReplicaChannelTypePtr(channelType));
+
+  AddReplicaPropertyType(ReplicaPropertyTypePtr(new ReplicaPropertyType("Value", NativeTypeOf(int),
+    SerializeKnownBasicVariant, GetDataValue<int>, SetDataValue<int>)));
+
+  ReplicaPropertyType* dirtyType = new ReplicaPropertyType("DirtyValue", NativeTypeOf(int),
+    SerializeKnownBasicVariant, GetDataValue<int>, SetDataValue<int>);
+  dirtyType->SetUseDirtyFlag(true);
+  AddReplicaPropertyType(ReplicaPropertyTypePtr(dirtyType));
+}
+
+TestReplicator::~TestReplicator()
+{
+  Close();
+  while(!mReplicas.Empty())
+    DeleteReplica(mReplicas.Back());
+}
+
+bool TestReplicator::Open()
+{
+  if(!mPeer.AddPlugin(this, "Replicator"))
+    return false;
+
+  Status status;
+  mPeer.Open(status, AnyPort, InternetProtocol::V4);
+  return status.Succeeded();
+}
+
+void TestReplicator::Close()
+{
+  mPeer.Close();
+}
+
+bool TestReplicator::Connect(TestReplicator& server)
+{
+  IpAddress serverAddress("127.0.0.1", server.mPeer.GetLocalIpv4Address().GetPort());
+  PeerLink* link = mPeer.CreateLink(serverAddress);
+  return link != nullptr && link->Connect();
+}
+
+bool TestReplicator::IsConnected(uint linkCount)
+{
+  if(GetLinks().Size() != linkCount)
+    return false;
+  return GetRole() == Role::Server || GetReplicatorId() != 0;
+}
+
+ReplicatorLink* TestReplicator::GetLinkTo(TestReplicator& peer)
+{
+  uint peerPort = peer.mPeer.GetLocalIpv4Address().GetPort();
+  PeerLinkSet links = GetLinks();
+  forRange(PeerLink* link, links.All())
+  {
+    if(link->GetTheirIpAddress().GetPort() == peerPort)
+      return link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+  }
+  return nullptr;
+}
+
+TestReplica* TestReplicator::CreateReplica(uint dirtyCount)
+{
+  TestReplica* replica = new TestReplica(this, dirtyCount);
+  mReplicas.PushBack(replica);
+  return replica;
+}
+
+void TestReplicator::DeleteReplica(Replica* replica)
+{
+  Assert(replica->IsInvalid());
+  TestReplica* testReplica = static_cast<TestReplica*>(replica);
+  mReplicas.EraseValueError(testReplica);
+  delete testReplica;
+}
+
+ReplicaChannelType* TestReplicator::GetValueChannelType()
+{
+  return GetReplicaChannelType("Values");
+}
+
+TestReplica* TestReplicator::FindReplica(Replica* replica)
+{
+  return static_cast<TestReplica*>(GetReplica(replica->GetReplicaId()));
+}
+
+bool TestReplicator::SerializeReplicas(const ReplicaArray& replicas, ReplicaStream& replicaStream)
+{
+  // Every test replica is spawned, so clones create them too
+  ReplicaStreamMode::Enum mode = replicaStream.GetReplicaStreamMode();
+  bool isCreate = (mode == ReplicaStreamMode::Spawn || mode == ReplicaStreamMode::Clone);
+
+  forRange(Replica* replica, replicas.All())
+  {
+    if(isCreate && !replicaStream.WriteCreationInfo(replica))
+      return false;
+    if(!replicaStream.WriteIdentificationInfo(false, replica))
+      return false;
+    if(!replicaStream.WriteChannelData(replica))
+      return false;
+  }
+  return true;
+}
+
+bool TestReplicator::DeserializeReplicas(const ReplicaStream& replicaStream, ReplicaArray& replicas)
+{
+  ReplicaStreamMode::Enum mode = replicaStream.GetReplicaStreamMode();
+  bool isCreate = (mode == ReplicaStreamMode::Spawn || mode == ReplicaStreamMode::Clone);
+
+  while(replicaStream.GetBitStream().GetBitsUnread())
+  {
+    Replica* replica = nullptr;
+    bool isAbsent = false;
+    if(isCreate)
+    {
+      CreateContext createContext;
+      ReplicaType replicaType;
+      if(!replicaStream.ReadCreationInfo(createContext, replicaType))
+        return false;
+
+      replica = CreateReplica(replicaType.GetOrError<uint>());
+      if(!replicaStream.ReadIdentificationInfo(isAbsent, replica))
+        return false;
+    }
+    else
+    {
+      ReplicaId replicaId = 0;
+      bool isCloned = false;
+      bool isEmplaced = false;
+      EmplaceContext emplaceContext;
+      EmplaceId emplaceId = 0;
+      if(!replicaStream.ReadIdentificationInfo(isAbsent, replicaId, isCloned, isEmplaced, emplaceContext, emplaceId))
+        return false;
+
+      replica = GetReplica(replicaId);
+      if(!replica)
+        return false;
+    }
+
+    if(!replicaStream.ReadChannelData(replica))
+      return false;
+    replicas.PushBack(replica);
+  }
+  return !replicas.Empty();
+}
+
+bool TestReplicator::ReleaseReplicas(const ReplicaArray& replicas)
+{
+  forRange(Replica* replica, replicas.All())
+    if(replica)
+      DeleteReplica(replica);
+  return true;
+}
+
+void TestReplicator::OnReplicaChannelPropertyChange(TimeMs timestamp, ReplicationPhase::Enum replicationPhase, Replica* replica,
+                                                    ReplicaChannel* replicaChannel, ReplicaProperty* replicaProperty,
+                                                    TransmissionDirection::Enum direction)
+{
+  if(direction != TransmissionDirection::Outgoing || !mForgetOnChange)
+    return;
+
+  Replica* forget = mForgetOnChange;
+  mForgetOnChange = nullptr;
+  ForgetReplica(forget, Route::None);
+}
+
+void UpdatePeers(TestReplicator& server, TestReplicator** clients, uint clientCount, uint frames)
+{
+  for(uint frame = 0; frame < frames; ++frame)
+  {
+    Os::Sleep(2);
+    server.mPeer.Update();
+    for(uint i = 0; i < clientCount; ++i)
+      clients[i]->mPeer.Update();
+  }
+}
+
+bool ConnectClients(TestReplicator& server, TestReplicator** clients, uint clientCount)
+{
+  for(uint i = 0; i < clientCount; ++i)
+  {
+    if(!clients[i]->Connect(server))
+      return false;
+  }
+
+  // Loopback connects in a few frames, give up after a couple seconds
+  for(uint frame = 0; frame < 1000; ++frame)
+  {
+    bool connected = server.IsConnected(clientCount);
+    for(uint i = 0; i < clientCount; ++i)
+      connected = connected && clients[i]->IsConnected(1);
+    if(connected)
+      return true;
+
+    UpdatePeers(server, clients, clientCount, 1);
+  }
+  return false;
+}
+
+}//namespace Zero
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file ReplicatorTestStandard.hpp
+///  Replicator and replica used to test replication without net objects.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "EngineTestStandard.hpp"
+
+namespace Zero
+{
+
+class TestReplicator;
+
+/// Number of int values on every test replica
+const uint cTestValueCount = 4;
+
+/// Replica with a single "Values" channel of int values. The first dirty count
+/// values use dirty flags and are marked dirty by SetValue, the rest are polled.
+class TestReplica : public Replica
+{
+public:
+  TestReplica(TestReplicator* replicator, uint dirtyCount);
+
+  /// Sets the value and marks it dirty, like a hooked property setter
+  void SetValue(uint index, int value);
+
+  ReplicaChannel* GetValueChannel();
+  ReplicaProperty* GetValueProperty(uint index);
+
+  int mValues[cTestValueCount];
+};
+
+/// Replicator on its own peer that creates and deletes test replicas.
+class TestReplicator : public Replicator
+{
+public:
+  /// The detection intervals configure the "Values" channel type
+  TestReplicator(Role::Enum role, uint awakeDetectionInterval = 1, uint napDetectionInterval = 2);
+  ~TestReplicator();
+
+  /// Opens the peer on any port, returns true if successful
+  bool Open();
+  /// Closes the peer, forgetting every replica
+  void Close();
+  /// [Client] Connects to the server's peer over loopback, returns true if the link was created
+  bool Connect(TestReplicator& server);
+  /// Returns true if connected to the link count of peers (and given a replicator ID as a client)
+  bool IsConnected(uint linkCount);
+  /// Returns the replicator link to the peer, else null
+  ReplicatorLink* GetLinkTo(TestReplicator& peer);
+
+  /// Creates an invalid replica owned by this replicator
+  TestReplica* CreateReplica(uint dirtyCount);
+  /// Deletes the invalid replica
+  void DeleteReplica(Replica* replica);
+
+  ReplicaChannelType* GetValueChannelType();
+  /// Returns our replica with the same replica ID as the other replicator's replica, else null
+  TestReplica* FindReplica(Replica* replica);
+
+  // Replicator Interface
+  bool SerializeReplicas(const ReplicaArray& replicas, ReplicaStream& replicaStream) override;
+  bool DeserializeReplicas(const ReplicaStream& replicaStream, ReplicaArray& replicas) override;
+  bool ReleaseReplicas(const ReplicaArray& replicas) override;
+  void OnReplicaChannelPropertyChange(TimeMs timestamp, ReplicationPhase::Enum replicationPhase, Replica* replica,
+                                      ReplicaChannel* replicaChannel, ReplicaProperty* replicaProperty,
+                                      TransmissionDirection::Enum direction) override;
+
+  Peer mPeer;
+  Array<TestReplica*> mReplicas;
+  /// Forgotten when any outgoing change is observed (if set)
+  Replica* mForgetOnChange;
+};
+
+/// Updates the server and every client once a frame for the frame count,
+/// sleeping between frames so time passes and loopback packets arrive.
+void UpdatePeers(TestReplicator& server, TestReplicator** clients, uint clientCount, uint frames);
+
+/// Connects every client to the server, updating until they're all connected
+/// or too many frames pass. Returns true if every client is connected.
+bool ConnectClients(TestReplicator& server, TestReplicator** clients, uint clientCount);
+
+}//namespace Zero
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file SpeculativeContactsTest.cpp
+///  Benchmark of speculative continuous collision on many fast projectiles.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// 32 x 32 spheres fired at a wall they move 5 times their radius past each frame
+const uint cProjectileRows = 32;
+const real cProjectileSpeed = real(300);
+const real cProjectileWallX = real(22);
+const uint cProjectileFrames = 30;
+
+// Creates the thin static wall and the projectiles flying at it, returns the projectiles
+void CreateProjectiles(Space* space, Array<Cog*>& projectiles)
+{
+  Cog* wall = CreateTestCog(space, Vec3(cProjectileWallX, 0, 0));
+  wall->AddComponentByName("BoxCollider");
+  wall->has(BoxCollider)->SetSize(Vec3(1, 40, 40));
+
+  real offset = real(cProjectileRows - 1) * real(-0.625);
+  for(uint y = 0; y < cProjectileRows; ++y)
+  {
+    for(uint z = 0; z < cProjectileRows; ++z)
+    {
+      Vec3 position(0, offset + real(y) * real(1.25), offset + real(z) * real(1.25));
+      Cog* projectile = CreateTestCog(space, position);
+      projectile->AddComponentByName("RigidBody");
+      projectile->AddComponentByName("SphereCollider");
+      projectiles.PushBack(projectile);
+    }
+  }
+  space->has(PhysicsSpace)->FlushPhysicsQueue();
+
+  for(uint i = 0; i < projectiles.Size(); ++i)
+    projectiles[i]->has(RigidBody)->SetVelocity(Vec3(cProjectileSpeed, 0, 0));
+}
+
+// Steps the projectiles with the collision mode, returns how many passed through the wall
+uint RunProjectiles(PhysicsContinuousCollisionMode::Enum mode, cstr name)
+{
+  Space* space = CreateTestSpace();
+  CloneSolverConfig(space)->SetContinuousCollisionMode(mode);
+
+  Array<Cog*> projectiles;
+  CreateProjectiles(space, projectiles);
+  {
+    BenchmarkTimer timer(name);
+    StepPhysics(space, cProjectileFrames);
+  }
+
+  uint tunneled = 0;
+  for(uint i = 0; i < projectiles.Size(); ++i)
+    tunneled += projectiles[i]->has(Transform)->GetWorldTranslation().x > cProjectileWallX ? 1 : 0;
+
+  DestroyTestSpace(space);
+  return tunneled;
+}
+
+// Timings are written to the console (compare the None and Speculative lines)
+TEST(SpeculativeContacts_BenchmarkProjectiles)
+{
+  // Without continuous collision the projectiles step over the wall
+  CHECK(RunProjectiles(PhysicsContinuousCollisionMode::None, "1024 projectiles no continuous collision") > 0);
+  CHECK_EQUAL(0, RunProjectiles(PhysicsContinuousCollisionMode::Speculative, "1024 projectiles Speculative continuous collision"));
+}
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file TransformHierarchyTest.cpp
+///  Tests for the TransformHierarchy world matrix cache.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// Enables the hierarchy for the transforms created while it's in scope
+struct UseTransformHierarchy
+{
+  UseTransformHierarchy() { Transform::sUseTransformHierarchy = true; }
+  ~UseTransformHierarchy() { Transform::sUseTransformHierarchy = false; }
+};
+
+// The world matrix built from the local matrices, without any cache
+Mat4 ComputeWorldMatrix(Transform* transform)
+{
+  Mat4 local = transform->GetLocalMatrix();
+  if(transform->TransformParent && !transform->GetInWorld())
+    return ComputeWorldMatrix(transform->TransformParent) * local;
+  return local;
+}
+
+bool WorldMatrixMatches(Cog* cog)
+{
+  Transform* transform = cog->has(Transform);
+  Mat4 cached = transform->GetWorldMatrix();
+  Mat4 expected = ComputeWorldMatrix(transform);
+  for(uint i = 0; i < 16; ++i)
+  {
+    if(Math::Abs(cached.array[i] - expected.array[i]) > real(0.0001))
+      return false;
+  }
+  return true;
+}
+
+// A chain of cogs each offset, rotated and scaled relative to the last
+void CreateChain(Space* space, Cog** cogs, uint count)
+{
+  for(uint i = 0; i < count; ++i)
+  {
+    cogs[i] = CreateTestCog(space, Vec3(1, real(i), 0));
+    Transform* transform = cogs[i]->has(Transform);
+    transform->SetLocalRotation(Math::ToQuaternion(Vec3::cYAxis, real(0.25) * real(i + 1)));
+    transform->SetLocalScale(Vec3(real(1.5), 1, 1));
+    if(i > 0)
+      cogs[i]->AttachToPreserveLocal(cogs[i - 1]);
+  }
+}
+
+TEST(TransformHierarchy_Reparent)
+{
+  UseTransformHierarchy useHierarchy;
+  Space* space = CreateTestSpace();
+  TransformHierarchy* hierarchy = space->GetTransformHierarchy();
+
+  Cog* chain[3];
+  CreateChain(space, chain, 3);
+  Cog* other = CreateTestCog(space, Vec3(0, 0, 5));
+  CHECK_EQUAL(4, hierarchy->GetCount());
+
+  hierarchy->Update();
+  for(uint i = 0; i < 3; ++i)
+    CHECK(WorldMatrixMatches(chain[i]));
+
+  // Moving the leaf under the other root is seen before and after the rebuild
+  chain[2]->AttachToPreserveLocal(other);
+  CHECK(WorldMatrixMatches(chain[2]));
+  hierarchy->Update();
+  CHECK(WorldMatrixMatches(chain[2]));
+
+  // Detaching makes it a root, moving the old parent no longer moves it
+  chain[2]->DetachPreserveLocal();
+  hierarchy->Update();
+  chain[1]->has(Transform)->SetLocalTranslation(Vec3(7, 0, 0));
+  hierarchy->Update();
+  CHECK(WorldMatrixMatches(chain[1]));
+  CHECK(WorldMatrixMatches(chain[2]));
+
+  // Reattaching a root under a deeper transform moves it below it in the order
+  chain[0]->AttachToPreserveLocal(chain[2]);
+  chain[2]->has(Transform)->SetLocalScale(Vec3(2, 2, 2));
+  hierarchy->Update();
+  for(uint i = 0; i < 3; ++i)
+    CHECK(WorldMatrixMatches(chain[i]));
+
+  DestroyTestSpace(space);
+}
+
+TEST(TransformHierarchy_DirtySubtree)
+{
+  UseTransformHierarchy useHierarchy;
+  Space* space = CreateTestSpace();
+  TransformHierarchy* hierarchy = space->GetTransformHierarchy();
+
+  const uint cDepth = 5;
+  Cog* chain[cDepth];
+  CreateChain(space, chain, cDepth);
+  Cog* sibling = CreateTestCog(space, Vec3(3, 0, 0));
+  sibling->AttachToPreserveLocal(chain[1]);
+  hierarchy->Update();
+
+  // Changing the middle of the chain dirties everything below it, the
+  // leaf is computed on demand through its dirty parents
+  Transform* middle = chain[2]->has(Transform);
+  middle->SetLocalTranslation(Vec3(0, 4, 0));
+  CHECK(WorldMatrixMatches(chain[cDepth - 1]));
+
+  // The rest of the subtree is recomputed by the update
+  middle->SetLocalRotation(Math::ToQuaternion(Vec3::cZAxis, real(1.0)));
+  hierarchy->Update();
+  for(uint i = 0; i < cDepth; ++i)
+    CHECK(WorldMatrixMatches(chain[i]));
+  CHECK(WorldMatrixMatches(sibling));
+
+  // The root moves every transform, including the sibling branch
+  chain[0]->has(Transform)->SetWorldTranslation(Vec3(-2, 1, 3));
+  hierarchy->Update();
+  for(uint i = 0; i < cDepth; ++i)
+    CHECK(WorldMatrixMatches(chain[i]));
+  CHECK(WorldMatrixMatches(sibling));
+
+  DestroyTestSpace(space);
+}
+
+TEST(TransformHierarchy_Remove)
+{
+  UseTransformHierarchy useHierarchy;
+  Space* space = CreateTestSpace();
+  TransformHierarchy* hierarchy = space->GetTransformHierarchy();
+
+  Cog* first[3];
+  Cog* second[3];
+  CreateChain(space, first, 3);
+  CreateChain(space, second, 3);
+  hierarchy->Update();
+  CHECK_EQUAL(6, hierarchy->GetCount());
+
+  // Removing a leaf and a whole chain leaves holes until the next update
+  first[2]->ForceDestroy();
+  second[0]->ForceDestroy();
+  Z::gTracker->ClearDeletedObjects();
+  CHECK_EQUAL(2, hierarchy->GetCount());
+
+  first[0]->has(Transform)->SetLocalTranslation(Vec3(0, 0, -6));
+  CHECK(WorldMatrixMatches(first[1]));
+  hierarchy->Update();
+  CHECK_EQUAL(2, hierarchy->GetCount());
+  CHECK(WorldMatrixMatches(first[0]));
+  CHECK(WorldMatrixMatches(first[1]));
+
+  // Transforms added after the compaction are stored with the remaining ones
+  Cog* added = CreateTestCog(space, Vec3(1, 1, 1));
+  added->AttachToPreserveLocal(first[1]);
+  first[0]->has(Transform)->SetLocalScale(Vec3(3, 3, 3));
+  hierarchy->Update();
+  CHECK_EQUAL(3, hierarchy->GetCount());
+  CHECK(WorldMatrixMatches(added));
+
+  DestroyTestSpace(space);
+}
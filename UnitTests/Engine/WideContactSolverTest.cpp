@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///  \file WideContactSolverTest.cpp
+///  Benchmark of the wide contact solver on a pyramid of boxes.
+///
+///  Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "EngineTestStandard.hpp"
+
+using namespace Zero;
+
+// 24 square layers of unit boxes, 4900 boxes in all
+const uint cPyramidLayers = 24;
+const uint cPyramidFrames = 30;
+
+// Creates the pyramid on a static ground box and returns the boxes
+void CreateBoxPyramid(Space* space, Array<Cog*>& boxes)
+{
+  Cog* ground = CreateTestCog(space, Vec3(0, real(-0.5), 0));
+  ground->AddComponentByName("BoxCollider");
+  ground->has(BoxCollider)->SetSize(Vec3(100, 1, 100));
+
+  for(uint layer = 0; layer < cPyramidLayers; ++layer)
+  {
+    uint width = cPyramidLayers - layer;
+    real offset = real(width - 1) * real(-0.5);
+    for(uint x = 0; x < width; ++x)
+    {
+      for(uint z = 0; z < width; ++z)
+      {
+        Vec3 position(offset + real(x), real(layer) + real(0.5), offset + real(z));
+        Cog* box = CreateTestCog(space, position);
+        box->AddComponentByName("RigidBody");
+        box->AddComponentByName("BoxCollider");
+        boxes.PushBack(box);
+      }
+    }
+  }
+  space->has(PhysicsSpace)->FlushPhysicsQueue();
+}
+
+// Steps the pyramid with the solver type, returns true if no box fell through the ground
+bool RunPyramid(PhysicsSolverType::Enum solverType, cstr name)
+{
+  Space* space = CreateTestSpace();
+  CloneSolverConfig(space)->SetSolverType(solverType);
+
+  Array<Cog*> boxes;
+  CreateBoxPyramid(space, boxes);
+  {
+    BenchmarkTimer timer(name);
+    StepPhysics(space, cPyramidFrames);
+  }
+
+  bool resting = true;
+  for(uint i = 0; i < boxes.Size(); ++i)
+    resting = resting && boxes[i]->has(Transform)->GetWorldTranslation().y > real(0.25);
+
+  DestroyTestSpace(space);
+  return resting;
+}
+
+// Timings are written to the console (compare the Normal and WideContact lines)
+TEST(WideContactSolver_BenchmarkPyramid)
+{
+  CHECK(RunPyramid(PhysicsSolverType::Normal, "4900 box pyramid Normal solver"));
+  CHECK(RunPyramid(PhysicsSolverType::WideContact, "4900 box pyramid WideContact solver"));
+}
@@ -0,0 +1,52 @@
+#include "EngineTestStandard.hpp"
+#include "CppUnitLite2/TestResultStdErr.h"
+#include "CppUnitLite2/Win32/TestResultDebugOut.h"
+
+#include "Platform/Windows/Windows.hpp"
+
+int __cdecl UnitTestReportHook( int reportType, char *message, int *returnValue )
+{
+  (void)returnValue;
+  switch(reportType)
+  {
+  case _CRT_ASSERT:
+    throw CppUnitLite::TestException( __FILE__, 0 , message );
+  }
+  return 0;
+}
+
+bool UnitTestErrorHandler(Zero::ErrorSignaler::ErrorData& errorData)
+{
+  throw CppUnitLite::TestException( errorData.File , errorData.Line , errorData.Message );
+  return true;
+}
+
+class VisualStudioConsoleListener : public Zero::ConsoleListener
+{
+  void Print(Zero::FilterType filterType, cstr message)
+  {
+    OutputDebugStringA(message);
+  }
+};
+
+int main()
+{
+  VisualStudioConsoleListener vs;
+  Zero::Console::Add(&vs);
+
+  // Startup errors aren't inside a test, only throw once the tests run
+  Zero::ZeroStartup startup;
+  Zero::InitializeTestEngine(startup);
+
+  Zero::ErrorSignaler::SetErrorHandler(UnitTestErrorHandler);
+  _CrtSetReportHook2( 0 , UnitTestReportHook );
+
+  //CppUnitLite::TestResultStdErr result;
+  CppUnitLite::TestResultDebugOut result;
+
+  CppUnitLite::TestRegistry::Instance().Run(result);
+  CppUnitLite::TestRegistry::Destroy();
+
+  Zero::ShutdownTestEngine(startup);
+  return (result.FailureCount());
+}
@@ -67,13 +67,18 @@ public:
 #include "Containers/Hashing.hpp"
 #include "Containers/HashMap.hpp"
 #include "Containers/HashSet.hpp"
+#include "Containers/FlatHashMap.hpp"
+#include "Containers/FlatHashSet.hpp"
+#include "Containers/MpscRing.hpp"
 #include "Containers/SlotMap.hpp"
 #include "Memory/Block.hpp"
+#include "Memory/FrameAllocator.hpp"
 #include "Memory/Graph.hpp"
 #include "Memory/Heap.hpp"
 #include "Memory/LocalStackAllocator.hpp"
 #include "Memory/Memory.hpp"
 #include "Memory/Pool.hpp"
+#include "Memory/SizeClassAllocator.hpp"
 #include "Memory/Stack.hpp"
 #include "Memory/ZeroAllocator.hpp"
 #include "NullPtr.hpp"
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file FlatHashSet.hpp
+/// Definition of the FlatHashSet associative container.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "HashSet.hpp"
+#include "FlatHashedContainer.hpp"
+
+namespace Zero
+{
+
+///Flat Hash Set is an open addressing Associative Hashed Container with the
+///same interface as HashSet. Values move on insert and erase.
+template< typename ValueType,
+          typename Hasher = HashPolicy<ValueType>,
+          typename Allocator = DefaultAllocator >
+class ZeroSharedTemplate FlatHashSet : public FlatHashedContainer< ValueType,
+                                                                   SetHashAdapter< Hasher, ValueType >,
+                                                                   Allocator >
+{
+public:
+  typedef ValueType value_type;
+  typedef size_t size_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef FlatHashSet<ValueType, Hasher, Allocator> this_type;
+  typedef FlatHashedContainer< ValueType,
+                               SetHashAdapter< Hasher, ValueType >,
+                               Allocator > base_type;
+  typedef typename base_type::Node* iterator;
+  typedef typename base_type::Node Node;
+  typedef typename base_type::range range;
+
+  FlatHashSet()
+  {
+  }
+
+  ///Warning: Depending on the contents of the hash sets, this may be expensive.
+  FlatHashSet(const FlatHashSet& other)
+    : base_type(other)
+  {
+  }
+
+  ///Warning: Depending on the contents of the hash sets, this may be expensive.
+  void operator = (const FlatHashSet& other)
+  {
+    base_type::operator=(other);
+  }
+
+  range Find(const value_type& value)
+  {
+    //searching for the actual type of the container.
+    Node* node = base_type::InternalFindAs(value, base_type::mHasher);
+    return SingleRange(node);
+  }
+
+  template<typename searchType, typename searchHasher>
+  range FindAs(const searchType& searchKey,
+                searchHasher keyHasher = HashPolicy<searchType>()) const
+  {
+    Node* node = base_type::InternalFindAs(searchKey, keyHasher);
+    return SingleRange(node);
+  }
+
+  value_type FindValue(const value_type& searchKey, const value_type& ifNotFound) const
+  {
+    Node* node = base_type::InternalFindAs(searchKey, base_type::mHasher);
+    if(node != nullptr)
+      return node->Value;
+    else
+      return ifNotFound;
+  }
+
+  //Returns a pointer to the value if found, or null if not found
+  value_type* FindPointer(const value_type& searchKey) const
+  {
+    Node* foundNode = base_type::InternalFindAs(searchKey, base_type::mHasher);
+    if(foundNode != nullptr)
+      return &(foundNode->Value);
+    else
+      return nullptr;
+  }
+
+  template<typename inputRangeType>
+  void Append(inputRangeType inputRange)
+  {
+    for(; !inputRange.Empty(); inputRange.PopFront())
+      Insert(inputRange.Front());
+  }
+
+  void Insert(const value_type& value)
+  {
+    base_type::InsertInternal(value, base_type::OnCollisionOverride);
+  }
+
+  bool InsertOrError(const value_type& value)
+  {
+    return base_type::InsertInternal(value, base_type::OnCollisionError) != false;
+  }
+
+  bool InsertOrError(const value_type& value, cstr error)
+  {
+    bool result = InsertOrError(value);
+    ErrorIf(result == false, "%s", error);
+    return result;
+  }
+
+  bool InsertNoOverwrite(const value_type& value)
+  {
+    return base_type::InsertInternal(value, base_type::OnCollisionReturn) != false;
+  }
+
+  bool Contains(const value_type& value) const
+  {
+    return base_type::InternalFindAs(value, base_type::mHasher) != nullptr;
+  }
+
+  ~FlatHashSet()
+  {
+  }
+
+private:
+  range SingleRange(Node* node) const
+  {
+    if(node == nullptr)
+      return range();
+
+    size_type index = node - base_type::mTable;
+    return range(node, node + 1, base_type::mControl + index, 1);
+  }
+};
+
+}//namespace Zero
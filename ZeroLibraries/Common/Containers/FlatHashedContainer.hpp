@@ -0,0 +1,608 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file FlatHashedContainer.hpp
+/// Open addressing container used to implement FlatHashMap and FlatHashSet.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Allocator.hpp"
+#include "Hashing.hpp"
+
+// Probe 16 control bytes at a time when SSE2 is available
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define ZeroFlatHashSse 1
+  #include <emmintrin.h>
+#else
+  #define ZeroFlatHashSse 0
+#endif
+
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+namespace Zero
+{
+
+// Control byte for an empty slot, every other control byte
+// holds the low 7 bits of the stored value's (mixed) hash
+const u8 cFlatHashEmpty = 0x80;
+
+// Number of control bytes compared in a single probe
+const size_t cFlatHashGroupSize = 16;
+
+// The hashes from HashPolicy are often weak in their low bits (pointers
+// are aligned, small ints are sequential) and we mask rather than mod, so
+// every hash is mixed before it is used (murmur3 finalizer)
+inline size_t FlatHashMix(size_t hash)
+{
+  u32 mixed = (u32)hash ^ (u32)((u64)hash >> 32);
+  mixed ^= mixed >> 16;
+  mixed *= 0x85ebca6b;
+  mixed ^= mixed >> 13;
+  mixed *= 0xc2b2ae35;
+  mixed ^= mixed >> 16;
+  return (size_t)mixed;
+}
+
+// Index of the lowest set bit (mask must not be zero)
+inline uint FlatHashLowestBit(u32 mask)
+{
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return (uint)index;
+#else
+  return (uint)__builtin_ctz(mask);
+#endif
+}
+
+//------------------------------------------------------------- Flat Hash Group
+// A window of control bytes that can be matched against at once.
+// Bit i of each mask is set if control byte i matched.
+struct FlatHashGroup
+{
+#if ZeroFlatHashSse
+  explicit FlatHashGroup(const u8* control)
+  {
+    mControl = _mm_loadu_si128((const __m128i*)control);
+  }
+
+  u32 Match(u8 hashBits) const
+  {
+    __m128i match = _mm_set1_epi8((char)hashBits);
+    return (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(match, mControl));
+  }
+
+  u32 MatchEmpty() const
+  {
+    // Only empty slots have the high bit set
+    return (u32)_mm_movemask_epi8(mControl);
+  }
+
+  __m128i mControl;
+#else
+  explicit FlatHashGroup(const u8* control)
+  {
+    mControl = control;
+  }
+
+  u32 Match(u8 hashBits) const
+  {
+    u32 mask = 0;
+    for(size_t i = 0; i < cFlatHashGroupSize; ++i)
+      mask |= u32(mControl[i] == hashBits) << i;
+    return mask;
+  }
+
+  u32 MatchEmpty() const
+  {
+    return Match(cFlatHashEmpty);
+  }
+
+  const u8* mControl;
+#endif
+};
+
+//-------------------------------------------------------- Flat Hashed Container
+/// Open addressing hash table with power of two sizes. Values are stored
+/// inline in one array and found by linear probing, comparing 16 control
+/// bytes per step. Insertion keeps each probe run ordered by home slot
+/// (robin hood) and erasing shifts the run back, so no tombstones are needed.
+/// Note: inserting or erasing moves values, so pointers into the table
+/// are not stable like they are with HashedContainer.
+template<typename ValueType, typename Hasher, typename Allocator>
+class ZeroSharedTemplate FlatHashedContainer : public AllocationContainer<Allocator>
+{
+public:
+  //standard container typedefs
+  typedef ValueType value_type;
+  typedef size_t size_type;
+  typedef ValueType& reference;
+  typedef const ValueType& const_reference;
+  typedef AllocationContainer<Allocator> base_type;
+  typedef FlatHashedContainer<ValueType, Hasher, Allocator> this_type;
+  using base_type::mAllocator;
+
+  // Probe distances are stored in a byte, grow before they overflow
+  static const size_type cMaxProbeDistance = 250;
+
+protected:
+  struct Node
+  {
+    ValueType Value;
+  };
+
+public:
+  struct InsertResult
+  {
+    bool mIsNewInsert;
+    ValueType* mValue;
+
+    InsertResult(bool newInsert, Node* node) : mIsNewInsert(newInsert), mValue(&node->Value) {}
+
+    operator bool() const { return mIsNewInsert; }
+  };
+
+  FlatHashedContainer()
+  {
+    mTable = nullptr;
+    mControl = nullptr;
+    mDistance = nullptr;
+    mTableSize = 0;
+    mSize = 0;
+  }
+
+  FlatHashedContainer(const this_type& other)
+    : base_type(other)
+  {
+    mTable = nullptr;
+    mControl = nullptr;
+    mDistance = nullptr;
+    mTableSize = 0;
+    mSize = 0;
+    mHasher = other.mHasher;
+    CopyTable(other);
+  }
+
+  ~FlatHashedContainer()
+  {
+    Deallocate();
+  }
+
+  this_type& operator=(const this_type& other)
+  {
+    // Don't self Assign
+    if(&other == this)
+      return *this;
+
+    //Keep the current table when it's already the right size
+    if(mTableSize == other.mTableSize)
+      Clear();
+    else
+      Deallocate();
+
+    mHasher = other.mHasher;
+    CopyTable(other);
+    return *this;
+  }
+
+  //Range for flat hash map.
+  struct range
+  {
+    typedef typename this_type::value_type value_type;
+    typedef reference FrontResult;
+
+    range()
+      : begin(nullptr), end(nullptr), control(nullptr), mSize(0)
+    {}
+
+    range(Node* rbegin, Node* rend, const u8* rcontrol, size_t size)
+      : begin(rbegin), end(rend), control(rcontrol), mSize(size)
+    {}
+
+    bool Empty()
+    {
+      return begin == end;
+    }
+
+    reference Front()
+    {
+      return begin->Value;
+    }
+
+    void PopFront()
+    {
+      ErrorIf(Empty(), "Popped an empty range.");
+      ++begin;
+      ++control;
+      --mSize;
+
+      //Skip empty slots
+      while(begin != end && *control == cFlatHashEmpty)
+      {
+        ++begin;
+        ++control;
+      }
+    }
+
+    size_t Length() { return mSize; }
+
+    size_type Size() { return Length(); }
+    range& All() { return *this; }
+
+  private:
+    Node* begin;
+    Node* end;
+    const u8* control;
+    size_t mSize;
+  };
+
+  ///////Container Global Modify//////////////////
+
+  /// Make room for at least the given number of values without rehashing.
+  void Reserve(size_type count)
+  {
+    size_type newTableSize = cFlatHashGroupSize;
+    while(!UnderMaxLoad(count, newTableSize))
+      newTableSize *= 2;
+
+    if(newTableSize > mTableSize)
+      Rehash(newTableSize);
+  }
+
+  //Rehash the contents into a table of the given size (rounded up to a power of two).
+  void Rehash(size_type newTableSize)
+  {
+    size_type tableSize = cFlatHashGroupSize;
+    while(tableSize < newTableSize)
+      tableSize *= 2;
+
+    if(!UnderMaxLoad(mSize, tableSize))
+      return;
+
+    Node* oldTable = mTable;
+    u8* oldControl = mControl;
+    size_type oldTableSize = mTableSize;
+
+    AllocateTable(tableSize);
+
+    //Move all the values over (the old slots are left destructed)
+    for(size_type i = 0; i < oldTableSize; ++i)
+    {
+      if(oldControl[i] == cFlatHashEmpty)
+        continue;
+
+      Node* node = InsertSlot(HashOf(oldTable[i].Value, mHasher));
+      MoveWithoutDestructionOperator<ValueType>::MoveWithoutDestruction(&node->Value, &oldTable[i].Value);
+    }
+
+    if(oldTableSize != 0)
+      mAllocator.Deallocate(oldTable, AllocationSize(oldTableSize));
+  }
+
+  //Destroy all elements.
+  void Clear()
+  {
+    for(size_type i = 0; i < mTableSize; ++i)
+    {
+      if(mControl[i] != cFlatHashEmpty)
+        mTable[i].Value.~ValueType();
+    }
+
+    if(mTableSize != 0)
+      memset(mControl, cFlatHashEmpty, mTableSize + cFlatHashGroupSize - 1);
+    mSize = 0;
+  }
+
+  //Destroy all elements and frees all memory.
+  void Deallocate()
+  {
+    if(mTable != nullptr)
+    {
+      Clear();
+      mAllocator.Deallocate(mTable, AllocationSize(mTableSize));
+    }
+
+    mTable = nullptr;
+    mControl = nullptr;
+    mDistance = nullptr;
+    mTableSize = 0;
+    mSize = 0;
+  }
+
+  range All() const
+  {
+    if(mSize == 0)
+      return range();
+
+    size_type start = 0;
+    while(mControl[start] == cFlatHashEmpty)
+      ++start;
+    return range(mTable + start, mTable + mTableSize, mControl + start, mSize);
+  }
+
+  void Swap(this_type& other)
+  {
+    Zero::Swap(mTable, other.mTable);
+    Zero::Swap(mControl, other.mControl);
+    Zero::Swap(mDistance, other.mDistance);
+    Zero::Swap(mTableSize, other.mTableSize);
+    Zero::Swap(mSize, other.mSize);
+    Zero::Swap(mHasher, other.mHasher);
+  }
+
+  ////////////Insertion///////////////////////
+
+  //Override
+  static Node* OnCollisionOverride(Node* dest, const_reference value)
+  {
+    dest->Value = value;
+    return dest;
+  }
+
+  //Error
+  static Node* OnCollisionError(Node* dest, const_reference value)
+  {
+    (void)value;
+    (void)dest;
+    Error("Double Insert, value was not inserted!");
+    return nullptr;
+  }
+
+  //Just return the bucket
+  static Node* OnCollisionReturn(Node* dest, const_reference value)
+  {
+    (void)value;
+    return dest;
+  }
+
+  //Insert a value.
+  template <typename CollisionFunc>
+  InsertResult InsertInternal(const_reference value, CollisionFunc onCollison)
+  {
+    size_t hash = HashOf(value, mHasher);
+
+    Node* found = FindWithHash(value, hash, mHasher);
+    if(found != nullptr)
+    {
+      onCollison(found, value);
+      return InsertResult(false, found);
+    }
+
+    //Expand the table if insertion would break load factor
+    if(!UnderMaxLoad(mSize + 1, mTableSize))
+      Rehash(mTableSize == 0 ? cFlatHashGroupSize : mTableSize * 2);
+
+    Node* node = InsertSlot(hash);
+    new(&node->Value) value_type(value);
+    return InsertResult(true, node);
+  }
+
+  ////////Find//////////////////////////////
+
+  //Find an element value that hashes and compares to a
+  //value in the hash map.
+  template<typename searchType, typename searchHasherType>
+  Node* InternalFindAs(const searchType& searchValue,
+                       searchHasherType searchHasher) const
+  {
+    if(mSize == 0)
+      return nullptr;
+
+    return FindWithHash(searchValue, HashOf(searchValue, searchHasher), searchHasher);
+  }
+
+  size_t Count(const_reference value)
+  {
+    return InternalFindAs(value, mHasher) != nullptr ? 1 : 0;
+  }
+
+  ///////Erasing//////////////////////////
+
+  //Erase a value if found.
+  bool Erase(const_reference value)
+  {
+    Node* foundNode = InternalFindAs(value, mHasher);
+    if(foundNode != nullptr)
+    {
+      EraseNode(foundNode);
+      return true;
+    }
+    return false;
+  }
+
+  void EraseNode(Node* node)
+  {
+    size_type index = node - mTable;
+    ErrorIf(index >= mTableSize || mControl[index] == cFlatHashEmpty,
+            "Attempted to erase an invalid node.");
+
+    node->Value.~ValueType();
+
+    //Shift the rest of the probe run back a slot so lookups never
+    //have to step over a hole (no tombstones)
+    size_type mask = mTableSize - 1;
+    size_type next = (index + 1) & mask;
+    while(mControl[next] != cFlatHashEmpty && mDistance[next] != 0)
+    {
+      MoveWithoutDestructionOperator<ValueType>::MoveWithoutDestruction(&mTable[index].Value, &mTable[next].Value);
+      SetControl(index, mControl[next]);
+      mDistance[index] = mDistance[next] - 1;
+
+      index = next;
+      next = (next + 1) & mask;
+    }
+
+    SetControl(index, cFlatHashEmpty);
+    mDistance[index] = 0;
+    --mSize;
+  }
+
+  //////////Information Functions///////////
+  size_type BucketCount() const { return mTableSize; }
+  size_type Size() const { return mSize; }
+  bool Empty() const { return mSize == 0; }
+
+  //////////Load Factor///////////////////////
+  float MaxLoadFactor() const { return 0.875f; }
+  float LoadFactor() const { return mTableSize == 0 ? 0.0f : float(mSize) / float(mTableSize); }
+
+protected:
+  typedef Node node_type;
+
+  Node* mTable;
+  // One control byte per slot followed by copies of the first
+  // group's bytes so a probe never has to wrap mid-load
+  u8* mControl;
+  // How far each value is from its home slot
+  u8* mDistance;
+  size_type mTableSize;
+  size_type mSize;
+  Hasher mHasher;
+
+  template<typename searchType, typename searchHasherType>
+  static size_t HashOf(const searchType& value, searchHasherType& hasher)
+  {
+    return FlatHashMix(hasher(value));
+  }
+
+  static u8 ControlOf(size_t hash)
+  {
+    return (u8)(hash >> 25) & 0x7F;
+  }
+
+  static bool UnderMaxLoad(size_type size, size_type tableSize)
+  {
+    // 7/8ths max load factor
+    return size <= tableSize - tableSize / 8;
+  }
+
+  static size_type AllocationSize(size_type tableSize)
+  {
+    return tableSize * sizeof(Node) + (tableSize + cFlatHashGroupSize - 1) + tableSize;
+  }
+
+  template<typename searchType, typename searchHasherType>
+  Node* FindWithHash(const searchType& searchValue, size_t hash,
+                     searchHasherType& searchHasher) const
+  {
+    if(mTableSize == 0)
+      return nullptr;
+
+    size_type mask = mTableSize - 1;
+    u8 control = ControlOf(hash);
+    size_type index = hash & mask;
+
+    for(size_type probed = 0; probed < mTableSize; probed += cFlatHashGroupSize)
+    {
+      FlatHashGroup group(mControl + index);
+      for(u32 matches = group.Match(control); matches != 0; matches &= matches - 1)
+      {
+        size_type slot = (index + FlatHashLowestBit(matches)) & mask;
+        if(searchHasher.Equal(searchValue, mTable[slot].Value))
+          return mTable + slot;
+      }
+
+      //A value is never stored past the first empty slot in its probe run
+      if(group.MatchEmpty() != 0)
+        return nullptr;
+
+      index = (index + cFlatHashGroupSize) & mask;
+    }
+    return nullptr;
+  }
+
+  void AllocateTable(size_type tableSize)
+  {
+    byte* memory = (byte*)mAllocator.Allocate(AllocationSize(tableSize));
+    mTable = (Node*)memory;
+    mControl = memory + tableSize * sizeof(Node);
+    mDistance = mControl + tableSize + cFlatHashGroupSize - 1;
+    mTableSize = tableSize;
+    mSize = 0;
+
+    memset(mControl, cFlatHashEmpty, tableSize + cFlatHashGroupSize - 1);
+    memset(mDistance, 0, tableSize);
+  }
+
+  // Copies the other table slot for slot (same size, so every value keeps
+  // its position and probe distance and nothing has to be rehashed)
+  void CopyTable(const this_type& other)
+  {
+    if(other.mSize == 0)
+      return;
+
+    if(mTableSize != other.mTableSize)
+      AllocateTable(other.mTableSize);
+
+    memcpy(mControl, other.mControl, mTableSize + cFlatHashGroupSize - 1);
+    memcpy(mDistance, other.mDistance, mTableSize);
+    for(size_type i = 0; i < mTableSize; ++i)
+    {
+      if(mControl[i] != cFlatHashEmpty)
+        new(&mTable[i].Value) ValueType(other.mTable[i].Value);
+    }
+    mSize = other.mSize;
+  }
+
+  void SetControl(size_type index, u8 control)
+  {
+    mControl[index] = control;
+    if(index < cFlatHashGroupSize - 1)
+      mControl[mTableSize + index] = control;
+  }
+
+  // Claims the slot the value with this hash belongs in and returns it
+  // unconstructed. Values that are closer to their home slot than the new
+  // one get shifted forward a slot (robin hood) to keep probe runs short.
+  Node* InsertSlot(size_t hash)
+  {
+    size_type mask = mTableSize - 1;
+    size_type index = hash & mask;
+    size_type distance = 0;
+
+    //Walk until an empty slot or a value that is closer to home than we are
+    while(mControl[index] != cFlatHashEmpty && mDistance[index] >= distance)
+    {
+      index = (index + 1) & mask;
+      ++distance;
+    }
+
+    //Find the end of the run that has to shift
+    size_type end = index;
+    size_type maxDistance = distance;
+    while(mControl[end] != cFlatHashEmpty)
+    {
+      if(size_type(mDistance[end]) + 1 > maxDistance)
+        maxDistance = mDistance[end] + 1;
+      end = (end + 1) & mask;
+    }
+
+    //Extremely long runs mean the table is too full (or the hash is bad)
+    if(maxDistance > cMaxProbeDistance)
+    {
+      Rehash(mTableSize * 2);
+      return InsertSlot(hash);
+    }
+
+    //Shift the run forward a slot
+    while(end != index)
+    {
+      size_type prev = (end - 1) & mask;
+      MoveWithoutDestructionOperator<ValueType>::MoveWithoutDestruction(&mTable[end].Value, &mTable[prev].Value);
+      SetControl(end, mControl[prev]);
+      mDistance[end] = mDistance[prev] + 1;
+      end = prev;
+    }
+
+    SetControl(index, ControlOf(hash));
+    mDistance[index] = (u8)distance;
+    ++mSize;
+    return mTable + index;
+  }
+};
+
+}// namespace Zero
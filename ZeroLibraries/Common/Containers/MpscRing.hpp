@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file MpscRing.hpp
+/// Definition of the bounded lock-free multiple producer, single consumer ring.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Utility/Atomic.hpp"
+
+namespace Zero
+{
+
+/// Bounded queue that any number of threads can push to without locking while
+/// a single thread pops. Every cell carries a sequence number that tells
+/// producers when the cell is free and the consumer when its value has been
+/// written, so a producer only contends with other producers on one compare
+/// exchange. The capacity is rounded up to a power of two. TryPush fails
+/// instead of blocking when the ring is full, callers decide how to overflow.
+template <typename type>
+class ZeroSharedTemplate MpscRing
+{
+public:
+  typedef type value_type;
+  typedef MpscRing<type> this_type;
+
+  MpscRing(size_t capacity = 1024)
+  {
+    size_t size = 2;
+    while(size < capacity)
+      size <<= 1;
+
+    mMask = size - 1;
+    mCells = new Cell[size];
+    for(size_t i = 0; i < size; ++i)
+      mCells[i].Sequence.Store(i);
+    mEnqueuePosition.Store(0);
+    mDequeuePosition = 0;
+  }
+
+  ~MpscRing()
+  {
+    delete[] mCells;
+  }
+
+  size_t Capacity() const { return mMask + 1; }
+
+  /// Safe to call from any thread. Returns false if the ring is full.
+  bool TryPush(const type& value)
+  {
+    size_t position;
+    Cell* cell = ClaimCell(position);
+    if(cell == nullptr)
+      return false;
+
+    cell->Data = value;
+    // Publish the value to the consumer
+    cell->Sequence.Store(position + 1);
+    return true;
+  }
+
+  /// Safe to call from any thread. Moves the value into the ring, the value
+  /// is only moved from if the push succeeds. Returns false if the ring is full.
+  bool TryPush(MoveReference<type> value)
+  {
+    size_t position;
+    Cell* cell = ClaimCell(position);
+    if(cell == nullptr)
+      return false;
+
+    cell->Data = value;
+    // Publish the value to the consumer
+    cell->Sequence.Store(position + 1);
+    return true;
+  }
+
+  /// Consumer thread only. Returns false if nothing has been published at
+  /// the front of the ring (a producer may still be writing it).
+  bool TryPop(type& value)
+  {
+    Cell* cell = &mCells[mDequeuePosition & mMask];
+    size_t sequence = cell->Sequence.Load();
+    if((ptrdiff_t)sequence - (ptrdiff_t)(mDequeuePosition + 1) < 0)
+      return false;
+
+    value = cell->Data;
+    // Release anything the value holds on to before handing the cell back
+    cell->Data = type();
+    cell->Sequence.Store(mDequeuePosition + mMask + 1);
+    ++mDequeuePosition;
+    return true;
+  }
+
+  /// Consumer thread only. Same as TryPop but moves the value out of the ring.
+  bool TryPopMove(type& value)
+  {
+    Cell* cell = &mCells[mDequeuePosition & mMask];
+    size_t sequence = cell->Sequence.Load();
+    if((ptrdiff_t)sequence - (ptrdiff_t)(mDequeuePosition + 1) < 0)
+      return false;
+
+    value = ZeroMove(cell->Data);
+    cell->Data = type();
+    cell->Sequence.Store(mDequeuePosition + mMask + 1);
+    ++mDequeuePosition;
+    return true;
+  }
+
+  /// Consumer thread only. Pops up to maxCount values onto the back of
+  /// the given array and returns how many were popped.
+  template <typename ArrayType>
+  size_t PopBatch(ArrayType& values, size_t maxCount = (size_t)-1)
+  {
+    size_t count = 0;
+    while(count < maxCount)
+    {
+      Cell* cell = &mCells[mDequeuePosition & mMask];
+      size_t sequence = cell->Sequence.Load();
+      if((ptrdiff_t)sequence - (ptrdiff_t)(mDequeuePosition + 1) < 0)
+        break;
+
+      values.PushBack(cell->Data);
+      cell->Data = type();
+      cell->Sequence.Store(mDequeuePosition + mMask + 1);
+      ++mDequeuePosition;
+      ++count;
+    }
+    return count;
+  }
+
+  /// Consumer thread only. Same as PopBatch but moves the values out of
+  /// the ring, so values that own memory are handed off without a copy.
+  template <typename ArrayType>
+  size_t PopBatchMove(ArrayType& values, size_t maxCount = (size_t)-1)
+  {
+    size_t count = 0;
+    while(count < maxCount)
+    {
+      Cell* cell = &mCells[mDequeuePosition & mMask];
+      size_t sequence = cell->Sequence.Load();
+      if((ptrdiff_t)sequence - (ptrdiff_t)(mDequeuePosition + 1) < 0)
+        break;
+
+      values.PushBack(ZeroMove(cell->Data));
+      cell->Data = type();
+      cell->Sequence.Store(mDequeuePosition + mMask + 1);
+      ++mDequeuePosition;
+      ++count;
+    }
+    return count;
+  }
+
+  /// Consumer thread only. Pops every value whose push started before this
+  /// call, waiting on producers that have claimed a cell but not yet written
+  /// it. Used when values pushed elsewhere must not pass older ring values.
+  template <typename ArrayType>
+  size_t PopClaimed(ArrayType& values)
+  {
+    size_t end = mEnqueuePosition.Load();
+    size_t count = 0;
+    while(mDequeuePosition != end)
+    {
+      Cell* cell = &mCells[mDequeuePosition & mMask];
+      // The claiming producer is only a copy away from publishing it
+      while((ptrdiff_t)cell->Sequence.Load() - (ptrdiff_t)(mDequeuePosition + 1) < 0)
+        continue;
+
+      values.PushBack(cell->Data);
+      cell->Data = type();
+      cell->Sequence.Store(mDequeuePosition + mMask + 1);
+      ++mDequeuePosition;
+      ++count;
+    }
+    return count;
+  }
+
+  /// Consumer thread only. Whether nothing is ready to be popped.
+  bool Empty()
+  {
+    Cell* cell = &mCells[mDequeuePosition & mMask];
+    return (ptrdiff_t)cell->Sequence.Load() - (ptrdiff_t)(mDequeuePosition + 1) < 0;
+  }
+
+private:
+  struct Cell
+  {
+    Atomic<size_t> Sequence;
+    type Data;
+  };
+
+  // Not copyable
+  MpscRing(const this_type&);
+  void operator=(const this_type&);
+
+  /// Claims the cell at the back of the ring for the calling producer.
+  /// Returns null if the ring is full.
+  Cell* ClaimCell(size_t& position)
+  {
+    position = mEnqueuePosition.Load();
+    for(;;)
+    {
+      Cell* cell = &mCells[position & mMask];
+      size_t sequence = cell->Sequence.Load();
+      ptrdiff_t difference = (ptrdiff_t)sequence - (ptrdiff_t)position;
+
+      // The cell is free for this position, try to claim it
+      if(difference == 0)
+      {
+        if(mEnqueuePosition.CompareExchangeBool(position + 1, position))
+          return cell;
+        position = mEnqueuePosition.Load();
+      }
+      // The consumer hasn't popped the previous lap yet
+      else if(difference < 0)
+      {
+        return nullptr;
+      }
+      // Another producer claimed it first
+      else
+      {
+        position = mEnqueuePosition.Load();
+      }
+    }
+  }
+
+  static const size_t cCacheLineSize = 64;
+
+  Cell* mCells;
+  size_t mMask;
+  byte mPadding0[cCacheLineSize];
+  /// Written by every producer
+  Atomic<size_t> mEnqueuePosition;
+  byte mPadding1[cCacheLineSize];
+  /// Only touched by the consumer
+  size_t mDequeuePosition;
+};
+
+}//namespace Zero
@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file FrameAllocator.cpp
+/// Implementation of the per frame linear arena and the FrameAllocator.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+namespace Memory
+{
+
+const size_t cFrameArenaAlignment = 16;
+const size_t cFrameArenaMinBlockSize = 64 * 1024;
+const size_t cFrameArenaOverflowPageSize = 64 * 1024;
+
+inline size_t AlignFrameSize(size_t numberOfBytes)
+{
+  return (numberOfBytes + cFrameArenaAlignment - 1) & ~(cFrameArenaAlignment - 1);
+}
+
+//------------------------------------------------------------------ Frame Arena
+FrameArena::FrameArena()
+{
+  mBlock = nullptr;
+  mBlockSize = 0;
+  mUsed = 0;
+  mOverflowCurrent = nullptr;
+  mOverflowEnd = nullptr;
+  mOverflowUsed = 0;
+  mOverflowDedicated = 0;
+  mHighWaterMark = 0;
+}
+
+FrameArena::~FrameArena()
+{
+  forRange(byte* page, mOverflowPages.All())
+    zDeallocate(page);
+  zDeallocate(mBlock);
+}
+
+MemPtr FrameArena::Allocate(size_t numberOfBytes)
+{
+  numberOfBytes = AlignFrameSize(numberOfBytes);
+
+  if(mUsed + numberOfBytes <= mBlockSize)
+  {
+    byte* memory = mBlock + mUsed;
+    mUsed += numberOfBytes;
+    return memory;
+  }
+
+  return AllocateOverflow(numberOfBytes);
+}
+
+MemPtr FrameArena::AllocateOverflow(size_t numberOfBytes)
+{
+  if(mOverflowCurrent + numberOfBytes > mOverflowEnd)
+  {
+    size_t pageSize = std::max(numberOfBytes, cFrameArenaOverflowPageSize);
+    mOverflowCurrent = (byte*)zAllocate(pageSize);
+    mOverflowEnd = mOverflowCurrent + pageSize;
+    mOverflowDedicated += pageSize;
+    mOverflowPages.PushBack(mOverflowCurrent);
+  }
+
+  byte* memory = mOverflowCurrent;
+  mOverflowCurrent += numberOfBytes;
+  mOverflowUsed += numberOfBytes;
+  return memory;
+}
+
+void FrameArena::Reset()
+{
+  size_t used = GetUsedBytes();
+  mHighWaterMark = std::max(mHighWaterMark, used);
+
+  if(!mOverflowPages.Empty())
+  {
+    //Grow the block so a frame like this one fits without overflowing
+    forRange(byte* page, mOverflowPages.All())
+      zDeallocate(page);
+    mOverflowPages.Clear();
+    mOverflowCurrent = nullptr;
+    mOverflowEnd = nullptr;
+    mOverflowDedicated = 0;
+
+    size_t blockSize = std::max(cFrameArenaMinBlockSize, mBlockSize);
+    while(blockSize < used)
+      blockSize *= 2;
+
+    if(blockSize != mBlockSize)
+    {
+      zDeallocate(mBlock);
+      mBlock = (byte*)zAllocate(blockSize);
+      mBlockSize = blockSize;
+    }
+  }
+
+  mUsed = 0;
+  mOverflowUsed = 0;
+}
+
+//---------------------------------------------------------- Thread Frame Arenas
+//The two arenas a thread alternates between
+struct ThreadFrameArenas
+{
+  ThreadFrameArenas()
+  {
+    Current = 0;
+    Frame = 0;
+    NextFree = nullptr;
+  }
+
+  FrameArena Arenas[2];
+  uint Current;
+  //The frame index the current arena was started at
+  u64 Frame;
+  ThreadFrameArenas* NextFree;
+};
+
+Atomic<u64> gFrameIndex;
+
+ZeroThreadLocal ThreadFrameArenas* gThreadFrameArenas = nullptr;
+
+//Every thread's arenas (for stats and shutdown) and those that are unowned
+SpinLock gFrameArenaLock;
+Array<ThreadFrameArenas*> gAllFrameArenas;
+ThreadFrameArenas* gFreeFrameArenas = nullptr;
+
+ThreadFrameArenas* GetThreadFrameArenas()
+{
+  ThreadFrameArenas* arenas = gThreadFrameArenas;
+  if(arenas != nullptr)
+    return arenas;
+
+  gFrameArenaLock.Lock();
+  arenas = gFreeFrameArenas;
+  if(arenas != nullptr)
+  {
+    gFreeFrameArenas = arenas->NextFree;
+    arenas->NextFree = nullptr;
+  }
+  else
+  {
+    arenas = new ThreadFrameArenas();
+    arenas->Frame = gFrameIndex.Load();
+    gAllFrameArenas.PushBack(arenas);
+  }
+  gFrameArenaLock.Unlock();
+
+  gThreadFrameArenas = arenas;
+  return arenas;
+}
+
+FrameArena& GetCurrentFrameArena(ThreadFrameArenas* arenas)
+{
+  u64 frame = gFrameIndex.Load();
+  u64 framesPassed = frame - arenas->Frame;
+  if(framesPassed != 0)
+  {
+    //The previous arena is now two frames old, reuse it. If this thread
+    //skipped a frame the current arena is old as well.
+    arenas->Current ^= 1;
+    arenas->Arenas[arenas->Current].Reset();
+    if(framesPassed > 1)
+      arenas->Arenas[arenas->Current ^ 1].Reset();
+    arenas->Frame = frame;
+  }
+
+  return arenas->Arenas[arenas->Current];
+}
+
+}//namespace Memory
+
+//-------------------------------------------------------------- Frame Allocator
+MemPtr FrameAllocator::Allocate(size_t numberOfBytes)
+{
+  Memory::ThreadFrameArenas* arenas = Memory::GetThreadFrameArenas();
+  return Memory::GetCurrentFrameArena(arenas).Allocate(numberOfBytes);
+}
+
+void FrameAllocator::EndFrame()
+{
+  ++Memory::gFrameIndex;
+
+  //Reset the calling thread's arena now instead of on its next allocation
+  if(Memory::gThreadFrameArenas != nullptr)
+    Memory::GetCurrentFrameArena(Memory::gThreadFrameArenas);
+}
+
+u64 FrameAllocator::GetFrameIndex()
+{
+  return Memory::gFrameIndex.Load();
+}
+
+size_t FrameAllocator::GetHighWaterMark()
+{
+  size_t highWaterMark = 0;
+  Memory::gFrameArenaLock.Lock();
+  forRange(Memory::ThreadFrameArenas* arenas, Memory::gAllFrameArenas.All())
+  {
+    for(uint i = 0; i < 2; ++i)
+      highWaterMark = std::max(highWaterMark, arenas->Arenas[i].GetHighWaterMark());
+  }
+  Memory::gFrameArenaLock.Unlock();
+  return highWaterMark;
+}
+
+size_t FrameAllocator::GetDedicatedBytes()
+{
+  size_t dedicated = 0;
+  Memory::gFrameArenaLock.Lock();
+  forRange(Memory::ThreadFrameArenas* arenas, Memory::gAllFrameArenas.All())
+  {
+    for(uint i = 0; i < 2; ++i)
+      dedicated += arenas->Arenas[i].GetDedicatedBytes();
+  }
+  Memory::gFrameArenaLock.Unlock();
+  return dedicated;
+}
+
+void FrameAllocator::ReleaseThreadArenas()
+{
+  Memory::ThreadFrameArenas* arenas = Memory::gThreadFrameArenas;
+  if(arenas == nullptr)
+    return;
+
+  //The adopting thread keeps the frame index, so memory handed out
+  //by this thread stays valid for as long as it normally would
+  Memory::gThreadFrameArenas = nullptr;
+  Memory::gFrameArenaLock.Lock();
+  arenas->NextFree = Memory::gFreeFrameArenas;
+  Memory::gFreeFrameArenas = arenas;
+  Memory::gFrameArenaLock.Unlock();
+}
+
+void FrameAllocator::Shutdown()
+{
+  Memory::gFrameArenaLock.Lock();
+  DeleteObjectsInContainer(Memory::gAllFrameArenas);
+  Memory::gAllFrameArenas.Deallocate();
+  Memory::gFreeFrameArenas = nullptr;
+  Memory::gFrameArenaLock.Unlock();
+
+  //Only clears the calling thread, other threads must not allocate after this
+  Memory::gThreadFrameArenas = nullptr;
+}
+
+}//namespace Zero
@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file FrameAllocator.hpp
+/// Declaration of the per frame linear arena and the FrameAllocator.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "Containers/Array.hpp"
+#include "Graph.hpp"
+
+namespace Zero
+{
+namespace Memory
+{
+
+///Linear arena. Allocations bump a pointer and are never freed individually,
+///the whole arena is rewound with Reset. If a frame needs more than the block
+///holds the extra memory comes from overflow pages, and the next Reset grows
+///the block so the following frames fit in one block again.
+class FrameArena
+{
+public:
+  FrameArena();
+  ~FrameArena();
+
+  MemPtr Allocate(size_t numberOfBytes);
+
+  ///Releases everything allocated since the last reset.
+  void Reset();
+
+  ///Bytes allocated since the last reset.
+  size_t GetUsedBytes() { return mUsed + mOverflowUsed; }
+  ///Most bytes ever allocated between two resets.
+  size_t GetHighWaterMark() { return mHighWaterMark; }
+  ///Bytes reserved from the system.
+  size_t GetDedicatedBytes() { return mBlockSize + mOverflowDedicated; }
+
+private:
+  FrameArena(const FrameArena&);
+  void operator=(const FrameArena&);
+
+  MemPtr AllocateOverflow(size_t numberOfBytes);
+
+  byte* mBlock;
+  size_t mBlockSize;
+  size_t mUsed;
+
+  PodArray<byte*> mOverflowPages;
+  byte* mOverflowCurrent;
+  byte* mOverflowEnd;
+  size_t mOverflowUsed;
+  size_t mOverflowDedicated;
+
+  size_t mHighWaterMark;
+};
+
+}//namespace Memory
+
+///Allocator for transient data that only needs to live for the rest of this
+///frame and the next one, e.g. Array<Contact*, FrameAllocator>. Every thread
+///has two arenas (current and previous frame) that are rotated lazily the
+///first time the thread allocates in a new frame, so job workers never touch
+///each other's memory. Deallocate does nothing, memory is reclaimed when the
+///arena is reused two frames later.
+class ZeroShared FrameAllocator : public Memory::StandardMemory
+{
+public:
+  MemPtr Allocate(size_t numberOfBytes);
+  void Deallocate(MemPtr ptr, size_t numberOfBytes) {}
+
+  ///Starts a new frame. Called at the end of Engine::Update.
+  static void EndFrame();
+
+  ///Frames ended so far.
+  static u64 GetFrameIndex();
+
+  ///Most bytes used by any one thread in a single frame.
+  static size_t GetHighWaterMark();
+
+  ///Bytes reserved from the system by all threads.
+  static size_t GetDedicatedBytes();
+
+  ///Hands the calling thread's arenas to the next thread that allocates.
+  static void ReleaseThreadArenas();
+
+  ///Frees all arenas, no frame memory may be in use.
+  static void Shutdown();
+};
+
+}//namespace Zero
@@ -39,7 +39,10 @@ void zDeallocate(void* ptr)
 #elif UseMemoryTracker
   return DebugDeallocate(ptr);
 #else
-  return free(ptr);
+  //Size class memory can be freed through here as well (handle managers
+  //free objects with zDeallocate that may have come from a Heap)
+  if(!Memory::SizeClassAllocator::Deallocate(ptr))
+    free(ptr);
 #endif
 }
 
@@ -14,6 +14,12 @@ namespace Zero
 namespace Memory
 {
 
+//Heaps are shared between threads so their stats are updated atomically
+inline Atomic<MemCounterType>& AtomicCounter(MemCounterType& counter)
+{
+  return reinterpret_cast<Atomic<MemCounterType>&>(counter);
+}
+
 //------------------------------------------------------------------------- Heap
 Heap::Heap(cstr name, Graph* parent)
   : Graph(name, parent)
@@ -23,17 +29,45 @@ Heap::Heap(cstr name, Graph* parent)
 
 MemPtr Heap::Allocate(size_t numberOfBytes)
 {
-  AddAllocation(numberOfBytes);
-  MemPtr mem = zAllocate(numberOfBytes);
-  return mem;
+  AtomicAddAllocation(numberOfBytes);
+
+#ifdef ZeroSizeClassAllocator
+  MemPtr mem = SizeClassAllocator::Allocate(numberOfBytes);
+  if(mem != nullptr)
+    return mem;
+#endif
+
+  return zAllocate(numberOfBytes);
 }
 
 void Heap::Deallocate(MemPtr ptr, size_t numberOfBytes)
 {
-  RemoveAllocation(numberOfBytes);
+  AtomicRemoveAllocation(numberOfBytes);
+
+  //zDeallocate returns size class memory to its span
   zDeallocate(ptr);
 }
 
+void Heap::AtomicAddAllocation(MemCounterType bytes)
+{
+  ++AtomicCounter(mData.Active);
+  ++AtomicCounter(mData.Allocations);
+  MemCounterType allocated = AtomicCounter(mData.BytesAllocated).FetchAdd(bytes) + bytes;
+
+  Atomic<MemCounterType>& peak = AtomicCounter(mData.PeakAllocated);
+  for(MemCounterType current = peak.Load(); allocated > current; current = peak.Load())
+  {
+    if(peak.CompareExchangeBool(allocated, current))
+      break;
+  }
+}
+
+void Heap::AtomicRemoveAllocation(MemCounterType bytes)
+{
+  --AtomicCounter(mData.Active);
+  AtomicCounter(mData.BytesAllocated).FetchSubtract(bytes);
+}
+
 void Heap::Print(size_t tabs, size_t flags)
 {
   PrintHelper(tabs, flags, "Heap");
@@ -9,6 +9,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "Graph.hpp"
+#include "SizeClassAllocator.hpp"
 
 namespace Zero
 {
@@ -17,8 +18,9 @@ namespace Memory
 
 class HeapPrivate;
 
-///Heap allocator. The heap allocator allocates memory directly from the 
-///system heap using malloc and free.
+///Heap allocator. Small allocations are served by the thread cached
+///SizeClassAllocator, larger ones come directly from the system heap using
+///malloc and free. Heaps may be used from any thread.
 class ZeroShared Heap : public Graph
 {
 public:
@@ -27,6 +29,10 @@ public:
   void Deallocate(MemPtr ptr, size_t numberOfBytes);
 
   virtual void Print(size_t tabs, size_t flags);
+
+private:
+  void AtomicAddAllocation(MemCounterType bytes);
+  void AtomicRemoveAllocation(MemCounterType bytes);
 };
 
 template <typename type>
@@ -0,0 +1,276 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file SizeClassAllocator.cpp
+/// Implementation of the thread cached size class allocator.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+namespace Memory
+{
+
+//16 byte steps up to 256 then 64 byte steps up to cMaxSize. Every class is a
+//multiple of 16 so all objects keep malloc's alignment.
+const size_t cSmallClassStep = 16;
+const size_t cSmallClassMax = 256;
+const size_t cLargeClassStep = 64;
+const size_t cSmallClassCount = cSmallClassMax / cSmallClassStep;
+const size_t cSizeClassCount = cSmallClassCount +
+  (SizeClassAllocator::cMaxSize - cSmallClassMax) / cLargeClassStep;
+
+//Spans are aligned to their size so the header is found by masking the pointer
+const size_t cSpanShift = 16;
+const size_t cSpanSize = size_t(1) << cSpanShift;
+const size_t cSpanHeaderSize = 64;
+const size_t cSpansPerChunk = 16;
+
+//Two level page map with one byte per span. The root covers a 48 bit address
+//space on 64 bit platforms and is a single entry on 32 bit platforms.
+const size_t cPageMapLeafShift = 16;
+const size_t cPageMapLeafSize = size_t(1) << cPageMapLeafShift;
+const size_t cPageMapRootSize = sizeof(void*) == 8 ? (size_t(1) << (48 - cSpanShift - cPageMapLeafShift)) : 1;
+
+struct FreeObject
+{
+  FreeObject* Next;
+};
+
+struct ThreadCache
+{
+  //Only touched by the thread that owns the cache
+  FreeObject* LocalFree[cSizeClassCount];
+  byte* SpanCurrent[cSizeClassCount];
+  byte* SpanEnd[cSizeClassCount];
+  ThreadCache* NextFreeCache;
+
+  //Keep the remote lists that other threads write to off of the owner's lines
+  byte Padding[64];
+  FreeObject* volatile RemoteFree[cSizeClassCount];
+};
+
+struct SpanHeader
+{
+  ThreadCache* Owner;
+  size_t SizeClass;
+};
+
+//The calling thread's cache (created on first allocation)
+ZeroThreadLocal ThreadCache* gThreadCache = nullptr;
+
+//Caches released by threads that exited, waiting to be adopted
+SpinLock gCacheLock;
+ThreadCache* gFreeCaches = nullptr;
+
+//Spans not yet handed to a cache
+SpinLock gSpanLock;
+byte* gNextSpan = nullptr;
+byte* gChunkEnd = nullptr;
+size_t gDedicatedBytes = 0;
+
+u8* volatile gPageMap[cPageMapRootSize];
+
+inline size_t SizeToClass(size_t numberOfBytes)
+{
+  if(numberOfBytes <= cSmallClassMax)
+    return numberOfBytes == 0 ? 0 : (numberOfBytes - 1) / cSmallClassStep;
+  return cSmallClassCount + (numberOfBytes - cSmallClassMax - 1) / cLargeClassStep;
+}
+
+inline size_t ClassToSize(size_t sizeClass)
+{
+  if(sizeClass < cSmallClassCount)
+    return (sizeClass + 1) * cSmallClassStep;
+  return cSmallClassMax + (sizeClass - cSmallClassCount + 1) * cLargeClassStep;
+}
+
+inline SpanHeader* GetSpan(MemPtr ptr)
+{
+  return (SpanHeader*)((size_t)ptr & ~(cSpanSize - 1));
+}
+
+//Must be called with the span lock held
+bool RegisterChunk(byte* chunk)
+{
+  size_t firstSpan = (size_t)chunk >> cSpanShift;
+  size_t lastSpan = firstSpan + cSpansPerChunk - 1;
+  if((lastSpan >> cPageMapLeafShift) >= cPageMapRootSize)
+    return false;
+
+  for(size_t span = firstSpan; span <= lastSpan; ++span)
+  {
+    size_t root = span >> cPageMapLeafShift;
+    u8* leaf = gPageMap[root];
+    if(leaf == nullptr)
+    {
+      leaf = (u8*)malloc(cPageMapLeafSize);
+      if(leaf == nullptr)
+        return false;
+      memset(leaf, 0, cPageMapLeafSize);
+      AtomicStore((void* volatile*)&gPageMap[root], leaf);
+    }
+    leaf[span & (cPageMapLeafSize - 1)] = 1;
+  }
+  return true;
+}
+
+bool AllocateSpan(ThreadCache* cache, size_t sizeClass)
+{
+  gSpanLock.Lock();
+  if(gNextSpan == gChunkEnd)
+  {
+    //Over allocate by one span so the chunk can be aligned. Chunks are never
+    //returned to the system, freed objects stay in their cache's free lists.
+    byte* memory = (byte*)malloc(cSpansPerChunk * cSpanSize + cSpanSize);
+    byte* chunk = (byte*)(((size_t)memory + cSpanSize - 1) & ~(cSpanSize - 1));
+    if(memory == nullptr || !RegisterChunk(chunk))
+    {
+      gSpanLock.Unlock();
+      free(memory);
+      return false;
+    }
+
+    gNextSpan = chunk;
+    gChunkEnd = chunk + cSpansPerChunk * cSpanSize;
+    gDedicatedBytes += cSpansPerChunk * cSpanSize + cSpanSize;
+  }
+
+  byte* span = gNextSpan;
+  gNextSpan += cSpanSize;
+  gSpanLock.Unlock();
+
+  SpanHeader* header = (SpanHeader*)span;
+  header->Owner = cache;
+  header->SizeClass = sizeClass;
+  cache->SpanCurrent[sizeClass] = span + cSpanHeaderSize;
+  cache->SpanEnd[sizeClass] = span + cSpanSize;
+  return true;
+}
+
+ThreadCache* GetThreadCache()
+{
+  ThreadCache* cache = gThreadCache;
+  if(cache != nullptr)
+    return cache;
+
+  gCacheLock.Lock();
+  cache = gFreeCaches;
+  if(cache != nullptr)
+    gFreeCaches = cache->NextFreeCache;
+  gCacheLock.Unlock();
+
+  if(cache == nullptr)
+  {
+    cache = (ThreadCache*)malloc(sizeof(ThreadCache));
+    if(cache == nullptr)
+      return nullptr;
+    memset(cache, 0, sizeof(ThreadCache));
+  }
+
+  cache->NextFreeCache = nullptr;
+  gThreadCache = cache;
+  return cache;
+}
+
+//--------------------------------------------------------- Size Class Allocator
+MemPtr SizeClassAllocator::Allocate(size_t numberOfBytes)
+{
+  if(numberOfBytes > cMaxSize)
+    return nullptr;
+
+  ThreadCache* cache = GetThreadCache();
+  if(cache == nullptr)
+    return nullptr;
+
+  size_t sizeClass = SizeToClass(numberOfBytes);
+
+  FreeObject* object = cache->LocalFree[sizeClass];
+  if(object == nullptr)
+  {
+    //Take everything other threads have freed back to us
+    object = (FreeObject*)AtomicExchange((void* volatile*)&cache->RemoteFree[sizeClass], nullptr);
+  }
+
+  if(object != nullptr)
+  {
+    cache->LocalFree[sizeClass] = object->Next;
+    return object;
+  }
+
+  //Carve a new object from the current span
+  size_t size = ClassToSize(sizeClass);
+  if(cache->SpanCurrent[sizeClass] + size > cache->SpanEnd[sizeClass])
+  {
+    if(!AllocateSpan(cache, sizeClass))
+      return nullptr;
+  }
+
+  byte* memory = cache->SpanCurrent[sizeClass];
+  cache->SpanCurrent[sizeClass] += size;
+  return memory;
+}
+
+bool SizeClassAllocator::Deallocate(MemPtr ptr)
+{
+  if(!Owns(ptr))
+    return false;
+
+  SpanHeader* span = GetSpan(ptr);
+  ThreadCache* owner = span->Owner;
+  size_t sizeClass = span->SizeClass;
+  FreeObject* object = (FreeObject*)ptr;
+
+  if(owner == gThreadCache)
+  {
+    object->Next = owner->LocalFree[sizeClass];
+    owner->LocalFree[sizeClass] = object;
+    return true;
+  }
+
+  //Push onto the owner's remote list, the owner takes the whole
+  //list at once so there is no ABA problem with many pushers.
+  void* volatile* head = (void* volatile*)&owner->RemoteFree[sizeClass];
+  for(;;)
+  {
+    FreeObject* top = (FreeObject*)AtomicLoad(head);
+    object->Next = top;
+    if(AtomicCompareExchangeBool(head, object, top))
+      return true;
+  }
+}
+
+bool SizeClassAllocator::Owns(MemPtr ptr)
+{
+  size_t span = (size_t)ptr >> cSpanShift;
+  size_t root = span >> cPageMapLeafShift;
+  if(root >= cPageMapRootSize)
+    return false;
+
+  u8* leaf = gPageMap[root];
+  return leaf != nullptr && leaf[span & (cPageMapLeafSize - 1)] != 0;
+}
+
+void SizeClassAllocator::ReleaseThreadCache()
+{
+  ThreadCache* cache = gThreadCache;
+  if(cache == nullptr)
+    return;
+
+  gThreadCache = nullptr;
+
+  gCacheLock.Lock();
+  cache->NextFreeCache = gFreeCaches;
+  gFreeCaches = cache;
+  gCacheLock.Unlock();
+}
+
+size_t SizeClassAllocator::GetDedicatedBytes()
+{
+  return gDedicatedBytes;
+}
+
+}//namespace Memory
+}//namespace Zero
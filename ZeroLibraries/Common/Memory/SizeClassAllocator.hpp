@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \file SizeClassAllocator.hpp
+/// Declaration of the thread cached size class allocator.
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "Memory.hpp"
+
+//The memory debugger and tracker need to see every allocation
+#if !defined(UseMemoryDebugger) && !defined(UseMemoryTracker)
+#define ZeroSizeClassAllocator
+#endif
+
+namespace Zero
+{
+namespace Memory
+{
+
+///Small object allocator used by the Heap. Allocations are rounded up to a
+///size class and served from 64k spans owned by a per thread cache, so the
+///common allocate / free pair never takes a lock. Memory freed on a thread that
+///does not own the span is pushed onto the owning cache's remote free list
+///(lock free) and picked up the next time that cache runs dry. Spans are
+///registered in a page map so any pointer can be identified as ours or not
+///regardless of the size it is freed with.
+class ZeroShared SizeClassAllocator
+{
+public:
+  ///Largest allocation served from a size class, bigger ones go to the system.
+  static const size_t cMaxSize = 512;
+
+  ///Returns null if the size is too large for a size class.
+  static MemPtr Allocate(size_t numberOfBytes);
+
+  ///Returns false if the memory was not allocated by the size class allocator.
+  static bool Deallocate(MemPtr ptr);
+
+  ///Is this memory from a size class span?
+  static bool Owns(MemPtr ptr);
+
+  ///Returns the calling thread's cache to a shared list so the next thread to
+  ///start can adopt it (and the memory it holds). Called when Zero threads exit.
+  static void ReleaseThreadCache();
+
+  ///Total bytes reserved from the system for spans.
+  static size_t GetDedicatedBytes();
+};
+
+}//namespace Memory
+}//namespace Zero
@@ -84,5 +84,6 @@ namespace Zero
 #include "ReplicaChannel.hpp"
 #include "Replica.hpp"
 #include "ReplicaStream.hpp"
+#include "ReplicaSnapshot.hpp"
 #include "ReplicatorLink.hpp"
 #include "Replicator.hpp"
@@ -445,6 +445,14 @@ Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message
 //                                 OutMessage                                      //
 //---------------------------------------------------------------------------------//
 
+/// Outgoing message heap
+/// (Heap allocations this small are served from thread cached size classes)
+/// Only holds the OutMessage nodes, the data BitStream is allocated by the sender and
+/// moved through the outbox and into packets without being copied
+static Memory::Heap* sOutMessageHeap = Memory::GetNamedHeap("OutMessages");
+
+ImplementOverloadedNewWithAllocator(OutMessage, sOutMessageHeap)
+
 OutMessage::OutMessage()
   : Message(),
     mReliable(false),
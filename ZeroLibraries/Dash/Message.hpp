@@ -159,6 +159,10 @@ Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message
 class OutMessage : public Message
 {
 public:
+  /// Allocated from the message heap
+  /// (Small fixed-size blocks, no general heap allocation per sent message)
+  OverloadedNew();
+
   /// Constructors
   OutMessage();
   OutMessage(MoveReference<Message> message, bool reliable = false, MessageChannelId channelId = 0, MessageSequenceId sequenceId = 0, TransferMode::Enum transferMode = TransferMode::Immediate,
@@ -53,4 +53,19 @@ static const Bits MinPacketHeaderBits = ProtocolIdBits /// Packet protocol ID
 /// Maximum packet header size
 static const Bits MaxPacketHeaderBits = MinPacketHeaderBits
                                       + PacketSequenceIdBits; /// Packet sequence ID
+
+//---------------------------------------------------------------------------------//
+//                              Packet Batching                                    //
+//---------------------------------------------------------------------------------//
+
+/// Maximum number of raw packets received by a single receive thread socket call
+static const size_t ReceiveBatchPackets = 32;
+
+/// Capacity of the ring handing raw packets off from a receive thread to the peer update
+/// (Packets received while the ring is full are dropped, just as if the socket receive buffer were full)
+static const size_t RawPacketRingCapacity = 1024;
+
+/// Capacity of the ring handing translated raw packet buffers back to a receive thread for reuse
+/// (Buffers returned while the ring is full are freed, a receive thread allocates a new buffer when the ring is empty)
+static const size_t RawPacketPoolCapacity = 256;
 } // namespace Zero
@@ -25,9 +25,18 @@ void Peer::ResetSession()
   mFatalError = false;
 
   /// Packet Data
-  mIpv4RawPackets.Clear();
-  mIpv6RawPackets.Clear();
+  Array<RawPacket> discardedPackets;
+  mIpv4RawPackets.PopBatchMove(discardedPackets);
+  mIpv6RawPackets.PopBatchMove(discardedPackets);
+  mIpv4RawPacketPool.PopBatchMove(discardedPackets);
+  mIpv6RawPacketPool.PopBatchMove(discardedPackets);
   mSendBitStream.Clear(false);
+  mBatchSends = false;
+  mIpv4SendBatch.Clear();
+  mIpv4SendBatchSize = 0;
+  mIpv6SendBatch.Clear();
+  mIpv6SendBatchSize = 0;
+  mFailedBatchedSends = 0;
 
   InitializeStats();
 }
@@ -61,11 +70,18 @@ Peer::Peer(ProcessReceivedCustomPacketFn processReceivedCustomPacketFn, ProcessR
     mLocalFrameId(0),
 
     /// Packet Data
-    mIpv4RawPackets(),
-    mIpv4RawPacketsLock(),
-    mIpv6RawPackets(),
-    mIpv6RawPacketsLock(),
+    mIpv4RawPackets(RawPacketRingCapacity),
+    mIpv6RawPackets(RawPacketRingCapacity),
+    mIpv4RawPacketPool(RawPacketPoolCapacity),
+    mIpv6RawPacketPool(RawPacketPoolCapacity),
     mSendBitStream(),
+    mBatchSends(false),
+    mIpv4SendBatch(),
+    mIpv4SendBatchSize(0),
+    mIpv6SendBatch(),
+    mIpv6SendBatchSize(0),
+    mSendDatagrams(),
+    mFailedBatchedSends(0),
     mReceiveStatsLock(),
     mReleasedCustomPackets(),
     mReleasedCustomPacketsLock(),
@@ -472,8 +488,12 @@ bool Peer::Update()
   ++mLocalFrameId;
 
   // Update peer state and process received custom packets
+  // (Packets sent meanwhile are queued and sent together afterwards)
+  mBatchSends = true;
   UpdatePeerState();
   ProcessReceivedCustomPackets();
+  FlushSendBatches();
+  mBatchSends = false;
 
   // Success
   return true;
@@ -492,6 +512,11 @@ uint64 Peer::GetLocalFrameId() const
   return mLocalFrameId;
 }
 
+uint64 Peer::GetFailedBatchedSendCount() const
+{
+  return mFailedBatchedSends;
+}
+
 void Peer::SetUserData(void* userData)
 {
   mUserData = userData;
@@ -805,13 +830,27 @@ bool Peer::SendPacket(OutPacket& outPacket)
   if(!PluginEventOnPacketSend(outPacket))
     return true;
 
+  // Is IPv4 packet?
+  bool isIpv4 = (outPacket.GetDestinationIpAddress().GetInternetProtocol() == InternetProtocol::V4);
+
+  // Batching sends?
+  if(mBatchSends)
+  {
+    // Write packet to the send batch
+    RawPacket& rawPacket = isIpv4 ? AddToSendBatch(mIpv4SendBatch, mIpv4SendBatchSize)
+                                  : AddToSendBatch(mIpv6SendBatch, mIpv6SendBatchSize);
+    rawPacket.mIpAddress = outPacket.GetDestinationIpAddress();
+    rawPacket.mData.Write(outPacket);
+
+    // Success (Sent at the end of the update)
+    return true;
+  }
+
   // Write packet to bitstream
   mSendBitStream.Write(outPacket);
 
   // Choose correct socket (IPv4 or IPv6)
-  Socket& socket = outPacket.GetDestinationIpAddress().GetInternetProtocol() == InternetProtocol::V4
-                 ? mIpv4Socket
-                 : mIpv6Socket;
+  Socket& socket = isIpv4 ? mIpv4Socket : mIpv6Socket;
 
   // Send packet over socket
   Status status;
@@ -830,6 +869,69 @@ bool Peer::SendPacket(OutPacket& outPacket)
   return (result != 0);
 }
 
+RawPacket& Peer::AddToSendBatch(Array<RawPacket>& sendBatch, size_t& sendBatchSize)
+{
+  // No previously allocated raw packet to reuse?
+  if(sendBatchSize == sendBatch.Size())
+  {
+    // Allocate raw packet
+    sendBatch.PushBack(RawPacket());
+    sendBatch.Back().mData.Reserve(EthernetMtuBytes);
+  }
+
+  // Get next raw packet
+  return sendBatch[sendBatchSize++];
+}
+void Peer::FlushSendBatch(Socket& socket, Array<RawPacket>& sendBatch, size_t& sendBatchSize)
+{
+  // No queued packets?
+  if(sendBatchSize == 0)
+    return;
+
+  // Describe queued packets
+  mSendDatagrams.Resize(sendBatchSize);
+  for(size_t i = 0; i < sendBatchSize; ++i)
+  {
+    SocketDatagram& datagram = mSendDatagrams[i];
+    RawPacket&      rawPacket = sendBatch[i];
+    datagram.mData       = rawPacket.mData.GetDataExposed();
+    datagram.mDataLength = rawPacket.mData.GetBytesWritten();
+    datagram.mAddress    = rawPacket.mIpAddress;
+  }
+
+  // Send queued packets over socket
+  Status status;
+  socket.SendToBatch(status, mSendDatagrams.Data(), sendBatchSize);
+
+  // For all queued packets
+  for(size_t i = 0; i < sendBatchSize; ++i)
+  {
+    SocketDatagram& datagram = mSendDatagrams[i];
+    if(datagram.mBytes) // Successful?
+    {
+      Assert(datagram.mBytes == datagram.mDataLength);
+
+      // Update stats
+      UpdateSendStats(Bytes(datagram.mBytes));
+    }
+    else
+    {
+      // Record failure (SendPacket already reported success when the packet was queued)
+      ++mFailedBatchedSends;
+    }
+
+    // Clear for next send (keeping the allocated buffer)
+    sendBatch[i].mIpAddress.Clear();
+    sendBatch[i].mData.Clear(false);
+  }
+  sendBatchSize = 0;
+}
+void Peer::FlushSendBatches()
+{
+  FlushSendBatch(mIpv4Socket, mIpv4SendBatch, mIpv4SendBatchSize);
+  FlushSendBatch(mIpv6Socket, mIpv6SendBatch, mIpv6SendBatchSize);
+}
+
 void Peer::UpdateSendStats(Bytes sentPacketBytes)
 {
   // Update current send time
@@ -900,35 +1002,47 @@ try
   //
   // Receive Loop
   //
-  RawPacket rawPacket;
-  rawPacket.mData.Reserve(EthernetMtuBytes);
+  RawPacket      rawPackets[ReceiveBatchPackets];
+  SocketDatagram datagrams[ReceiveBatchPackets];
+  for(size_t i = 0; i < ReceiveBatchPackets; ++i)
+  {
+    // Preallocate receive buffers
+    AcquireReceiveBuffer(rawPackets[i], datagrams[i], mIpv4RawPacketPool);
+  }
   while(!mExitIpv4ReceiveThread)
   {
-    // Wait to receive a packet over socket
+    // Wait to receive a batch of packets over socket
     Status status;
-    SocketAddress sourceAddress;
-    Bytes result = mIpv4Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, sourceAddress);
-    rawPacket.mData.SetBytesWritten(result);
-    rawPacket.mIpAddress = sourceAddress;
-    if(result && IsValidRawPacket(rawPacket)) // Successful?
-    {
-      Assert(rawPacket.mIpAddress.IsValid());
+    size_t received = mIpv4Socket.ReceiveFromBatch(status, datagrams, ReceiveBatchPackets);
 
-      { //<>-<>-<>-<>-< IPv4 Raw Packets Locked >-<>-<>-<>-<>-
-        Lock lock(mIpv4RawPacketsLock);
+    // For all received packets
+    for(size_t i = 0; i < received; ++i)
+    {
+      RawPacket& rawPacket = rawPackets[i];
+      Bytes      result    = Bytes(datagrams[i].mBytes);
+      rawPacket.mData.SetBytesWritten(result);
+      rawPacket.mIpAddress = datagrams[i].mAddress;
+      if(result && IsValidRawPacket(rawPacket)) // Successful?
+      {
+        Assert(rawPacket.mIpAddress.IsValid());
 
-        // Push raw packet copy
-        mIpv4RawPackets.PushBack(rawPacket);
+        // Hand raw packet buffer off to the peer update
+        // (Dropped if the ring is full)
+        if(mIpv4RawPackets.TryPush(ZeroMove(rawPacket)))
+        {
+          // Update stats
+          UpdateReceiveStats(result);
 
-      } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
+          // Receive the next packet into a pooled buffer
+          AcquireReceiveBuffer(rawPacket, datagrams[i], mIpv4RawPacketPool);
+          continue;
+        }
+      }
 
-      // Update stats
-      UpdateReceiveStats(result);
+      // Clear for next receive
+      rawPacket.mIpAddress.Clear();
+      rawPacket.mData.Clear(false);
     }
-
-    // Clear for next receive
-    rawPacket.mIpAddress.Clear();
-    rawPacket.mData.Clear(false);
   }
 
   // Success
@@ -954,33 +1068,47 @@ try
   //
   // Receive Loop
   //
-  RawPacket rawPacket;
-  rawPacket.mData.Reserve(EthernetMtuBytes);
+  RawPacket      rawPackets[ReceiveBatchPackets];
+  SocketDatagram datagrams[ReceiveBatchPackets];
+  for(size_t i = 0; i < ReceiveBatchPackets; ++i)
+  {
+    // Preallocate receive buffers
+    AcquireReceiveBuffer(rawPackets[i], datagrams[i], mIpv6RawPacketPool);
+  }
   while(!mExitIpv6ReceiveThread)
   {
-    // Wait to receive a packet over socket
+    // Wait to receive a batch of packets over socket
     Status status;
-    Bytes result = mIpv6Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, rawPacket.mIpAddress);
-    rawPacket.mData.SetBytesWritten(result);
-    if(result && IsValidRawPacket(rawPacket)) // Successful?
-    {
-      Assert(rawPacket.mIpAddress.IsValid());
+    size_t received = mIpv6Socket.ReceiveFromBatch(status, datagrams, ReceiveBatchPackets);
 
-      { //<>-<>-<>-<>-< IPv6 Raw Packets Locked >-<>-<>-<>-<>-
-        Lock lock(mIpv6RawPacketsLock);
+    // For all received packets
+    for(size_t i = 0; i < received; ++i)
+    {
+      RawPacket& rawPacket = rawPackets[i];
+      Bytes      result    = Bytes(datagrams[i].mBytes);
+      rawPacket.mData.SetBytesWritten(result);
+      rawPacket.mIpAddress = datagrams[i].mAddress;
+      if(result && IsValidRawPacket(rawPacket)) // Successful?
+      {
+        Assert(rawPacket.mIpAddress.IsValid());
 
-        // Push raw packet copy
-        mIpv6RawPackets.PushBack(rawPacket);
+        // Hand raw packet buffer off to the peer update
+        // (Dropped if the ring is full)
+        if(mIpv6RawPackets.TryPush(ZeroMove(rawPacket)))
+        {
+          // Update stats
+          UpdateReceiveStats(result);
 
-      } //-<>-<>-<>-<>-< IPv6 Raw Packets Unlocked >-<>-<>-<>-<>
+          // Receive the next packet into a pooled buffer
+          AcquireReceiveBuffer(rawPacket, datagrams[i], mIpv6RawPacketPool);
+          continue;
+        }
+      }
 
-      // Update stats
-      UpdateReceiveStats(result);
+      // Clear for next receive
+      rawPacket.mIpAddress.Clear();
+      rawPacket.mData.Clear(false);
     }
-
-    // Clear for next receive
-    rawPacket.mIpAddress.Clear();
-    rawPacket.mData.Clear(false);
   }
 
   // Success
@@ -1115,31 +1243,23 @@ void Peer::UpdatePeerState()
   // Translate Raw IPv4 Packets
   //
   Assert(rawPackets.Empty());
-  { //<>-<>-<>-<>-< IPv4 Raw Packets Locked >-<>-<>-<>-<>-
-    Lock lock(mIpv4RawPacketsLock);
-
-    // Get raw IPv4 packets
-    rawPackets.Swap(mIpv4RawPackets);
 
-  } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
+  // Get raw IPv4 packets
+  mIpv4RawPackets.PopBatchMove(rawPackets);
 
   // Translate raw IPv4 packets
-  TranslateRawPackets(rawPackets, inPackets);
+  TranslateRawPackets(rawPackets, mIpv4RawPacketPool, inPackets);
 
   //
   // Translate Raw IPv6 Packets
   //
   Assert(rawPackets.Empty());
-  { //<>-<>-<>-<>-< IPv6 Raw Packets Locked >-<>-<>-<>-<>-
-    Lock lock(mIpv6RawPacketsLock);
 
-    // Get raw IPv6 packets
-    rawPackets.Swap(mIpv6RawPackets);
-
-  } //-<>-<>-<>-<>-< IPv6 Raw Packets Unlocked >-<>-<>-<>-<>
+  // Get raw IPv6 packets
+  mIpv6RawPackets.PopBatchMove(rawPackets);
 
   // Translate raw IPv6 packets
-  TranslateRawPackets(rawPackets, inPackets);
+  TranslateRawPackets(rawPackets, mIpv6RawPacketPool, inPackets);
 
   //
   // Process Received Packets
@@ -1242,7 +1362,7 @@ void Peer::ProcessReceivedCustomPacket(InPacket& packet)
   return mProcessReceivedCustomPacketFn(this, packet);
 }
 
-void Peer::TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& inPackets)
+void Peer::TranslateRawPackets(Array<RawPacket>& rawPackets, MpscRing<RawPacket>& rawPacketPool, Array<InPacket>& inPackets)
 {
   // For all RawPackets
   forRange(RawPacket& rawPacket, rawPackets.All())
@@ -1251,10 +1371,27 @@ void Peer::TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& in
     InPacket inPacket(rawPacket.mIpAddress);
     if(rawPacket.mData.Read(inPacket)) // Successful?
       inPackets.PushBack(ZeroMove(inPacket));
+
+    // Hand the buffer back to the receive thread
+    // (Freed if the pool is full)
+    rawPacket.mContainsEventMessage = false;
+    rawPacket.mIpAddress.Clear();
+    rawPacket.mData.Clear(false);
+    rawPacketPool.TryPush(ZeroMove(rawPacket));
   }
   rawPackets.Clear();
 }
 
+void Peer::AcquireReceiveBuffer(RawPacket& rawPacket, SocketDatagram& datagram, MpscRing<RawPacket>& rawPacketPool)
+{
+  // Reuse a translated packet buffer if available, else allocate a new one
+  if(!rawPacketPool.TryPopMove(rawPacket))
+    rawPacket.mData.Reserve(EthernetMtuBytes);
+
+  datagram.mData       = rawPacket.mData.GetDataExposed();
+  datagram.mDataLength = EthernetMtuBytes;
+}
+
 bool Peer::PluginEventOnPacketSend(OutPacket& packet)
 {
   // Ask all plugins if they wish to continue
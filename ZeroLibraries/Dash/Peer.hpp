@@ -86,6 +86,8 @@ public:
 
   /// Sends a standalone packet to the specified remote address on the open peer
   /// Returns true if successful, else false
+  /// (When called during Update, the packet is queued and sent at the end of the update,
+  ///  so true only means it was queued; see GetFailedBatchedSendCount)
   bool Send(const IpAddress& ipAddress, const Message& message);
   bool Send(const IpAddress& ipAddress, const Array<Message>& messages);
 
@@ -102,6 +104,9 @@ public:
   /// Returns the current local update frame ID
   uint64 GetLocalFrameId() const;
 
+  /// Returns the number of packets queued during an update that then failed to send
+  uint64 GetFailedBatchedSendCount() const;
+
   /// Sets optional user data associated with the peer
   void SetUserData(void* userData = nullptr);
   /// Returns optional user data associated with the peer
@@ -233,8 +238,16 @@ public:
 
   /// Sends an outgoing packet to the network
   /// Returns true if successful, else false
+  /// (While batching sends, the packet is queued and sent along with every other packet sent this update)
   bool SendPacket(OutPacket& outPacket);
 
+  /// Returns the next reusable raw packet in the send batch
+  RawPacket& AddToSendBatch(Array<RawPacket>& sendBatch, size_t& sendBatchSize);
+  /// Sends every raw packet in the send batch over the socket
+  void FlushSendBatch(Socket& socket, Array<RawPacket>& sendBatch, size_t& sendBatchSize);
+  /// Sends every packet queued while batching sends
+  void FlushSendBatches();
+
   /// Updates packet send statistics
   void UpdateSendStats(Bytes sentPacketBytes);
   /// Updates packet receive statistics
@@ -256,7 +269,11 @@ public:
   void ProcessReceivedCustomPacket(InPacket& packet);
 
   // Translate raw incoming packets into packets that can be processed
-  void TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& inPackets);
+  // (Raw packet buffers are handed back to the receive thread through the given pool afterwards)
+  void TranslateRawPackets(Array<RawPacket>& rawPackets, MpscRing<RawPacket>& rawPacketPool, Array<InPacket>& inPackets);
+
+  /// Replaces the raw packet's buffer with a pooled receive buffer (or a new one if the pool is empty)
+  static void AcquireReceiveBuffer(RawPacket& rawPacket, SocketDatagram& datagram, MpscRing<RawPacket>& rawPacketPool);
 
   /// Called before a packet is sent
   /// Return true to continue sending the packet, else false
@@ -305,14 +322,21 @@ public:
   uint64 mLocalFrameId; /// Local update frame ID
 
   /// Packet Data
-  Array<RawPacket>   mIpv4RawPackets;            /// Raw incoming IPv4 packets
-  mutable ThreadLock mIpv4RawPacketsLock;        /// Raw incoming IPv4 packets thread lock
-  Array<RawPacket>   mIpv6RawPackets;            /// Raw incoming IPv6 packets
-  mutable ThreadLock mIpv6RawPacketsLock;        /// Raw incoming IPv6 packets thread lock
-  BitStream          mSendBitStream;             /// Reusable outgoing packet bitstream
-  mutable ThreadLock mReceiveStatsLock;          /// Receive stats thread lock
-  Array<InPacket>    mReleasedCustomPackets;     /// Released incoming user packets
-  mutable ThreadLock mReleasedCustomPacketsLock; /// Released incoming user packets thread lock
+  MpscRing<RawPacket>   mIpv4RawPackets;            /// Raw incoming IPv4 packets (handed off from the IPv4 receive thread)
+  MpscRing<RawPacket>   mIpv6RawPackets;            /// Raw incoming IPv6 packets (handed off from the IPv6 receive thread)
+  MpscRing<RawPacket>   mIpv4RawPacketPool;         /// Translated IPv4 raw packet buffers (handed back to the IPv4 receive thread for reuse)
+  MpscRing<RawPacket>   mIpv6RawPacketPool;         /// Translated IPv6 raw packet buffers (handed back to the IPv6 receive thread for reuse)
+  BitStream             mSendBitStream;             /// Reusable outgoing packet bitstream
+  bool                  mBatchSends;                /// Queue outgoing packets to be sent together at the end of the update?
+  Array<RawPacket>      mIpv4SendBatch;             /// Queued outgoing IPv4 packets (buffers are reused every update)
+  size_t                mIpv4SendBatchSize;         /// Queued outgoing IPv4 packet count
+  Array<RawPacket>      mIpv6SendBatch;             /// Queued outgoing IPv6 packets (buffers are reused every update)
+  size_t                mIpv6SendBatchSize;         /// Queued outgoing IPv6 packet count
+  Array<SocketDatagram> mSendDatagrams;             /// Reusable batched send datagrams
+  uint64                mFailedBatchedSends;        /// Queued outgoing packets that failed to send
+  mutable ThreadLock    mReceiveStatsLock;          /// Receive stats thread lock
+  Array<InPacket>       mReleasedCustomPackets;     /// Released incoming user packets
+  mutable ThreadLock    mReleasedCustomPacketsLock; /// Released incoming user packets thread lock
 
   /// Link Data
   PeerLinkSet mCreatedLinks;   /// Links which were just created, need to be added
@@ -21,6 +21,9 @@ ReplicaChannel::ReplicaChannel(const String& name, ReplicaChannelType* replicaCh
     mIndexListSize(nullptr),
     mIsNapping(false),
     mChangeFlag(false),
+    mDirtyProperties(0),
+    mObserveWhenDirty(false),
+    mIsDirtyQueued(false),
     mLastChangeTimestamp(cInvalidMessageTimestamp),
     mLastChangeFrameId(0),
     mAuthority(Authority::Server),
@@ -45,6 +48,7 @@ ReplicaChannel::~ReplicaChannel()
   // (Should have been unscheduled when the operating replica was made invalid,
   // else there is a dangling replica channel held by the replica channel type)
   Assert(!IsScheduled());
+  Assert(!mIsDirtyQueued);
 }
 
 bool ReplicaChannel::operator ==(const ReplicaChannel& rhs) const
@@ -153,6 +157,14 @@ bool ReplicaChannel::CheckChangeFlag()
 void ReplicaChannel::SetChangeFlag(bool changeFlag)
 {
   mChangeFlag = changeFlag;
+
+  //     Change flag set?
+  // AND Only observed when dirty?
+  if(mChangeFlag && mObserveWhenDirty)
+  {
+    // Queue for change observation
+    mReplicaChannelType->QueueDirtyChannel(this);
+  }
 }
 bool ReplicaChannel::GetChangeFlag() const
 {
@@ -168,6 +180,35 @@ bool ReplicaChannel::HasChangedAtAll() const
   return false;
 }
 
+bool ReplicaChannel::IsObservedWhenDirty() const
+{
+  return mObserveWhenDirty;
+}
+
+void ReplicaChannel::MarkPropertyDirty(uint dirtyIndex)
+{
+  Assert(dirtyIndex < cMaxDirtyReplicaProperties);
+
+  // Set dirty flag
+  mDirtyProperties |= (u64(1) << dirtyIndex);
+
+  // Only observed when dirty?
+  if(mObserveWhenDirty)
+  {
+    // Queue for change observation
+    mReplicaChannelType->QueueDirtyChannel(this);
+  }
+}
+bool ReplicaChannel::IsPropertyDirty(uint dirtyIndex) const
+{
+  Assert(dirtyIndex < cMaxDirtyReplicaProperties);
+  return (mDirtyProperties & (u64(1) << dirtyIndex)) != 0;
+}
+void ReplicaChannel::ClearDirtyProperties()
+{
+  mDirtyProperties = 0;
+}
+
 bool ReplicaChannel::ObserveAndReplicateChanges(bool forceObservation, bool forceReplication, bool isRelay)
 {
   // Get peer
@@ -198,7 +239,11 @@ bool ReplicaChannel::ObserveAndReplicateChanges(TimeMs timestamp, uint64 frameId
   {
     // Don't detect outgoing changes for this replica?
     if(!replica->GetDetectOutgoingChanges())
+    {
+      // (Observation consumes our dirty flags either way)
+      ClearDirtyProperties();
       return true; // Success
+    }
   }
 
   // Is not being relayed?
@@ -212,6 +257,7 @@ bool ReplicaChannel::ObserveAndReplicateChanges(TimeMs timestamp, uint64 frameId
       Assert(forceObservation ? true : (replicaChannelType->GetAuthorityMode() == AuthorityMode::Dynamic));
 
       // Success
+      ClearDirtyProperties();
       return true;
     }
 
@@ -220,7 +266,10 @@ bool ReplicaChannel::ObserveAndReplicateChanges(TimeMs timestamp, uint64 frameId
     {
       // Not this replica's change authority client?
       if(replicator->GetReplicatorId() != replica->GetAuthorityClientReplicatorId())
+      {
+        ClearDirtyProperties();
         return true; // Success
+      }
     }
   }
 
@@ -242,26 +291,34 @@ bool ReplicaChannel::ObserveAndReplicateChanges(TimeMs timestamp, uint64 frameId
       {
         // Failure
         Assert(false);
+        ClearDirtyProperties();
         return false;
       }
     }
 
+    // Set last change detected frame ID
+    SetLastChangeFrameId(frameId);
+
+    // Handle changed replica channel property values
+    ReactToPropertyChanges(timestamp, ReplicationPhase::Change, TransmissionDirection::Outgoing);
+
+    // Clear dirty flags (all dirty replica properties have been observed)
+    // (Done before rescheduling, which would otherwise queue us for observation again)
+    ClearDirtyProperties();
+
     // Is napping?
     if(IsNapping())
     {
       // Wake up (we just detected a change)
       WakeUp();
     }
-
-    // Set last change detected frame ID
-    SetLastChangeFrameId(frameId);
-
-    // Handle changed replica channel property values
-    ReactToPropertyChanges(timestamp, ReplicationPhase::Change, TransmissionDirection::Outgoing);
   }
   // No change detected?
   else
   {
+    // Clear dirty flags (all dirty replica properties have been observed)
+    ClearDirtyProperties();
+
     // Is awake?
     if(IsAwake())
     {
@@ -430,6 +487,41 @@ void ReplicaChannel::ReactToPropertyChanges(TimeMs timestamp, ReplicationPhase::
 // Internal
 //
 
+void ReplicaChannel::AssignDirtyIndices()
+{
+  // For all replica properties
+  uint dirtyCount       = 0;
+  bool allUseDirtyFlags = true;
+  forRange(ReplicaProperty* replicaProperty, GetReplicaProperties().All())
+  {
+    //     Replica property type uses dirty flags?
+    // AND Every property setter marks the replica property dirty?
+    // AND There are dirty flags left to assign?
+    if(replicaProperty->GetReplicaPropertyType()->GetUseDirtyFlag()
+    && replicaProperty->HasDirtyHook()
+    && dirtyCount < cMaxDirtyReplicaProperties)
+    {
+      // Assign next dirty index
+      replicaProperty->mDirtyIndex = dirtyCount;
+      ++dirtyCount;
+    }
+    else
+    {
+      // Compare every detection interval
+      replicaProperty->mDirtyIndex = cInvalidDirtyIndex;
+      allUseDirtyFlags = false;
+    }
+  }
+
+  // Get detection mode
+  DetectionMode::Enum detectionMode = GetReplicaChannelType()->GetDetectionMode();
+
+  //     Every replica property uses dirty flags?
+  // AND Changes are detected using comparisons? (Manumatic change flags also mark us dirty)
+  mObserveWhenDirty = (dirtyCount != 0 && allUseDirtyFlags)
+                   && (detectionMode == DetectionMode::Automatic || detectionMode == DetectionMode::Manumatic);
+}
+
 bool ReplicaChannel::ObserveForChange()
 {
   // Get replica channel type
@@ -468,7 +560,7 @@ bool ReplicaChannel::ObserveForChange()
   }
 }
 
-bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceChanged) const
 {
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = GetReplicaChannelType();
@@ -487,7 +579,7 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
     forRange(ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Write replica property
-      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp);
+      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp, forceChanged);
       if(!result) // Unable?
       {
         Assert(false);
@@ -504,12 +596,12 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
     forRange(ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Write 'Has Changed?' Flag
-      bool hasChanged = replicaProperty->HasChanged();
+      bool hasChanged = forceChanged || replicaProperty->HasChanged();
       bitStream.Write(hasChanged);
       if(hasChanged) // Has changed?
       {
         // Write replica property
-        bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp);
+        bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp, forceChanged);
         if(!result) // Unable?
         {
           Assert(false);
@@ -785,6 +877,9 @@ void ReplicaChannelType::ObserveAndReplicateChanges()
 
   // Observe napping replica channels
   ObserveAndReplicateChanges(mNappingChannelIndex, timestamp, frameId);
+
+  // Observe dirty replica channels
+  ObserveAndReplicateDirtyChanges(timestamp, frameId);
 }
 void ReplicaChannelType::ObserveAndReplicateChanges(ReplicaChannelIndex& replicaChannelIndex, TimeMs timestamp, uint64 frameId)
 {
@@ -821,6 +916,54 @@ void ReplicaChannelType::ObserveAndReplicateChanges(ReplicaChannelIndex& replica
     scheduledChannel.ObserveAndReplicateChanges(timestamp, frameId);
   }
 }
+void ReplicaChannelType::ObserveAndReplicateDirtyChanges(TimeMs timestamp, uint64 frameId)
+{
+  // (Should be valid)
+  Assert(IsValid());
+
+  // Nothing to observe?
+  if(mDirtyChannels.Empty())
+    return;
+
+  // Replica channels of this type should not detect outgoing changes?
+  if(!GetDetectOutgoingChanges())
+  {
+    // Nothing to observe
+    return;
+  }
+
+  // Take the queued replica channels
+  // (Replica channels marked dirty while observing are queued again and observed next update)
+  mObservingDirtyChannels.Swap(mDirtyChannels);
+  forRange(ReplicaChannel* dirtyChannel, mObservingDirtyChannels.All())
+    dirtyChannel->mIsDirtyQueued = false;
+
+  // For all dirty replica channels
+  for(size_t i = 0; i < mObservingDirtyChannels.Size(); ++i)
+  {
+    // Replica channel was unscheduled while observing?
+    ReplicaChannel* dirtyChannel = mObservingDirtyChannels[i];
+    if(!dirtyChannel)
+      continue;
+
+    // Get detection interval
+    // (Dirty replica channels are observed no more often than indexed ones, at most once per awake/nap interval)
+    uint detectionInterval = dirtyChannel->IsNapping() ? GetNapDetectionInterval() : GetAwakeDetectionInterval();
+
+    // Not this replica channel's detection frame?
+    if(frameId % detectionInterval != 0)
+    {
+      // Keep queued until then
+      QueueDirtyChannel(dirtyChannel);
+      continue;
+    }
+
+    // Observe the dirty replica channel
+    dirtyChannel->ObserveAndReplicateChanges(timestamp, frameId);
+  }
+
+  mObservingDirtyChannels.Clear();
+}
 
 void ReplicaChannelType::ScheduleChannel(ReplicaChannel* channel)
 {
@@ -864,6 +1007,23 @@ void ReplicaChannelType::ScheduleChannel(ReplicaChannel* channel)
     return;
   }
 
+  // Assign replica property dirty flags
+  channel->AssignDirtyIndices();
+
+  // Only observed when dirty?
+  if(channel->IsObservedWhenDirty())
+  {
+    // Already marked dirty?
+    if(channel->mDirtyProperties != 0 || channel->GetChangeFlag())
+    {
+      // Observe changes made while unscheduled
+      QueueDirtyChannel(channel);
+    }
+
+    // (Not added to an index, we are queued whenever marked dirty instead)
+    return;
+  }
+
   // Is awake?
   if(!channel->IsNapping())
   {
@@ -882,6 +1042,22 @@ void ReplicaChannelType::UnscheduleChannel(ReplicaChannel* channel)
   // (Should be valid)
   Assert(IsValid());
 
+  // Stop observing when dirty
+  channel->mObserveWhenDirty = false;
+
+  // Queued for dirty change observation?
+  if(channel->mIsDirtyQueued)
+  {
+    // Remove from dirty queue
+    mDirtyChannels.EraseValueError(channel);
+    channel->mIsDirtyQueued = false;
+  }
+
+  // Currently being observed from the dirty queue?
+  for(size_t i = 0; i < mObservingDirtyChannels.Size(); ++i)
+    if(mObservingDirtyChannels[i] == channel)
+      mObservingDirtyChannels[i] = nullptr;
+
   // Already unscheduled?
   if(!channel->IsScheduled())
   {
@@ -903,6 +1079,17 @@ void ReplicaChannelType::UnscheduleChannel(ReplicaChannel* channel)
   }
 }
 
+void ReplicaChannelType::QueueDirtyChannel(ReplicaChannel* channel)
+{
+  // Already queued?
+  if(channel->mIsDirtyQueued)
+    return;
+
+  // Add to dirty queue
+  mDirtyChannels.PushBack(channel);
+  channel->mIsDirtyQueued = true;
+}
+
 //
 // Configuration
 //
@@ -926,6 +1113,7 @@ void ReplicaChannelType::ResetConfig()
   SetReliabilityMode();
   SetTransferMode();
   SetAccurateTimestampOnChange();
+  SetUseDeltaSnapshots();
 }
 
 void ReplicaChannelType::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -1132,4 +1320,21 @@ bool ReplicaChannelType::GetAccurateTimestampOnChange() const
   return mAccurateTimestampOnChange;
 }
 
+void ReplicaChannelType::SetUseDeltaSnapshots(bool useDeltaSnapshots)
+{
+  // Already valid?
+  if(IsValid())
+  {
+    // Unable to modify configuration
+    Error("ReplicaChannelType is already valid, unable to modify configuration");
+    return;
+  }
+
+  mUseDeltaSnapshots = useDeltaSnapshots;
+}
+bool ReplicaChannelType::GetUseDeltaSnapshots() const
+{
+  return mUseDeltaSnapshots;
+}
+
 } // namespace Zero
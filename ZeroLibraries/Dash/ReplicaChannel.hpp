@@ -75,6 +75,17 @@ public:
   /// Returns true if any replica property has changed at all since the last observation, else false
   bool HasChangedAtAll() const;
 
+  /// Returns true if the replica channel is only observed after being marked dirty, else false
+  /// (Determined when scheduled, set if every replica property uses dirty flags and the detection mode uses comparisons)
+  bool IsObservedWhenDirty() const;
+
+  /// Marks the replica property at the specified dirty index as changed and queues the replica channel for change observation (as needed)
+  void MarkPropertyDirty(uint dirtyIndex);
+  /// Returns true if the replica property at the specified dirty index has been marked changed since the last observation, else false
+  bool IsPropertyDirty(uint dirtyIndex) const;
+  /// Clears all replica property dirty flags
+  void ClearDirtyProperties();
+
   /// Observes the replica channel and replicates any changes (if configured to do so)
   /// Returns true if successful, else false
   bool ObserveAndReplicateChanges(bool forceObservation = false, bool forceReplication = false, bool isRelay = false);
@@ -141,9 +152,14 @@ public:
   /// Returns true if a change was detected, else false
   bool ObserveForChange();
 
+  /// Assigns a dirty index to every replica property using dirty flags (up to cMaxDirtyReplicaProperties)
+  /// and determines if the replica channel is only observed after being marked dirty
+  void AssignDirtyIndices();
+
   /// Serializes the replica channel
+  /// (Force changed writes every replica property as changed, used to resynchronize a link that missed changes)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceChanged = false) const;
   /// Deserializes the replica channel
   /// Returns true if successful, else false
   bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
@@ -156,6 +172,9 @@ public:
   size_t*              mIndexListSize;       /// Replica channel index list size (may be null)
   bool                 mIsNapping;           /// Is the replica channel napping?
   bool                 mChangeFlag;          /// Manual change flag
+  u64                  mDirtyProperties;     /// Replica property dirty flags (one bit per dirty index)
+  bool                 mObserveWhenDirty;    /// Only observed after being marked dirty?
+  bool                 mIsDirtyQueued;       /// Queued for dirty change observation?
   TimeMs               mLastChangeTimestamp; /// Timestamp indicating when this replica channel was last changed (on any replica property)
   uint64               mLastChangeFrameId;   /// Frame ID of the last detected change
   Authority::Enum      mAuthority;           /// Change authority
@@ -257,12 +276,19 @@ public:
   /// Observes all scheduled replica channels of this type and replicates any changes
   void ObserveAndReplicateChanges();
   void ObserveAndReplicateChanges(ReplicaChannelIndex& replicaChannelIndex, TimeMs timestamp, uint64 frameId);
+  /// Observes all replica channels of this type queued since they were marked dirty and replicates any changes
+  /// (Queued replica channels are only observed on their awake/nap detection interval frames, until then they remain queued)
+  void ObserveAndReplicateDirtyChanges(TimeMs timestamp, uint64 frameId);
 
   /// Schedules the unscheduled replica channel for change observation
+  /// (Replica channels observed when dirty are not added to the awake/napping indexes, they are queued once marked dirty instead)
   void ScheduleChannel(ReplicaChannel* channel);
   /// Unschedules the replica channel from change observation
   void UnscheduleChannel(ReplicaChannel* channel);
 
+  /// Queues the replica channel for change observation on the next update (if not already queued)
+  void QueueDirtyChannel(ReplicaChannel* channel);
+
   //
   // Configuration
   //
@@ -347,11 +373,19 @@ public:
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
 
+  /// Controls whether or not replica channel changes are sent as delta snapshots
+  /// (Every change serializes the entire replica channel state, encoded per link against the last state acknowledged by that link)
+  /// (Cannot be modified after the replica channel type has been made valid)
+  void SetUseDeltaSnapshots(bool useDeltaSnapshots = false);
+  bool GetUseDeltaSnapshots() const;
+
   /// Data
   String                   mName;                           /// Replica channel type name
   Replicator*              mReplicator;                     /// Operating replicator
   ReplicaChannelIndex      mAwakeChannelIndex;              /// Awake replica channels index
   ReplicaChannelIndex      mNappingChannelIndex;            /// Napping replica channels index
+  Array<ReplicaChannel*>   mDirtyChannels;                  /// Replica channels queued for dirty change observation
+  Array<ReplicaChannel*>   mObservingDirtyChannels;         /// Replica channels currently being observed from the dirty queue
   bool                     mDetectOutgoingChanges;          /// Detect outgoing changes?
   bool                     mAcceptIncomingChanges;          /// Accept incoming changes?
   bool                     mNotifyOnOutgoingPropertyChange; /// Notify on outgoing property change?
@@ -369,6 +403,7 @@ public:
   ReliabilityMode::Enum    mReliabilityMode;                /// Change message reliability mode
   TransferMode::Enum       mTransferMode;                   /// Change message transfer mode
   bool                     mAccurateTimestampOnChange;      /// Accurate timestamp when changed?
+  bool                     mUseDeltaSnapshots;              /// Send changes as delta snapshots?
 };
 
 /// Typedefs
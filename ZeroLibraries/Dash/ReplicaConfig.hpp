@@ -40,6 +40,11 @@ StaticAssertWithinRange(Range14, REPLICA_TYPE_ID_BITS, 1, UINTMAX_BITS);
 #define EMPLACE_CONTEXT_ID_BITS 11
 StaticAssertWithinRange(Range15, EMPLACE_CONTEXT_ID_BITS, 1, UINTMAX_BITS);
 
+/// Snapshot ID bits
+/// Determines the sequence space of delta snapshots sent on a replica channel
+#define SNAPSHOT_ID_BITS 16
+StaticAssertWithinRange(Range17, SNAPSHOT_ID_BITS, 8, UINTMAX_BITS);
+
 /// Replica should use a virtual destructor?
 /// Enable this if you're relying on replica polymorphism for deletion
 #define REPLICA_USE_VIRTUAL_DESTRUCTOR 0
@@ -180,6 +185,23 @@ typedef UintN<ReplicaTypeIdBits> ReplicaTypeId;
 static const Bits EmplaceContextIdBits = EMPLACE_CONTEXT_ID_BITS;
 typedef UintN<EmplaceContextIdBits> EmplaceContextId;
 
+//---------------------------------------------------------------------------------//
+//                                Snapshot ID                                      //
+//---------------------------------------------------------------------------------//
+
+/// Snapshot ID
+/// Identifies a delta snapshot in the sequence of snapshots sent on a replica channel
+static const Bits SnapshotIdBits = SNAPSHOT_ID_BITS;
+typedef UintN<SnapshotIdBits, true> SnapshotId;
+
+//---------------------------------------------------------------------------------//
+//                                Change Queue                                     //
+//---------------------------------------------------------------------------------//
+
+/// Maximum number of frames a replica's prioritized changes may wait before they're sent regardless of remaining outgoing bandwidth
+/// (Bounds the change queue while a link's frame budget stays exhausted)
+static const uint MaxQueuedChangeFrames = 30;
+
 //---------------------------------------------------------------------------------//
 //                             Property Functions                                  //
 //---------------------------------------------------------------------------------//
@@ -287,6 +309,13 @@ DeclareEnum4(DetectionMode,
   Automatic,  /// Detect changes automatically using comparisons
   Manumatic); /// Detect changes manually using change flags and automatically using comparisons
 
+/// Maximum number of replica properties in a replica channel that may be observed using dirty flags
+/// (Any additional replica properties are compared every change detection interval instead)
+static const uint cMaxDirtyReplicaProperties = 64;
+
+/// Dirty index of a replica property that is not observed using dirty flags
+static const uint cInvalidDirtyIndex = std::numeric_limits<uint>::max();
+
 /// ReplicaChannel Change Reliability Mode
 DeclareEnum2(ReliabilityMode,
   Unreliable, /// Lost changes are not retransmitted
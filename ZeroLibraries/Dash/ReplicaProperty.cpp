@@ -84,7 +84,9 @@ ReplicaProperty::ReplicaProperty(const String& name, ReplicaPropertyType* replic
     mLastReceivedChangeFrameId(0),
     mSplineCurve(),
     mBakedCurve(),
-    mConvergenceState(ConvergenceState::None)
+    mConvergenceState(ConvergenceState::None),
+    mDirtyIndex(cInvalidDirtyIndex),
+    mHasDirtyHook(false)
 {
   // Configure spline curves
   for(size_t i = 0; i < 4; ++i)
@@ -271,6 +273,11 @@ bool HasChangedArithmetic(const ReplicaProperty* replicaProperty, const ReplicaP
 
 bool ReplicaProperty::HasChanged() const
 {
+  // Not marked dirty since the last observation?
+  // (The current property value is known to be unchanged, so we don't need to get and compare it)
+  if(!IsDirty())
+    return false;
+
   // Get replica property type
   ReplicaPropertyType* replicaPropertyType = GetReplicaPropertyType();
 
@@ -298,12 +305,47 @@ bool ReplicaProperty::HasChangedAtAll() const
   return currentValue != lastValue;
 }
 
+void ReplicaProperty::SetHasDirtyHook(bool hasDirtyHook)
+{
+  mHasDirtyHook = hasDirtyHook;
+}
+bool ReplicaProperty::HasDirtyHook() const
+{
+  return mHasDirtyHook;
+}
+
+void ReplicaProperty::MarkDirty()
+{
+  // Not using dirty flags?
+  if(!UsesDirtyFlag())
+    return;
+
+  // Mark our dirty flag on the operating replica channel
+  mReplicaChannel->MarkPropertyDirty(mDirtyIndex);
+}
+bool ReplicaProperty::UsesDirtyFlag() const
+{
+  return mDirtyIndex != cInvalidDirtyIndex;
+}
+bool ReplicaProperty::IsDirty() const
+{
+  // Not using dirty flags?
+  if(!UsesDirtyFlag())
+    return true; // (Always compared)
+
+  return mReplicaChannel->IsPropertyDirty(mDirtyIndex);
+}
+
 void ReplicaProperty::SetValue(const Variant& value)
 {
   Assert(value.IsNotEmpty());
 
   // Set current property value
   mReplicaPropertyType->GetSetValueFn()(value, mPropertyData);
+
+  // Mark as changed
+  // (Received changes are set here and must be observed when relayed)
+  MarkDirty();
 }
 Variant ReplicaProperty::GetValue() const
 {
@@ -1030,7 +1072,7 @@ void ReplicaProperty::ReactToChanges(TimeMs timestamp, ReplicationPhase::Enum re
 
 /// (Arithmetic property type behavior)
 template <typename PropertyType, TF_ENABLE_IF(IsBasicNativeTypeArithmetic<PropertyType>::Value)>
-bool SerializeArithmetic(BitStream& bitStream, const ReplicaProperty* replicaProperty, const ReplicaPropertyType* replicaPropertyType, TimeMs timestamp, bool forceAll)
+bool SerializeArithmetic(BitStream& bitStream, const ReplicaProperty* replicaProperty, const ReplicaPropertyType* replicaPropertyType, TimeMs timestamp, bool forceAll, bool forceChanged)
 {
   // Primitive member info
   typedef typename BasicNativeTypePrimitiveMembers<PropertyType>::Type PrimitiveType;
@@ -1108,7 +1150,7 @@ bool SerializeArithmetic(BitStream& bitStream, const ReplicaProperty* replicaPro
 
         // Has this primitive member changed?
         // (Current value and last value primitive members differ by more than the delta threshold value primitive member?)
-        bool hasChanged = (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
+        bool hasChanged = forceChanged || (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
 
         // Write 'Has Changed?' Flag
         bitStream.Write(hasChanged);
@@ -1152,7 +1194,7 @@ bool SerializeArithmetic(BitStream& bitStream, const ReplicaProperty* replicaPro
 
         // Has this primitive member changed?
         // (Current value and last value primitive members differ?)
-        bool hasChanged = (currentValuePrimitiveMember != lastValuePrimitiveMember);
+        bool hasChanged = forceChanged || (currentValuePrimitiveMember != lastValuePrimitiveMember);
 
         // Write 'Has Changed?' Flag
         bitStream.Write(hasChanged);
@@ -1314,7 +1356,7 @@ bool DeserializeArithmetic(Variant& newValue, BitStream& bitStream, ReplicaPrope
 
 /// (Arithmetic property type behavior)
 template <typename PropertyType, TF_ENABLE_IF(IsBasicNativeTypeArithmetic<PropertyType>::Value)>
-bool SerializeQuantizedArithmetic(BitStream& bitStream, const ReplicaProperty* replicaProperty, const ReplicaPropertyType* replicaPropertyType, TimeMs timestamp, bool forceAll)
+bool SerializeQuantizedArithmetic(BitStream& bitStream, const ReplicaProperty* replicaProperty, const ReplicaPropertyType* replicaPropertyType, TimeMs timestamp, bool forceAll, bool forceChanged)
 {
   // Primitive member info
   typedef typename BasicNativeTypePrimitiveMembers<PropertyType>::Type PrimitiveType;
@@ -1392,7 +1434,7 @@ bool SerializeQuantizedArithmetic(BitStream& bitStream, const ReplicaProperty* r
 
       // Has this primitive member changed?
       // (Current value and last value primitive members differ by more than the delta threshold value primitive member?)
-      bool hasChanged = (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
+      bool hasChanged = forceChanged || (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
 
       // Write 'Has Changed?' Flag
       bitStream.Write(hasChanged);
@@ -1508,7 +1550,7 @@ bool DeserializeQuantizedArithmetic(Variant& newValue, BitStream& bitStream, Rep
   return true;
 }
 
-bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceChanged) const
 {
   // (For the initialization replication phase we want to forcefully serialize all primitive-components to ensure a valid initial value state)
   bool forceAll = (replicationPhase == ReplicationPhase::Initialization);
@@ -1547,7 +1589,7 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
       }
 
     // Non-Boolean Arithmetic Types
-    SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(SerializeArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll);
+    SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(SerializeArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll, forceChanged);
     }
   }
   // Should quantize?
@@ -1565,7 +1607,7 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
       }
 
     // Non-Boolean Arithmetic Types
-    SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(SerializeQuantizedArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll);
+    SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(SerializeQuantizedArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll, forceChanged);
     }
   }
 }
@@ -2071,6 +2113,7 @@ void ReplicaPropertyType::ResetConfig()
 {
   SetUseDeltaThreshold();
   SetDeltaThreshold();
+  SetUseDirtyFlag();
   SetSerializationMode();
   SetUseHalfFloats();
   SetUseQuantization();
@@ -2216,6 +2259,23 @@ const Variant& ReplicaPropertyType::GetDeltaThreshold() const
   return mDeltaThreshold;
 }
 
+void ReplicaPropertyType::SetUseDirtyFlag(bool useDirtyFlag)
+{
+  // Already valid?
+  if(IsValid())
+  {
+    // Unable to modify configuration
+    Error("ReplicaPropertyType is already valid, unable to modify configuration");
+    return;
+  }
+
+  mUseDirtyFlag = useDirtyFlag;
+}
+bool ReplicaPropertyType::GetUseDirtyFlag() const
+{
+  return mUseDirtyFlag;
+}
+
 void ReplicaPropertyType::SetSerializationMode(SerializationMode::Enum serializationMode)
 {
   // Attempting to use serialization mode?
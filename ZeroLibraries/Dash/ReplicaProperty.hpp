@@ -67,6 +67,20 @@ public:
   /// Returns true if the current property value has changed at all since the last observation, else false
   bool HasChangedAtAll() const;
 
+  /// Sets whether or not every setter of the current property value calls MarkDirty
+  /// (Only hooked replica properties of types using dirty flags are observed using dirty flags, the rest are compared every detection interval)
+  void SetHasDirtyHook(bool hasDirtyHook);
+  /// Returns true if every setter of the current property value calls MarkDirty, else false
+  bool HasDirtyHook() const;
+
+  /// Marks the current property value as changed, to be compared on the next change observation
+  /// (Property setters should call this when the replica property type uses dirty flags, otherwise does nothing)
+  void MarkDirty();
+  /// Returns true if the replica property is observed using dirty flags (set once its replica channel is scheduled), else false
+  bool UsesDirtyFlag() const;
+  /// Returns true if the replica property has been marked dirty since the last observation (always true if not using dirty flags), else false
+  bool IsDirty() const;
+
   /// Sets the current property value
   void SetValue(const Variant& value);
   /// Returns the current property value
@@ -133,8 +147,9 @@ public:
   //
 
   /// Serializes the replica property
+  /// (Force changed writes every primitive-component as changed, used to resynchronize a link that missed changes)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp, bool forceChanged = false) const;
   /// Deserializes the replica property
   /// Returns true if successful, else false
   bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
@@ -154,6 +169,8 @@ public:
   Math::SplineCurve      mSplineCurve[4];              /// Received property change value curve (for each primitive member)
   Math::BakedCurve       mBakedCurve[4];               /// Received property change value curve baked out (for each primitive member)
   ConvergenceState::Enum mConvergenceState;            /// Convergence method currently being applied to this replica property
+  uint                   mDirtyIndex;                  /// Replica channel dirty property flag index (cInvalidDirtyIndex if not using dirty flags)
+  bool                   mHasDirtyHook;                /// Does every property setter call MarkDirty?
 };
 
 /// Typedefs
@@ -288,6 +305,14 @@ public:
   void SetDeltaThreshold(const Variant& deltaThreshold = Variant());
   const Variant& GetDeltaThreshold() const;
 
+  /// Controls whether or not replica properties are only compared during change detection after being marked dirty (see ReplicaProperty::MarkDirty)
+  /// (Enable if every property setter marks the replica property dirty, avoids getting and comparing unchanged property values every detection interval)
+  /// (Only applies to replica properties with a dirty hook, see ReplicaProperty::SetHasDirtyHook, the rest are still compared every detection interval)
+  /// (Replica channels in which every replica property uses dirty flags are only observed after being marked dirty)
+  /// (Cannot be modified after the replica property type has been made valid)
+  void SetUseDirtyFlag(bool useDirtyFlag = false);
+  bool GetUseDirtyFlag() const;
+
   /// Controls how replica properties are serialized
   /// (Only used with arithmetic replica property primitive-component types)
   /// (Cannot be modified after the replica property type has been made valid)
@@ -399,6 +424,7 @@ public:
   ReplicaPropertyIndex    mRestingPropertyIndex;           /// Resting replica properties index
   bool                    mUseDeltaThreshold;              /// Use delta threshold?
   Variant                 mDeltaThreshold;                 /// Delta threshold
+  bool                    mUseDirtyFlag;                   /// Use dirty flag?
   SerializationMode::Enum mSerializationMode;              /// Serialization mode
   bool                    mUseHalfFloats;                  /// Use half floats?
   bool                    mUseQuantization;                /// Use quantization?
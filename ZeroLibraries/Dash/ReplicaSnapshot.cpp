@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+/// Writes the snapshot as a bitwise XOR against the baseline (if any), one byte at a time
+/// (Unchanged bytes cost a single bit, so slowly changing values serialize mostly as zeros)
+static void WriteSnapshotDelta(const BitStream& snapshot, const BitStream* baseline, BitStream& bitStream)
+{
+  // (Snapshots are padded to whole bytes)
+  Assert(snapshot.GetBitsWritten() == BYTES_TO_BITS(snapshot.GetBytesWritten()));
+
+  Bytes       snapshotBytes = snapshot.GetBytesWritten();
+  const byte* snapshotData  = snapshot.GetData();
+  Bytes       baselineBytes = baseline ? baseline->GetBytesWritten() : 0;
+  const byte* baselineData  = baseline ? baseline->GetData() : nullptr;
+
+  // Write snapshot size (only if it differs from the baseline's size)
+  bool sameSize = (snapshotBytes == baselineBytes);
+  bitStream.Write(sameSize);
+  if(!sameSize)
+    bitStream.Write(snapshotBytes);
+
+  // For all snapshot bytes
+  for(Bytes i = 0; i < snapshotBytes; ++i)
+  {
+    // Write byte delta (only if the byte has changed)
+    byte delta = byte(snapshotData[i] ^ (i < baselineBytes ? baselineData[i] : 0));
+    bitStream.Write(delta != 0);
+    if(delta != 0)
+      bitStream.WriteByte(delta);
+  }
+}
+
+/// Reads the snapshot delta and reconstructs the snapshot from the baseline (if any)
+/// Returns true if successful, else false
+static bool ReadSnapshotDelta(const BitStream& bitStream, const BitStream* baseline, BitStream& snapshot)
+{
+  Bytes       baselineBytes = baseline ? baseline->GetBytesWritten() : 0;
+  const byte* baselineData  = baseline ? baseline->GetData() : nullptr;
+
+  // Read snapshot size
+  bool sameSize = false;
+  if(!bitStream.Read(sameSize)) // Unable?
+    return false;
+  Bytes snapshotBytes = baselineBytes;
+  if(!sameSize && !bitStream.Read(snapshotBytes)) // Unable?
+    return false;
+
+  // Snapshot can't possibly fit in the remaining data?
+  // (Every byte is written with at least its changed flag bit)
+  if(snapshotBytes > bitStream.GetBitsUnread())
+    return false;
+
+  // For all snapshot bytes
+  snapshot.Clear(false);
+  snapshot.Reserve(snapshotBytes);
+  for(Bytes i = 0; i < snapshotBytes; ++i)
+  {
+    // Read byte delta (if the byte has changed)
+    bool changed = false;
+    uint8 delta  = 0;
+    if(!bitStream.Read(changed)
+    || (changed && !bitStream.ReadByte(delta))) // Unable?
+      return false;
+
+    snapshot.WriteByte(uint8(delta ^ (i < baselineBytes ? baselineData[i] : 0)));
+  }
+
+  // Success
+  return true;
+}
+
+//---------------------------------------------------------------------------------//
+//                              PendingSnapshot                                    //
+//---------------------------------------------------------------------------------//
+
+PendingSnapshot::PendingSnapshot()
+  : mSnapshotId(0),
+    mReceiptId(0),
+    mSnapshot()
+{
+}
+PendingSnapshot::PendingSnapshot(SnapshotId snapshotId, MessageReceiptId receiptId, const BitStream& snapshot)
+  : mSnapshotId(snapshotId),
+    mReceiptId(receiptId),
+    mSnapshot(snapshot)
+{
+}
+
+//---------------------------------------------------------------------------------//
+//                             OutgoingSnapshots                                   //
+//---------------------------------------------------------------------------------//
+
+OutgoingSnapshots::OutgoingSnapshots()
+  : mNextSnapshotId(0),
+    mHasBaseline(false),
+    mBaselineSnapshotId(0),
+    mBaseline(),
+    mPendingSnapshots()
+{
+}
+
+SnapshotId OutgoingSnapshots::Encode(const BitStream& snapshot, BitStream& bitStream)
+{
+  // Get snapshot ID
+  SnapshotId snapshotId = mNextSnapshotId++;
+
+  // Determine baseline age
+  // (Key snapshots, and baselines too old to still be remembered remotely, are sent without a baseline)
+  uint age = 0;
+  if(mHasBaseline && (snapshotId.value() % SnapshotKeyInterval) != 0)
+  {
+    age = uint((snapshotId - mBaselineSnapshotId).value());
+    if(age >= SnapshotBaselineWindow)
+      age = 0;
+  }
+
+  // Write snapshot ID and baseline age (0 if a key snapshot)
+  bitStream.Write(snapshotId);
+  bitStream.WriteQuantized(age, uint(0), uint(SnapshotBaselineWindow - 1));
+
+  // Write snapshot delta
+  WriteSnapshotDelta(snapshot, age ? &mBaseline : nullptr, bitStream);
+  return snapshotId;
+}
+
+void OutgoingSnapshots::AddPending(SnapshotId snapshotId, MessageReceiptId receiptId, const BitStream& snapshot)
+{
+  // Too many pending snapshots?
+  // (The oldest could no longer be referenced as a baseline anyway)
+  if(mPendingSnapshots.Size() >= SnapshotBaselineWindow)
+    mPendingSnapshots.EraseAt(0);
+
+  // Add pending snapshot
+  mPendingSnapshots.PushBack(PendingSnapshot(snapshotId, receiptId, snapshot));
+}
+
+bool OutgoingSnapshots::HandleReceipt(MessageReceiptId receiptId, Receipt::Enum receipt)
+{
+  // For all pending snapshots
+  for(uint i = 0; i < mPendingSnapshots.Size(); ++i)
+  {
+    PendingSnapshot& pendingSnapshot = mPendingSnapshots[i];
+    if(pendingSnapshot.mReceiptId != receiptId)
+      continue;
+
+    // Acknowledged and newer than our baseline?
+    if(receipt == Receipt::ACK
+    && (!mHasBaseline || pendingSnapshot.mSnapshotId > mBaselineSnapshotId))
+    {
+      // Use as our new baseline
+      mHasBaseline        = true;
+      mBaselineSnapshotId = pendingSnapshot.mSnapshotId;
+      mBaseline           = ZeroMove(pendingSnapshot.mSnapshot);
+
+      // Remove it along with every older pending snapshot
+      // (They can no longer become our baseline)
+      mPendingSnapshots.Erase(mPendingSnapshots.SubRange(0, i + 1));
+    }
+    else
+    {
+      // Remove pending snapshot
+      mPendingSnapshots.EraseAt(i);
+    }
+
+    // Success
+    return true;
+  }
+
+  // Unknown receipt
+  return false;
+}
+
+//---------------------------------------------------------------------------------//
+//                              ReceivedSnapshot                                   //
+//---------------------------------------------------------------------------------//
+
+ReceivedSnapshot::ReceivedSnapshot()
+  : mIsValid(false),
+    mSnapshotId(0),
+    mSnapshot()
+{
+}
+
+//---------------------------------------------------------------------------------//
+//                             IncomingSnapshots                                   //
+//---------------------------------------------------------------------------------//
+
+bool IncomingSnapshots::Decode(const BitStream& bitStream, BitStream& snapshot)
+{
+  // Read snapshot ID and baseline age (0 if a key snapshot)
+  SnapshotId snapshotId;
+  uint       age = 0;
+  if(!bitStream.Read(snapshotId)
+  || !bitStream.ReadQuantized(age, uint(0), uint(SnapshotBaselineWindow - 1))) // Unable?
+    return false;
+
+  // Get baseline (if any)
+  const BitStream* baseline = nullptr;
+  if(age != 0)
+  {
+    SnapshotId        baselineSnapshotId = snapshotId - SnapshotId(age);
+    ReceivedSnapshot& received           = mHistory[baselineSnapshotId.value() % SnapshotHistorySize];
+    if(!received.mIsValid || received.mSnapshotId != baselineSnapshotId) // Baseline not known?
+      return false;
+
+    baseline = &received.mSnapshot;
+  }
+
+  // Read snapshot delta
+  if(!ReadSnapshotDelta(bitStream, baseline, snapshot)) // Unable?
+    return false;
+
+  // Remember snapshot (it may be referenced as a future baseline)
+  ReceivedSnapshot& received = mHistory[snapshotId.value() % SnapshotHistorySize];
+  received.mIsValid    = true;
+  received.mSnapshotId = snapshotId;
+  received.mSnapshot   = snapshot;
+
+  // Success
+  return true;
+}
+
+} // namespace Zero
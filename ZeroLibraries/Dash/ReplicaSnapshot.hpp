@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright 2026, DigiPen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace Zero
+{
+
+/// Maximum age of a snapshot baseline (in snapshots)
+/// Baselines any older are not referenced, a key snapshot is sent instead
+static const uint SnapshotBaselineWindow = 32;
+
+/// Number of received snapshots remembered as potential baselines
+/// (Must evenly divide the snapshot ID sequence space)
+static const uint SnapshotHistorySize = 64;
+
+/// Snapshot ID interval in which key snapshots are sent
+/// Key snapshots reference no baseline, allowing a remote peer that lost its baseline to recover
+static const uint SnapshotKeyInterval = 32;
+
+//---------------------------------------------------------------------------------//
+//                              PendingSnapshot                                    //
+//---------------------------------------------------------------------------------//
+
+/// Snapshot sent on a replica channel, waiting to be receipted
+struct PendingSnapshot
+{
+  /// Constructors
+  PendingSnapshot();
+  PendingSnapshot(SnapshotId snapshotId, MessageReceiptId receiptId, const BitStream& snapshot);
+
+  /// Data
+  SnapshotId       mSnapshotId; /// Snapshot ID
+  MessageReceiptId mReceiptId;  /// Change message receipt ID
+  BitStream        mSnapshot;   /// Entire replica channel state
+};
+
+//---------------------------------------------------------------------------------//
+//                             OutgoingSnapshots                                   //
+//---------------------------------------------------------------------------------//
+
+/// Outgoing Snapshots
+/// Encodes replica channel snapshots against the newest snapshot acknowledged by the remote peer
+class OutgoingSnapshots
+{
+public:
+  /// Constructor
+  OutgoingSnapshots();
+
+  /// Writes the snapshot as a delta against our baseline (or as a key snapshot if there is none)
+  /// Returns the snapshot ID of the encoded snapshot
+  SnapshotId Encode(const BitStream& snapshot, BitStream& bitStream);
+
+  /// Remembers the encoded snapshot until its change message is receipted
+  void AddPending(SnapshotId snapshotId, MessageReceiptId receiptId, const BitStream& snapshot);
+
+  /// Handles the change message receipt (acknowledged snapshots become our new baseline)
+  /// Returns true if the receipt belonged to a pending snapshot, else false
+  bool HandleReceipt(MessageReceiptId receiptId, Receipt::Enum receipt);
+
+  /// Data
+  SnapshotId             mNextSnapshotId;     /// Next snapshot ID
+  bool                   mHasBaseline;        /// Has a baseline?
+  SnapshotId             mBaselineSnapshotId; /// Baseline snapshot ID
+  BitStream              mBaseline;           /// Newest snapshot acknowledged by the remote peer
+  Array<PendingSnapshot> mPendingSnapshots;   /// Snapshots sent but not yet receipted
+};
+
+//---------------------------------------------------------------------------------//
+//                              ReceivedSnapshot                                   //
+//---------------------------------------------------------------------------------//
+
+/// Snapshot received on a replica channel
+struct ReceivedSnapshot
+{
+  /// Constructor
+  ReceivedSnapshot();
+
+  /// Data
+  bool       mIsValid;    /// Is valid?
+  SnapshotId mSnapshotId; /// Snapshot ID
+  BitStream  mSnapshot;   /// Entire replica channel state
+};
+
+//---------------------------------------------------------------------------------//
+//                             IncomingSnapshots                                   //
+//---------------------------------------------------------------------------------//
+
+/// Incoming Snapshots
+/// Decodes replica channel snapshots against previously received snapshots
+class IncomingSnapshots
+{
+public:
+  /// Reads the snapshot delta and reconstructs the entire snapshot from its baseline
+  /// Returns true if successful, else false (the referenced baseline is not known)
+  bool Decode(const BitStream& bitStream, BitStream& snapshot);
+
+  /// Data
+  ReceivedSnapshot mHistory[SnapshotHistorySize]; /// Received snapshots indexed by snapshot ID
+};
+
+/// Typedefs
+typedef HashMap<ReplicaChannel*, OutgoingSnapshots> OutgoingSnapshotMap;
+typedef HashMap<ReplicaChannel*, IncomingSnapshots> IncomingSnapshotMap;
+typedef HashMap<MessageReceiptId, ReplicaChannel*>  SnapshotReceiptMap;
+
+} // namespace Zero
@@ -574,6 +574,8 @@ void Replicator::ResetConfig()
 {
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetRelevanceInterval();
+  SetPrioritizeChanges();
 }
 
 void Replicator::SetFrameFillWarning(float frameFillWarning)
@@ -594,6 +596,32 @@ float Replicator::GetFrameFillSkip() const
   return mFrameFillSkip;
 }
 
+void Replicator::SetRelevanceInterval(uint relevanceInterval)
+{
+  // Disabling relevance filtering while serving?
+  bool disabling = (relevanceInterval == 0 && mRelevanceInterval != 0);
+  mRelevanceInterval = relevanceInterval;
+  if(disabling && IsInitialized() && GetRole() == Role::Server)
+  {
+    // Resume replicating every replica currently irrelevant to a link
+    // (Relevance is no longer updated, so they would otherwise stay irrelevant)
+    ClearRelevance(GetPeer()->GetLocalTime());
+  }
+}
+uint Replicator::GetRelevanceInterval() const
+{
+  return mRelevanceInterval;
+}
+
+void Replicator::SetPrioritizeChanges(bool prioritizeChanges)
+{
+  mPrioritizeChanges = prioritizeChanges;
+}
+bool Replicator::GetPrioritizeChanges() const
+{
+  return mPrioritizeChanges;
+}
+
 //
 // Replica Channel Type Management
 //
@@ -1794,8 +1822,9 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
   if(!links.Empty()) // Links in route?
   {
     // Serialize replica channel change
+    // (Delta snapshot changes serialize the entire replica channel state, encoded per link when sent)
     Message message(ReplicatorMessageType::Change);
-    if(!SerializeChange(replicaChannel, message, timestamp)) // Unable?
+    if(!SerializeChange(replicaChannel, message, timestamp, replicaChannel->GetReplicaChannelType()->GetUseDeltaSnapshots())) // Unable?
       return false;
 
     // Should include an accurate timestamp with this message?
@@ -1811,6 +1840,19 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
       // Get replicator link
       ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+      // Replica is irrelevant to this link?
+      if(replicatorLink->IsReplicaIrrelevant(replica))
+        continue; // Skip link (The link will be resynchronized once the replica is relevant again)
+
+      // Prioritize changes?
+      if(GetPrioritizeChanges())
+      {
+        // Has replica remotely?
+        if(replicatorLink->HasReplica(replica))
+          replicatorLink->QueueChange(replicaChannel, message); // Queue replica channel change (Sent at the end of our update by priority)
+        continue;
+      }
+
       // Should skip change replication?
       if(replicatorLink->ShouldSkipChangeReplication())
         continue; // Skip link
@@ -1824,13 +1866,13 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
   // Success
   return true;
 }
-bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp)
+bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp, bool forceChanged)
 {
   // Serialize replica channel change
   BitStream& bitStream = message.GetData();
 
   // Write replica channel
-  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp);
+  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp, forceChanged);
   if(!result) // Unable?
   {
     Assert(false);
@@ -1841,6 +1883,99 @@ bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& messag
   return true;
 }
 
+void Replicator::UpdateRelevance(TimeMs timestamp)
+{
+  Assert(GetRole() == Role::Server);
+
+  // User callback
+  OnRelevanceUpdate();
+
+  // For all links
+  PeerLinkSet links = GetLinks();
+  forRange(PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // For all live replicas expected remotely
+    forRange(Replica* replica, replicatorLink->GetReplicas().All())
+    {
+      // Link is this replica's change authority client?
+      // (The authority client is the source of the replica's changes, so it's always relevant)
+      if(replicatorLink->GetReplicatorId() == replica->GetAuthorityClientReplicatorId())
+        continue;
+
+      // Relevance unchanged?
+      bool wasRelevant = !replicatorLink->IsReplicaIrrelevant(replica);
+      bool isRelevant  = IsReplicaRelevant(replicatorLink, replica);
+      if(wasRelevant == isRelevant)
+        continue;
+
+      // Replica has become irrelevant?
+      if(!isRelevant)
+      {
+        // Stop replicating changes to this link
+        replicatorLink->mIrrelevantReplicas.Insert(replica);
+        replicatorLink->RemoveQueuedChanges(replica);
+        continue;
+      }
+
+      // Resume replicating changes to this link
+      ResumeRelevance(replicatorLink, replica, timestamp);
+    }
+  }
+}
+void Replicator::ClearRelevance(TimeMs timestamp)
+{
+  Assert(GetRole() == Role::Server);
+
+  // For all links
+  PeerLinkSet links = GetLinks();
+  forRange(PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // For all replicas currently irrelevant to this link
+    // (Copied, resuming a replica removes it from the set)
+    ReplicaSet irrelevantReplicas = replicatorLink->mIrrelevantReplicas;
+    forRange(Replica* replica, irrelevantReplicas.All())
+    {
+      // Resume replicating changes to this link
+      ResumeRelevance(replicatorLink, replica, timestamp);
+    }
+  }
+}
+void Replicator::ResumeRelevance(ReplicatorLink* replicatorLink, Replica* replica, TimeMs timestamp)
+{
+  // Resume replicating changes to this link
+  replicatorLink->mIrrelevantReplicas.EraseValue(replica);
+
+  // For all replica channels
+  forRange(ReplicaChannel* replicaChannel, replica->GetReplicaChannels().All())
+  {
+    // Replica channel authority does not match our role?
+    // (Changes to this replica channel aren't replicated by us)
+    if(uint(replicaChannel->GetAuthority()) != uint(GetRole()))
+      continue;
+
+    // Serialize every replica property to resynchronize the changes missed while irrelevant
+    Message message(ReplicatorMessageType::Change);
+    if(!SerializeChange(replicaChannel, message, timestamp, true)) // Unable?
+      continue;
+
+    // Should include an accurate timestamp with this message?
+    if(Replicator::ShouldIncludeAccurateTimestampOnChange(replicaChannel))
+    {
+      // Set accurate timestamp
+      message.SetTimestamp(timestamp);
+    }
+
+    // Send replica channel change
+    replicatorLink->SendChange(replicaChannel, message);
+  }
+}
+
 bool Replicator::RouteInterrupt(const Route& route)
 {
   Assert(GetRole() == Role::Server);
@@ -1964,6 +2099,25 @@ void Replicator::OnUpdate()
     replicaPropertyType->ConvergeNow();
   }
 
+  // Is server and relevance filtering is enabled?
+  uint relevanceInterval = GetRelevanceInterval();
+  if(GetRole() == Role::Server && relevanceInterval != 0)
+  {
+    // Relevance update frame?
+    if(GetPeer()->GetLocalFrameId() % relevanceInterval == 0)
+      UpdateRelevance(now);
+  }
+
+  // For all links
+  forRange(PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // Send queued changes by priority (as outgoing bandwidth allows)
+    replicatorLink->SendQueuedChanges();
+  }
+
   //
   // Update End
   //
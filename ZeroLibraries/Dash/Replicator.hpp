@@ -197,6 +197,16 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls how often (in frames) replica relevance is updated for every link, 0 disables relevance filtering
+  /// (Changes are not replicated to links the replica is irrelevant to, the link is resynchronized once it becomes relevant again)
+  void SetRelevanceInterval(uint relevanceInterval = 0);
+  uint GetRelevanceInterval() const;
+
+  /// Controls whether replica channel changes are queued per link and sent in order of their accumulated replica priority
+  /// (Instead of skipping all change replication once a link's frame fill skip threshold is exceeded)
+  void SetPrioritizeChanges(bool prioritizeChanges = false);
+  bool GetPrioritizeChanges() const;
+
   //
   // Replica Channel Type Management
   //
@@ -279,6 +289,17 @@ public:
   /// Called after a replica channel property has legitimately changed, determined using comparisons, in a particular replication phase
   virtual void OnReplicaChannelPropertyChange(TimeMs timestamp, ReplicationPhase::Enum replicationPhase, Replica* replica, ReplicaChannel* replicaChannel, ReplicaProperty* replicaProperty, TransmissionDirection::Enum direction) {}
 
+  //
+  // Relevance Interface
+  //
+
+  /// [Server] Called before replica relevance is updated for every link
+  virtual void OnRelevanceUpdate() {}
+  /// [Server] Returns true if the live replica is relevant to the specified link, else false
+  virtual bool IsReplicaRelevant(ReplicatorLink* link, Replica* replica) { return true; }
+  /// Returns the priority accumulated every frame by the replica's queued changes on the specified link
+  virtual float GetReplicaPriority(ReplicatorLink* link, Replica* replica) { return 1; }
+
   //
   // Link Interface
   //
@@ -428,8 +449,16 @@ public:
   /// Returns true if successful, else false
   bool RouteChange(ReplicaChannel* replicaChannel, const Route& route, TimeMs timestamp);
   /// Serializes a replica channel change
+  /// (Force changed serializes every replica property as changed)
   /// Returns true if successful, else false
-  bool SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp);
+  bool SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp, bool forceChanged = false);
+
+  /// [Server] Updates replica relevance for every link, resynchronizing replicas which have become relevant again
+  void UpdateRelevance(TimeMs timestamp);
+  /// [Server] Makes every replica relevant to every link again, resynchronizing them (called when relevance filtering is disabled)
+  void ClearRelevance(TimeMs timestamp);
+  /// [Server] Makes the replica relevant to the link again and resynchronizes its replica channels
+  void ResumeRelevance(ReplicatorLink* replicatorLink, Replica* replica, TimeMs timestamp);
 
   /// [Server] Routes an interrupt command
   /// Returns true if successful, else false
@@ -707,6 +736,8 @@ public:
   void*                  mUserData;             /// Optional user data
   float                  mFrameFillWarning;     /// Controls when the user will be warned of their current frame's outgoing bandwidth utilization ratio on any given link
   float                  mFrameFillSkip;        /// Controls when to skip change replication for the current frame because of remaining outgoing bandwidth utilization ratio on any given link
+  uint                   mRelevanceInterval;    /// [Server] Controls how often (in frames) replica relevance is updated for every link
+  bool                   mPrioritizeChanges;    /// Controls whether replica channel changes are queued per link and sent in order of their accumulated replica priority
   ReplicaChannelTypeSet  mReplicaChannelTypes;  /// Replica channel type set
   ReplicaPropertyTypeSet mReplicaPropertyTypes; /// Replica property type set
 
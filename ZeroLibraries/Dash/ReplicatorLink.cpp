@@ -9,6 +9,73 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                                QueuedChange                                     //
+//---------------------------------------------------------------------------------//
+
+QueuedChange::QueuedChange()
+  : mReplicaChannel(nullptr),
+    mMessage()
+{
+}
+QueuedChange::QueuedChange(ReplicaChannel* replicaChannel, const Message& message)
+  : mReplicaChannel(replicaChannel),
+    mMessage(message)
+{
+}
+
+//---------------------------------------------------------------------------------//
+//                            QueuedReplicaChanges                                 //
+//---------------------------------------------------------------------------------//
+
+QueuedReplicaChanges::QueuedReplicaChanges()
+  : mReplica(nullptr),
+    mPriority(0),
+    mFramesQueued(0),
+    mChanges()
+{
+}
+
+/// Sorts queued replica changes by their accumulated priority, highest first
+struct QueuedReplicaChangesPrioritySort
+{
+  bool operator()(const QueuedReplicaChanges* lhs, const QueuedReplicaChanges* rhs) const
+  {
+    return lhs->mPriority > rhs->mPriority;
+  }
+};
+
+/// Returns true if a change to the specified replica channel contains its entire state, else false
+/// (Only then may a newer unreliable change supersede an older unsent change)
+static bool ContainsEntireState(ReplicaChannel* replicaChannel)
+{
+  // Get replica channel type
+  ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
+
+  // Reliable changes must all be sent
+  if(replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable)
+    return false;
+
+  // Delta snapshot changes always serialize the entire state
+  if(replicaChannelType->GetUseDeltaSnapshots())
+    return true;
+
+  // Only changed replica properties are serialized?
+  if(replicaChannelType->GetSerializationMode() != SerializationMode::All
+  && replicaChannel->GetReplicaProperties().Size() != 1)
+    return false;
+
+  // For all replica properties
+  forRange(ReplicaProperty* replicaProperty, replicaChannel->GetReplicaProperties().All())
+  {
+    // Only changed primitive-components are serialized?
+    if(replicaProperty->GetReplicaPropertyType()->GetSerializationMode() != SerializationMode::All)
+      return false;
+  }
+
+  return true;
+}
+
 //---------------------------------------------------------------------------------//
 //                               ReplicatorLink                                    //
 //---------------------------------------------------------------------------------//
@@ -28,7 +95,12 @@ ReplicatorLink::ReplicatorLink(Replicator* replicator)
     mLastConnectResponseData(),
     mShouldSkipChangeReplication(false),
     mLastFrameFillSkipNotificationTime(0),
-    mLastFrameFillWarningNotificationTime(0)
+    mLastFrameFillWarningNotificationTime(0),
+    mIrrelevantReplicas(),
+    mQueuedChanges(),
+    mOutgoingSnapshots(),
+    mIncomingSnapshots(),
+    mSnapshotReceipts()
 {
 }
 
@@ -187,6 +259,11 @@ bool ReplicatorLink::ShouldSkipChangeReplication() const
   return mShouldSkipChangeReplication;
 }
 
+bool ReplicatorLink::IsReplicaIrrelevant(Replica* replica) const
+{
+  return mIrrelevantReplicas.Contains(replica);
+}
+
 //
 // Internal
 //
@@ -263,6 +340,104 @@ void ReplicatorLink::UpdateEnd(TimeMs now)
   }
 }
 
+void ReplicatorLink::QueueChange(ReplicaChannel* replicaChannel, const Message& message)
+{
+  Assert(message.GetType() == ReplicatorMessageType::Change);
+
+  // Get replica
+  Replica* replica = replicaChannel->GetReplica();
+
+  Assert(HasReplica(replica));
+
+  // Get queued replica changes
+  QueuedReplicaChanges& queuedReplicaChanges = mQueuedChanges[replica];
+  queuedReplicaChanges.mReplica = replica;
+
+  // Change contains the replica channel's entire state?
+  if(ContainsEntireState(replicaChannel))
+  {
+    // For all queued changes
+    forRange(QueuedChange& queuedChange, queuedReplicaChanges.mChanges.All())
+    {
+      // Unsent change to the same replica channel?
+      if(queuedChange.mReplicaChannel == replicaChannel)
+      {
+        // Supersede it
+        queuedChange.mMessage = message;
+        return;
+      }
+    }
+  }
+
+  // Queue change
+  queuedReplicaChanges.mChanges.PushBack(QueuedChange(replicaChannel, message));
+}
+void ReplicatorLink::SendQueuedChanges()
+{
+  // No queued changes?
+  if(mQueuedChanges.Empty())
+    return;
+
+  // For all queued replica changes
+  Array<QueuedReplicaChanges*> queue;
+  queue.Reserve(mQueuedChanges.Size());
+  forRange(QueuedChangeMap::pair& entry, mQueuedChanges.All())
+  {
+    // Accumulate replica priority
+    entry.second.mPriority += GetReplicator()->GetReplicaPriority(this, entry.first);
+    ++entry.second.mFramesQueued;
+    queue.PushBack(&entry.second);
+  }
+
+  // Sort by accumulated priority, highest first
+  Sort(queue.All(), QueuedReplicaChangesPrioritySort());
+
+  // Determine this frame's remaining outgoing bandwidth
+  // (Frame size only grows once packets are sent, so our own sends are accounted for as we go)
+  PeerLink* link          = GetLink();
+  Bits      frameCapacity = link->GetOutgoingFrameCapacity();
+  double    frameBudget   = double(frameCapacity) * GetReplicator()->GetFrameFillSkip() - double(link->GetOutgoingFrameSize());
+
+  // For all queued replica changes, highest priority first
+  Array<Replica*> sentReplicas;
+  forRange(QueuedReplicaChanges* queuedReplicaChanges, queue.All())
+  {
+    // Bandwidth limited?
+    if(frameCapacity != 0)
+    {
+      // Sum replica change sizes
+      Bits changeSize = 0;
+      forRange(QueuedChange& queuedChange, queuedReplicaChanges->mChanges.All())
+        changeSize += queuedChange.mMessage.GetTotalBits();
+
+      //     Replica changes don't fit in our remaining budget?
+      // AND Not the first replica sent this frame? (Always make progress while any budget remains)
+      // AND Not waited too long? (Bounds the queue while the budget stays exhausted)
+      if(double(changeSize) > frameBudget
+      && !(sentReplicas.Empty() && frameBudget > 0)
+      && queuedReplicaChanges->mFramesQueued < MaxQueuedChangeFrames)
+        continue; // Leave queued, try smaller lower priority changes
+
+      frameBudget -= double(changeSize);
+    }
+
+    // Send replica changes in the order they were made
+    forRange(QueuedChange& queuedChange, queuedReplicaChanges->mChanges.All())
+      SendChange(queuedChange.mReplicaChannel, queuedChange.mMessage);
+
+    sentReplicas.PushBack(queuedReplicaChanges->mReplica);
+  }
+
+  // Remove sent replica changes
+  // (Their priority starts accumulating again from zero)
+  forRange(Replica* replica, sentReplicas.All())
+    mQueuedChanges.Erase(replica);
+}
+void ReplicatorLink::RemoveQueuedChanges(Replica* replica)
+{
+  mQueuedChanges.Erase(replica);
+}
+
 //
 // Replica Helpers
 //
@@ -427,6 +602,10 @@ void ReplicatorLink::RemoveLiveReplica(Replica* replica)
     bool result = RemoveReplicaFromLiveSet(replica);
     Assert(result); // (Erase should have succeeded)
   }
+
+  // Remove replica relevance and queued change state (if any)
+  mIrrelevantReplicas.EraseValue(replica);
+  RemoveQueuedChanges(replica);
 }
 
 //
@@ -1240,9 +1419,38 @@ bool ReplicatorLink::SendChange(ReplicaChannel* replicaChannel, Message& message
     return false;
   }
 
+  // Determine reliability
+  bool reliable = (replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable);
+
+  // Send changes as delta snapshots?
+  if(replicaChannelType->GetUseDeltaSnapshots())
+  {
+    // Get snapshot (padded to whole bytes)
+    BitStream snapshot = message.GetData();
+    snapshot.WriteUntilByteAligned();
+
+    // Encode snapshot against the newest snapshot they've acknowledged
+    OutgoingSnapshots& outgoingSnapshots = mOutgoingSnapshots[replicaChannel];
+    Message deltaMessage(message, true);
+    SnapshotId snapshotId = outgoingSnapshots.Encode(snapshot, deltaMessage.GetData());
+
+    // Send delta snapshot change message (receipted to advance our baseline)
+    Status status;
+    MessageReceiptId receiptId = LinkPlugin::Send(status, deltaMessage, reliable, channelId, true);
+    if(status.Failed()) // Unable?
+      return false;
+
+    // Remember snapshot until receipted
+    outgoingSnapshots.AddPending(snapshotId, receiptId, snapshot);
+    mSnapshotReceipts[receiptId] = replicaChannel;
+
+    // Success
+    return true;
+  }
+
   // Send change message
   Status status;
-  LinkPlugin::Send(status, message, (replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable), channelId, false);
+  LinkPlugin::Send(status, message, reliable, channelId, false);
   if(status.Failed()) // Unable?
     return false;
 
@@ -1256,6 +1464,22 @@ bool ReplicatorLink::ReceiveChange(const Message& message)
   // Get timestamp from message (may or may not be an accurate timestamp)
   TimeMs timestamp = message.GetTimestamp();
 
+  // Replica channel changes are sent as delta snapshots?
+  ReplicaChannel* replicaChannel = GetIncomingReplicaChannel(message.GetChannelId());
+  if(replicaChannel && replicaChannel->GetReplicaChannelType()->GetUseDeltaSnapshots())
+  {
+    // Decode snapshot against its baseline
+    Message snapshotMessage(message, true);
+    if(!mIncomingSnapshots[replicaChannel].Decode(message.GetData(), snapshotMessage.GetData())) // Unable?
+    {
+      // Ignore (Baseline not known, a later snapshot will reference a known baseline or none at all)
+      return true;
+    }
+
+    // Deserialize replica channel change
+    return DeserializeChange(snapshotMessage, timestamp);
+  }
+
   // Deserialize replica channel change
   return DeserializeChange(message, timestamp);
 }
@@ -1460,6 +1684,9 @@ void ReplicatorLink::CloseOutgoingReplicaChannel(ReplicaChannel* replicaChannel)
 
   // Remove outgoing message channel
   mOutReplicaChannels.Erase(iter);
+
+  // Remove outgoing delta snapshot state (if any)
+  mOutgoingSnapshots.Erase(replicaChannel);
 }
 MessageChannelId ReplicatorLink::GetOutgoingReplicaChannel(ReplicaChannel* replicaChannel) const
 {
@@ -1509,6 +1736,9 @@ void ReplicatorLink::ClearIncomingReplicaChannel(ReplicaChannel* replicaChannel)
 
   // Remove incoming message channel (in regular map)
   mInReplicaChannels.EraseValue(channelId);
+
+  // Remove incoming delta snapshot state (if any)
+  mIncomingSnapshots.Erase(replicaChannel);
 }
 ReplicaChannel* ReplicatorLink::GetIncomingReplicaChannel(MessageChannelId channelId) const
 {
@@ -1896,5 +2126,24 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
     }
   }
 }
+void ReplicatorLink::OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt)
+{
+  // Get delta snapshot replica channel (if any)
+  MessageReceiptId receiptId      = message->GetReceiptID();
+  ReplicaChannel*  replicaChannel = mSnapshotReceipts.FindValue(receiptId, nullptr);
+  if(!replicaChannel) // Not a delta snapshot change message?
+    return;
+
+  // Remove receipt
+  mSnapshotReceipts.Erase(receiptId);
+
+  // Get outgoing delta snapshot state
+  OutgoingSnapshots* outgoingSnapshots = mOutgoingSnapshots.FindPointer(replicaChannel);
+  if(!outgoingSnapshots) // Replica channel closed since?
+    return;
+
+  // Handle receipt
+  outgoingSnapshots->HandleReceipt(receiptId, receipt);
+}
 
 } // namespace Zero
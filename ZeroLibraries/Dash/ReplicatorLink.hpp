@@ -9,6 +9,42 @@
 namespace Zero
 {
 
+//---------------------------------------------------------------------------------//
+//                                QueuedChange                                     //
+//---------------------------------------------------------------------------------//
+
+/// Serialized replica channel change waiting to be sent
+struct QueuedChange
+{
+  /// Constructors
+  QueuedChange();
+  QueuedChange(ReplicaChannel* replicaChannel, const Message& message);
+
+  /// Data
+  ReplicaChannel* mReplicaChannel; /// Changed replica channel
+  Message         mMessage;        /// Serialized change message
+};
+
+//---------------------------------------------------------------------------------//
+//                            QueuedReplicaChanges                                 //
+//---------------------------------------------------------------------------------//
+
+/// Replica channel changes waiting to be sent for a single replica
+struct QueuedReplicaChanges
+{
+  /// Constructor
+  QueuedReplicaChanges();
+
+  /// Data
+  Replica*            mReplica;      /// Changed replica
+  float               mPriority;     /// Priority accumulated every frame the changes remain unsent
+  uint                mFramesQueued; /// Number of frames the changes have remained unsent
+  Array<QueuedChange> mChanges;      /// Changes in the order they were made
+};
+
+/// Queued replica changes mapped by replica
+typedef HashMap<Replica*, QueuedReplicaChanges> QueuedChangeMap;
+
 //---------------------------------------------------------------------------------//
 //                               ReplicatorLink                                    //
 //---------------------------------------------------------------------------------//
@@ -81,6 +117,10 @@ public:
   /// Returns true if change replication should be skipped for this link
   bool ShouldSkipChangeReplication() const;
 
+  /// [Server] Returns true if the live replica is currently irrelevant to this link, else false
+  /// (Changes to irrelevant replicas are not replicated to this link)
+  bool IsReplicaIrrelevant(Replica* replica) const;
+
   //
   // Internal
   //
@@ -90,6 +130,15 @@ public:
   /// Called at the end of the operating replicator's update
   void UpdateEnd(TimeMs now);
 
+  /// Queues a replica channel change to be sent by priority
+  /// (Supersedes an unsent change to the same replica channel when the newer change contains its entire state)
+  void QueueChange(ReplicaChannel* replicaChannel, const Message& message);
+  /// Sends queued replica changes in order of their accumulated priority
+  /// Changes which don't fit in this frame's remaining outgoing bandwidth stay queued and continue to accumulate priority
+  void SendQueuedChanges();
+  /// Removes any queued changes for the specified replica
+  void RemoveQueuedChanges(Replica* replica);
+
   //
   // Replica Helpers
   //
@@ -299,6 +348,8 @@ public:
 
   /// Called after a plugin message is received
   void OnPluginMessageReceive(MoveReference<Message> message, bool& continueProcessingCustomMessages) override;
+  /// Called after a plugin message receipt is received
+  void OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt) override;
 
   /// Data
   Replicator* const        mReplicator;                           /// Operating replicator
@@ -315,6 +366,11 @@ public:
   bool                     mShouldSkipChangeReplication;          /// Should skip change replication? (Updated at the start of every frame)
   TimeMs                   mLastFrameFillSkipNotificationTime;    /// Last frame fill skip notification time
   TimeMs                   mLastFrameFillWarningNotificationTime; /// Last frame fill warning notification time
+  ReplicaSet               mIrrelevantReplicas;                   /// [Server] Remotely expected live replicas currently irrelevant to this link
+  QueuedChangeMap          mQueuedChanges;                        /// Replica channel changes waiting to be sent by priority
+  OutgoingSnapshotMap      mOutgoingSnapshots;                    /// Outgoing delta snapshot state by replica channel
+  IncomingSnapshotMap      mIncomingSnapshots;                    /// Incoming delta snapshot state by replica channel
+  SnapshotReceiptMap       mSnapshotReceipts;                     /// Delta snapshot change message receipts (receipt ID to replica channel)
 
 private:
   /// No copy constructor
@@ -28,6 +28,175 @@ UseEventMemoryPool(EventConnection);
 UseEventMemoryPool(EventDispatchList);
 UseEventMemoryPool(EventReceiver);
 UseEventMemoryPool(EventDispatcher);
+UseEventMemoryPool(EventBatch);
+
+//------------------------------------------------------------ Interned Event Id
+// Event names are interned from any thread (script connections, static event
+// definitions). Interning takes the lock but Find doesn't, since every string
+// keyed dispatch goes through it. Names live in blocks that never move and
+// the open addressed id table is only ever replaced (never resized in place),
+// so a reader always sees either a published id with its name or an empty slot.
+const uint cEventNameBlockSize = 1024;
+const uint cMaxEventNameBlocks = 256;
+const uint cMinEventIdTableSize = 256;
+
+struct EventIdTable
+{
+  uint mMask;
+  // The id + 1 of each name, 0 for an empty slot
+  volatile s32* mSlots;
+};
+
+struct EventIdRegistry
+{
+  EventIdRegistry()
+  {
+    mCount = 0;
+    mTable = nullptr;
+    for(uint i = 0; i < cMaxEventNameBlocks; ++i)
+      mNameBlocks[i] = nullptr;
+  }
+
+  const String& GetName(u32 id)
+  {
+    return mNameBlocks[id / cEventNameBlockSize][id % cEventNameBlockSize];
+  }
+
+  EventIdTable* GetTable()
+  {
+    return (EventIdTable*)AtomicLoad((void* volatile*)&mTable);
+  }
+
+  u32 Find(EventIdTable* table, StringParam eventName)
+  {
+    if(table == nullptr)
+      return InternedEventId::cInvalid;
+
+    for(uint i = eventName.Hash() & table->mMask;; i = (i + 1) & table->mMask)
+    {
+      s32 slot = AtomicLoad(&table->mSlots[i]);
+      if(slot == 0)
+        return InternedEventId::cInvalid;
+
+      u32 id = u32(slot - 1);
+      if(GetName(id) == eventName)
+        return id;
+    }
+  }
+
+  void Insert(EventIdTable* table, u32 id)
+  {
+    for(uint i = GetName(id).Hash() & table->mMask;; i = (i + 1) & table->mMask)
+    {
+      if(table->mSlots[i] == 0)
+      {
+        AtomicStore(&table->mSlots[i], s32(id + 1));
+        return;
+      }
+    }
+  }
+
+  // Called under the lock after the new name is stored
+  void Publish(u32 id)
+  {
+    // Keep the table at most half full so probes stay short and always end
+    EventIdTable* table = mTable;
+    if(table != nullptr && mCount * 2 <= table->mMask + 1)
+    {
+      Insert(table, id);
+      return;
+    }
+
+    uint size = table ? (table->mMask + 1) * 2 : cMinEventIdTableSize;
+    EventIdTable* newTable = new EventIdTable();
+    newTable->mMask = size - 1;
+    newTable->mSlots = new s32[size];
+    memset((void*)newTable->mSlots, 0, size * sizeof(s32));
+    for(u32 i = 0; i < mCount; ++i)
+      Insert(newTable, i);
+
+    // Readers may still be probing the old table so it's never freed
+    if(table != nullptr)
+      mRetiredTables.PushBack(table);
+    AtomicStore((void* volatile*)&mTable, newTable);
+  }
+
+  SpinLock mLock;
+  String* mNameBlocks[cMaxEventNameBlocks];
+  u32 mCount;
+  Array<bool> mBatched;
+  EventIdTable* volatile mTable;
+  Array<EventIdTable*> mRetiredTables;
+};
+
+EventIdRegistry& GetEventIdRegistry()
+{
+  // Function static so events defined during static initialization can intern
+  static EventIdRegistry registry;
+  return registry;
+}
+
+InternedEventId InternedEventId::Intern(StringParam eventName, bool batched)
+{
+  EventIdRegistry& registry = GetEventIdRegistry();
+  registry.mLock.Lock();
+  u32 id = registry.Find(registry.mTable, eventName);
+  if(id == cInvalid)
+  {
+    id = registry.mCount;
+    uint block = id / cEventNameBlockSize;
+    if(block >= cMaxEventNameBlocks)
+    {
+      Error("Too many event names have been interned");
+      registry.mLock.Unlock();
+      return InternedEventId();
+    }
+    if(registry.mNameBlocks[block] == nullptr)
+      registry.mNameBlocks[block] = new String[cEventNameBlockSize];
+    registry.mNameBlocks[block][id % cEventNameBlockSize] = eventName;
+    registry.mBatched.PushBack(false);
+    ++registry.mCount;
+    registry.Publish(id);
+  }
+  if(batched)
+    registry.mBatched[id] = true;
+  registry.mLock.Unlock();
+  return InternedEventId(id);
+}
+
+InternedEventId InternedEventId::Find(StringParam eventName)
+{
+  EventIdRegistry& registry = GetEventIdRegistry();
+  return InternedEventId(registry.Find(registry.GetTable(), eventName));
+}
+
+String InternedEventId::GetName() const
+{
+  if(!IsValid())
+    return String();
+
+  // Published names never change
+  return GetEventIdRegistry().GetName(mId);
+}
+
+bool InternedEventId::IsBatched() const
+{
+  if(!IsValid())
+    return false;
+
+  EventIdRegistry& registry = GetEventIdRegistry();
+  registry.mLock.Lock();
+  bool batched = registry.mBatched[mId];
+  registry.mLock.Unlock();
+  return batched;
+}
+
+//------------------------------------------------------------------ Event Batch
+bool EventBatchKey::operator==(const EventBatchKey& rhs) const
+{
+  return Invoke == rhs.Invoke && FunctionSize == rhs.FunctionSize &&
+         memcmp(Function, rhs.Function, FunctionSize) == 0;
+}
 
 namespace Events
 {
@@ -100,7 +269,10 @@ Array<Delegate> EventConnection::sDelayDestructDelegates;
 
 EventConnection::EventConnection()
   :ThisObject(NULL),
-   EventType(NULL)
+   EventType(NULL),
+   mBatchList(NULL),
+   mBatchIndex(0),
+   mBatchEntry(0)
 {
 }
 
@@ -108,7 +280,10 @@ EventConnection::~EventConnection()
 {
   if(!Flags.IsSet(ConnectionFlags::DoNotDisconnect))
   {
-    DispatchList::Unlink(this);
+    if(mBatchList)
+      mBatchList->RemoveFromBatch(this);
+    else
+      DispatchList::Unlink(this);
     ReceiverList::Unlink(this);
   }
 }
@@ -171,14 +346,27 @@ void EventConnection::DelayDestructDelegates()
 }
 
 //----------------------------------------------------------------- Event Signal
-EventDispatchList::EventDispatchList()
+EventDispatchList::EventDispatchList(bool batched)
 {
-
+  mBatched = batched;
+  mBatchesDirty = false;
+  mDispatchDepth = 0;
 }
 
 EventDispatchList::~EventDispatchList()
 {
   OnlyDeleteObjectIn(mConnections);
+
+  // Deleting the connections only clears their entries
+  forRange(EventBatch* batch, mBatches.All())
+  {
+    forRange(EventBatch::Entry& entry, batch->Entries.All())
+    {
+      if(entry.Connection)
+        delete entry.Connection;
+    }
+  }
+  DeleteObjectsInContainer(mBatches);
 }
 
 void EventConnection::RaiseError(StringParam message)
@@ -188,12 +376,101 @@ void EventConnection::RaiseError(StringParam message)
 
 void EventDispatchList::Dispatch(Event* event)
 {
-  BoundType* sentEventType = ZilchVirtualTypeId(event);
-
   //if we have no connections then don't do anything
-  if(mConnections.Empty())
+  if(mConnections.Empty() && mBatches.Empty())
     return;
 
+  if(mDispatchDepth == 0 && mBatchesDirty)
+    CompactBatches();
+
+  ++mDispatchDepth;
+
+  if(!mBatches.Empty())
+    DispatchBatches(event);
+
+  if(!mConnections.Empty() && !event->mTerminated)
+    DispatchConnections(event);
+
+  --mDispatchDepth;
+}
+
+// Invokes a batch of connections that can't be batched one at a time,
+// checking each connection's event type like the dispatch list does
+static void InvokeConnections(EventBatch* batch, Event* event, uint count)
+{
+  BoundType* sentEventType = ZilchVirtualTypeId(event);
+
+  // The array can grow while invoking so it is indexed every iteration
+  for(uint i = 0; i < count; ++i)
+  {
+    EventConnection* connection = batch->Entries[i].Connection;
+    if(connection == nullptr)
+      continue;
+
+    // Do not check if event is already invalid, EventType could have been deleted due to a script recompile.
+    if(CheckEventReceiveAsConnectedType && batch->Entries[i].Object != nullptr &&
+       !sentEventType->IsA(connection->EventType))
+    {
+      String message = String::Format(
+        "Expected a %s, but the event type sent for event %s was %s",
+        connection->EventType->Name.c_str(), event->EventId.c_str(), sentEventType->Name.c_str());
+
+      connection->RaiseError(message);
+
+      // If this is a script connection, we want to skip it (don't want to run invalid code)
+      if(connection->Flags.IsSet(ConnectionFlags::Script))
+        EventDispatchList::Invalidate(connection);
+    }
+
+    if(batch->Entries[i].Object == nullptr)
+    {
+      // Invalid connections are deleted during dispatch like the list does
+      delete connection;
+      continue;
+    }
+
+    connection->Invoke(event);
+
+    if(event->mTerminated)
+      return;
+  }
+}
+
+void EventDispatchList::DispatchBatches(Event* event)
+{
+  BoundType* sentEventType = ZilchVirtualTypeId(event);
+
+  // Connections made during the dispatch wait for the next one. They are
+  // only ever appended to the last batch or to new batches after it.
+  uint batchCount = mBatches.Size();
+  uint lastCount = mBatches.Back()->Entries.Size();
+  for(uint i = 0; i < batchCount; ++i)
+  {
+    EventBatch* batch = mBatches[i];
+    uint count = (i + 1 == batchCount) ? lastCount : batch->Entries.Size();
+    if(count == 0)
+      continue;
+
+    // Every receiver in the batch takes the same event type so it's checked once
+    if(CheckEventReceiveAsConnectedType && batch->EventType && !sentEventType->IsA(batch->EventType))
+    {
+      String message = String::Format(
+        "Expected a %s, but the event type sent for event %s was %s",
+        batch->EventType->Name.c_str(), event->EventId.c_str(), sentEventType->Name.c_str());
+      DoNotifyExceptionAssert("Event Connection", message);
+    }
+
+    batch->Key.Invoke(batch, event, count);
+
+    if(event->mTerminated)
+      return;
+  }
+}
+
+void EventDispatchList::DispatchConnections(Event* event)
+{
+  BoundType* sentEventType = ZilchVirtualTypeId(event);
+
   //dispatch to all connections for this event
   EventConnection* connection = &mConnections.Front();
   //we don't want to iterate over any newly added nodes so we iterate to the last
@@ -255,6 +532,73 @@ void EventDispatchList::Dispatch(Event* event)
 
 }
 
+void EventDispatchList::CompactBatches()
+{
+  // Remove the entries of deleted connections and the batches left empty,
+  // merging batches of the same function that become neighbors. The
+  // connection order is kept.
+  uint batchCount = 0;
+  for(uint i = 0; i < mBatches.Size(); ++i)
+  {
+    EventBatch* batch = mBatches[i];
+    EventBatch* previous = batchCount ? mBatches[batchCount - 1] : nullptr;
+    if(previous && previous->Key == batch->Key)
+    {
+      forRange(EventBatch::Entry& entry, batch->Entries.All())
+      {
+        if(entry.Connection == nullptr)
+          continue;
+        entry.Connection->mBatchIndex = batchCount - 1;
+        entry.Connection->mBatchEntry = previous->Entries.Size();
+        previous->Entries.PushBack(entry);
+      }
+      delete batch;
+      continue;
+    }
+
+    uint count = 0;
+    forRange(EventBatch::Entry& entry, batch->Entries.All())
+    {
+      if(entry.Connection == nullptr)
+        continue;
+      entry.Connection->mBatchIndex = batchCount;
+      entry.Connection->mBatchEntry = count;
+      batch->Entries[count++] = entry;
+    }
+    batch->Entries.Resize(count);
+
+    if(count == 0)
+      delete batch;
+    else
+      mBatches[batchCount++] = batch;
+  }
+  mBatches.Resize(batchCount);
+  mBatchesDirty = false;
+}
+
+void EventDispatchList::RemoveFromBatch(EventConnection* connection)
+{
+  EventBatch* batch = mBatches[connection->mBatchIndex];
+  uint index = connection->mBatchEntry;
+  connection->mBatchList = nullptr;
+
+  // Erasing would shift the entries under a dispatch (and make destroying
+  // many receivers quadratic) so the entry is cleared and the next
+  // dispatch compacts all batches at once
+  batch->Entries[index].Object = nullptr;
+  batch->Entries[index].Connection = nullptr;
+  mBatchesDirty = true;
+}
+
+void EventDispatchList::Invalidate(EventConnection* connection)
+{
+  connection->Flags.SetFlag(ConnectionFlags::Invalid);
+
+  // Batches check the entry instead of the connection's flags
+  if(EventDispatchList* list = connection->mBatchList)
+    list->mBatches[connection->mBatchIndex]->Entries[connection->mBatchEntry].Object = nullptr;
+}
+
 template<typename type>
 void RemoveReceiver(type& mConnections, ObjPtr thisObject)
 {
@@ -275,7 +619,7 @@ void RemoveReceiver(type& mConnections, ObjPtr thisObject)
       // since the dispatcher may be iterating through the 
       // connections list. The dispatcher will removed all invalid
       // connections during invoking.
-      current->Flags.SetFlag(ConnectionFlags::Invalid);
+      EventDispatchList::Invalidate(current);
     }
   }
 }
@@ -284,6 +628,15 @@ void RemoveReceiver(type& mConnections, ObjPtr thisObject)
 void EventDispatchList::Disconnect(ObjPtr thisObject)
 {
   RemoveReceiver(mConnections, thisObject);
+
+  forRange(EventBatch* batch, mBatches.All())
+  {
+    forRange(EventBatch::Entry& entry, batch->Entries.All())
+    {
+      if(entry.Connection && entry.Connection->ThisObject == thisObject)
+        Invalidate(entry.Connection);
+    }
+  }
 }
 
 bool EventDispatchList::IsConnected(ObjPtr thisObject)
@@ -293,12 +646,59 @@ bool EventDispatchList::IsConnected(ObjPtr thisObject)
     if(connection.ThisObject == thisObject)
       return true;
   }
+
+  forRange(EventBatch* batch, mBatches.All())
+  {
+    forRange(EventBatch::Entry& entry, batch->Entries.All())
+    {
+      if(entry.Connection && entry.Connection->ThisObject == thisObject)
+        return true;
+    }
+  }
   return false;
 }
 
 void EventDispatchList::Connect(EventConnection* connection)
 {
-  mConnections.PushBack(connection);
+  if(!mBatched)
+  {
+    mConnections.PushBack(connection);
+    return;
+  }
+
+  // Connections that can't be batched are stored in batches of their own
+  // so every receiver is still invoked in connection order
+  EventBatchKey key;
+  void* object = nullptr;
+  BoundType* eventType = connection->EventType;
+  if(!connection->GetBatchKey(key, object))
+  {
+    key.Invoke = &InvokeConnections;
+    key.FunctionSize = 0;
+    object = connection;
+    eventType = nullptr;
+  }
+
+  // Consecutive receivers of the same function share a batch
+  if(mBatches.Empty() || !(mBatches.Back()->Key == key))
+  {
+    EventBatch* batch = new EventBatch();
+    batch->Key = key;
+    batch->EventType = eventType;
+    mBatches.PushBack(batch);
+  }
+
+  // Appending is safe while dispatching, batches only invoke
+  // the entries that existed when the dispatch started
+  uint batchIndex = mBatches.Size() - 1;
+  EventBatch* batch = mBatches[batchIndex];
+  EventBatch::Entry& entry = batch->Entries.PushBack();
+  entry.Object = object;
+  entry.Connection = connection;
+
+  connection->mBatchList = this;
+  connection->mBatchIndex = batchIndex;
+  connection->mBatchEntry = batch->Entries.Size() - 1;
 }
 
 //--------------------------------------------------------------- Event Receiver
@@ -343,7 +743,7 @@ void EventReceiver::Disconnect(StringParam eventId)
   {
     // Mark all matching connections as invalid so they get removed
     if (connection.mEventId == eventId)
-      connection.Flags.SetFlag(ConnectionFlags::Invalid);
+      EventDispatchList::Invalidate(&connection);
   }
 }
 
@@ -360,29 +760,32 @@ EventDispatcher::~EventDispatcher()
   EventConnection::DelayDestructDelegates();
 }
 
+EventDispatchList* EventDispatcher::FindList(InternedEventId id)
+{
+  // Names that were never interned can't have connections
+  if(!id.IsValid())
+    return nullptr;
+  return mEvents.FindValue(id.mId, nullptr);
+}
+
 void EventDispatcher::DisconnectEvent(StringParam eventId, ObjPtr thisObject)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
-  {
-    r.Front().second->Disconnect(thisObject);
-  }
+  EventDispatchList* list = FindList(InternedEventId::Find(eventId));
+  if(list)
+    list->Disconnect(thisObject);
 }
 
 bool EventDispatcher::IsConnected(StringParam eventId, ObjPtr thisObject)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
-  {
-    return r.Front().second->IsConnected(thisObject);
-  }
+  EventDispatchList* list = FindList(InternedEventId::Find(eventId));
+  if(list)
+    return list->IsConnected(thisObject);
   return false;
 }
 
 bool EventDispatcher::IsAnyConnected(StringParam eventId)
 {
-  EventMapType::range r = mEvents.Find(eventId);
-  return !r.Empty();
+  return FindList(InternedEventId::Find(eventId)) != nullptr;
 }
 
 void EventDispatcher::Disconnect(ObjPtr thisObject)
@@ -395,6 +798,16 @@ void EventDispatcher::Disconnect(ObjPtr thisObject)
 }
 
 void EventDispatcher::Dispatch(StringParam eventId, Event* event)
+{
+  DispatchInternal(InternedEventId::Find(eventId), eventId, event);
+}
+
+void EventDispatcher::Dispatch(const EventName& eventId, Event* event)
+{
+  DispatchInternal(eventId.Id, eventId, event);
+}
+
+void EventDispatcher::DispatchInternal(InternedEventId id, StringParam eventId, Event* event)
 {
   if(event == NULL)
   {
@@ -405,19 +818,12 @@ void EventDispatcher::Dispatch(StringParam eventId, Event* event)
   if(event->mTerminated)
     return;
 
-  BoundType* sentEventType = ZilchVirtualTypeId(event);
-
-  // Validate that, if this event is bound, we're actually sending the proper event!
-  BoundType* boundEventType = MetaDatabase::GetInstance()->mEventMap.FindValue(eventId, nullptr);
-
-  if (CheckAllEventsBound)
-  {
-    // Comment this out if there are valid cases!
-    //ErrorIf(boundEventType == nullptr, "Attempting to dispatch an event that is not bound anywhere, we should bind this!");
-  }
-
   if (CheckEventDispatchAsBoundType)
   {
+    BoundType* sentEventType = ZilchVirtualTypeId(event);
+
+    // Validate that, if this event is bound, we're actually sending the proper event!
+    BoundType* boundEventType = MetaDatabase::GetInstance()->mEventMap.FindValue(eventId, nullptr);
     if(boundEventType)
     {
       // The event type that we're sending should be either more derived or the same type
@@ -436,16 +842,12 @@ void EventDispatcher::Dispatch(StringParam eventId, Event* event)
 
   event->EventId = eventId;
 
-  EventMapType::range r = mEvents.Find(eventId);
-  if(!r.Empty())
+  EventDispatchList* list = FindList(id);
+  if(list != nullptr)
   {
     //Object is listening to this signal.
     //Signal all objects in the signal chain.
-    r.Front().second->Dispatch(event);
-  }
-  else
-  {
-    //do nothing
+    list->Dispatch(event);
   }
 
   event->EventId = previousEventId;
@@ -453,23 +855,24 @@ void EventDispatcher::Dispatch(StringParam eventId, Event* event)
 
 bool EventDispatcher::HasReceivers(StringParam eventId)
 {
-  return !mEvents.Find(eventId).Empty();
+  return FindList(InternedEventId::Find(eventId)) != nullptr;
+}
+
+bool EventDispatcher::HasReceivers(const EventName& eventId)
+{
+  return FindList(eventId.Id) != nullptr;
 }
 
 void EventDispatcher::Connect(StringParam eventId, EventConnection* connection)
 {
   //Check to see if the signal has been mapped
-  EventMapType::range r = mEvents.Find(eventId);
-  EventDispatchList* list = nullptr;
-  if(!r.Empty())
-  {
-    list = r.Front().second;
-  }
-  else
+  InternedEventId id = InternedEventId::Intern(eventId);
+  EventDispatchList* list = mEvents.FindValue(id.mId, nullptr);
+  if(list == nullptr)
   {
     //Event with that eventId not yet mapped. Make a new list and map the event id
-    list = new EventDispatchList();
-    mEvents.Insert(eventId, list);
+    list = new EventDispatchList(id.IsBatched());
+    mEvents.Insert(id.mId, list);
   }
 
   //Bind the connection to the event list
@@ -481,9 +884,19 @@ void EventObject::DispatchEvent(StringParam eventId, Event* event)
   this->GetDispatcher()->Dispatch(eventId, event);
 }
 
+void EventObject::DispatchEvent(const EventName& eventId, Event* event)
+{
+  this->GetDispatcher()->Dispatch(eventId, event);
+}
+
 bool EventObject::HasReceivers(StringParam eventId)
 {
   return GetDispatcher()->HasReceivers(eventId);
 }
 
+bool EventObject::HasReceivers(const EventName& eventId)
+{
+  return GetDispatcher()->HasReceivers(eventId);
+}
+
 }//namespace Zero
@@ -15,6 +15,59 @@ namespace Zero
 class EventReceiver;
 class EventDispatcher;
 
+//------------------------------------------------------------ Interned Event Id
+/// Integer handle for an event name. Names are interned once (when an event
+/// is defined or connected to) so dispatchers can key their tables by the
+/// integer instead of hashing and comparing strings on every send.
+class InternedEventId
+{
+public:
+  static const u32 cInvalid = (u32)-1;
+
+  InternedEventId() : mId(cInvalid) {}
+  explicit InternedEventId(u32 id) : mId(id) {}
+
+  /// Returns the id for the name, registering the name if it is new.
+  /// Passing batched marks the event as dispatched through EventBatches
+  /// (it is never unmarked).
+  static InternedEventId Intern(StringParam eventName, bool batched = false);
+  /// Returns an invalid id if the name was never interned (meaning
+  /// nothing has ever connected to or defined the event). Doesn't lock.
+  static InternedEventId Find(StringParam eventName);
+
+  String GetName() const;
+  bool IsValid() const { return mId != cInvalid; }
+  /// Whether the event was defined with DefineBatchedEvent.
+  bool IsBatched() const;
+
+  bool operator==(InternedEventId rhs) const { return mId == rhs.mId; }
+  bool operator!=(InternedEventId rhs) const { return mId != rhs.mId; }
+
+  u32 mId;
+};
+
+//------------------------------------------------------------------- Event Name
+/// Event name string that carries its interned id. DeclareEvent / DefineEvent
+/// create these so sending a declared event never looks the id up. Converts
+/// to a String everywhere a String is expected.
+class EventName : public String
+{
+public:
+  explicit EventName(cstr name)
+    : String(name),
+      Id(InternedEventId::Intern(*this, false))
+  {
+  }
+
+  EventName(cstr name, bool batched)
+    : String(name),
+      Id(InternedEventId::Intern(*this, batched))
+  {
+  }
+
+  InternedEventId Id;
+};
+
 //------------------------------------------------------------------------ Event
 
 ///Base event class. All events types inherit from this class.
@@ -63,6 +116,56 @@ public:
 
 DeclareBitField3(ConnectionFlags, Invalid, DoNotDisconnect, Script);
 
+class EventConnection;
+class EventDispatchList;
+
+//------------------------------------------------------------------ Event Batch
+class EventBatch;
+/// Invokes the first count entries of the batch
+typedef void (*EventBatchFunction)(EventBatch* batch, Event* event, uint count);
+
+/// Identifies the receivers that can share an EventBatch: the same member
+/// function on the same class. The function pointer is stored as bytes since
+/// member function pointers of different classes can't be compared directly.
+/// Connections that can't be batched share a key with no function.
+struct EventBatchKey
+{
+  static const size_t cMaxFunctionSize = 32;
+
+  bool operator==(const EventBatchKey& rhs) const;
+
+  /// Loop that invokes every receiver in the batch
+  EventBatchFunction Invoke;
+  size_t FunctionSize;
+  byte Function[cMaxFunctionSize];
+};
+
+/// Consecutively connected receivers of one member function stored
+/// contiguously so a dispatch calls them all in a single loop instead of
+/// walking a list of heap allocated connections with a virtual call each.
+/// Consecutive connections that can't be batched (script and static
+/// functions) are stored the same way but invoked one by one. Only used for
+/// events defined with DefineBatchedEvent (high frequency events like LogicUpdate).
+class EventBatch
+{
+public:
+  OverloadedNew();
+
+  struct Entry
+  {
+    /// Null once the connection is invalid, the connection is then
+    /// deleted by the next dispatch (the connection itself if it isn't batched)
+    void* Object;
+    /// Null once the connection is deleted
+    EventConnection* Connection;
+  };
+
+  EventBatchKey Key;
+  /// The event type all the receivers take (null if they aren't batched)
+  BoundType* EventType;
+  Array<Entry> Entries;
+};
+
 /// Makes sure a given event string matches a given event type.
 /// This should ALWAYS be called before attaching to a receiver and a dispatcher
 /// If it returns false, meaning it did not validate, it should not be attached to either!
@@ -87,6 +190,10 @@ public:
   virtual void Invoke(Event* event)=0;
   virtual void DebugDraw(){};
 
+  /// Fills out the key and object if this connection can be invoked
+  /// as part of an EventBatch. Only member function connections can.
+  virtual bool GetBatchKey(EventBatchKey& key, void*& object) { return false; }
+
   /// A helper that connects this connection to both receiver (tests for validation too)
   void ConnectToReceiverAndDispatcher(
     StringParam eventId, EventReceiver* receiver, EventDispatcher* dispatcher);
@@ -107,6 +214,12 @@ public:
   /// Name identifier of the event, used by receiver since its connections aren't mapped
   String mEventId;
 
+  /// Set when the connection lives in an EventBatch of this list instead
+  /// of being linked through DispatcherLink
+  EventDispatchList* mBatchList;
+  uint mBatchIndex;
+  uint mBatchEntry;
+
   // Keeps handles alive until a safe time for destruction.
   static Array<Delegate> sDelayDestructDelegates;
   // Clears static array of delegates.
@@ -147,11 +260,13 @@ private:
 
 //---------------------------------------------------------- Event Dispatch List
 /// Object that stores a list of event connections to invoke when Dispatched.
+/// Lists for batched events keep every connection in EventBatches of
+/// consecutive connections, invoked in connection order.
 class EventDispatchList
 {
 public:
   OverloadedNew();
-  EventDispatchList();
+  EventDispatchList(bool batched = false);
   ~EventDispatchList();
 
   /// Dispatch event to all connections
@@ -167,8 +282,26 @@ public:
   /// Is the 'this' object on one of the connections in the list
   /// See EventConnection::ThisObject
   bool IsConnected(ObjPtr thisObject);
+
+  /// Flags the connection as invalid so the next dispatch deletes it.
+  static void Invalidate(EventConnection* connection);
+
+  /// Called by a batched connection's destructor. The entry is only
+  /// cleared, the batches are compacted by the next dispatch.
+  void RemoveFromBatch(EventConnection* connection);
+
 private:
+  void DispatchBatches(Event* event);
+  void DispatchConnections(Event* event);
+  void CompactBatches();
+
   DispatchList mConnections;
+  /// In connection order, only the last batch is appended to
+  Array<EventBatch*> mBatches;
+  bool mBatched;
+  bool mBatchesDirty;
+  /// Nested dispatches in progress, batches can't be compacted while non zero
+  uint mDispatchDepth;
 };
 
 //------------------------------------------------------------- Event Dispatcher
@@ -184,9 +317,12 @@ public:
 
   /// Dispatch event to all connections
   void Dispatch(StringParam eventId, Event* event);
+  /// Dispatch using the id interned with the declared event (no lookup)
+  void Dispatch(const EventName& eventId, Event* event);
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const EventName& eventId);
 
   /// Add a new EventConnection to this Dispatcher
   void Connect(StringParam eventId, EventConnection* connect);
@@ -209,7 +345,11 @@ public:
   bool IsAnyConnected(StringParam eventId);
 
 private:
-  typedef HashMap<String, EventDispatchList*> EventMapType;
+  void DispatchInternal(InternedEventId id, StringParam eventId, Event* event);
+  EventDispatchList* FindList(InternedEventId id);
+
+  /// Keyed by InternedEventId::mId
+  typedef FlatHashMap<u32, EventDispatchList*> EventMapType;
   EventMapType mEvents;
 };
 
@@ -232,6 +372,46 @@ struct MemberFunctionConnection : public EventConnection
   {
     (MyObject->*MyFunction)((eventType*)event);
   }
+
+  bool GetBatchKey(EventBatchKey& key, void*& object) override
+  {
+    // Unusually large member function pointers (virtual inheritance) just
+    // stay on the dispatch list
+    if(sizeof(FuncType) > EventBatchKey::cMaxFunctionSize)
+      return false;
+
+    key.Invoke = &InvokeBatch;
+    key.FunctionSize = sizeof(FuncType);
+    memset(key.Function, 0, EventBatchKey::cMaxFunctionSize);
+    memcpy(key.Function, &MyFunction, sizeof(FuncType));
+    object = MyObject;
+    return true;
+  }
+
+  static void InvokeBatch(EventBatch* batch, Event* event, uint count)
+  {
+    FuncType function;
+    memcpy(&function, batch->Key.Function, sizeof(FuncType));
+
+    // The array can grow while invoking so it is indexed every iteration
+    for(uint i = 0; i < count; ++i)
+    {
+      EventBatch::Entry& entry = batch->Entries[i];
+      classType* object = (classType*)entry.Object;
+      if(object == nullptr)
+      {
+        // Invalid connections are deleted during dispatch like the list does
+        if(entry.Connection != nullptr)
+          delete entry.Connection;
+        continue;
+      }
+
+      (object->*function)((eventType*)event);
+
+      if(event->mTerminated)
+        return;
+    }
+  }
 };
 
 ///Create an event connection
@@ -254,9 +434,13 @@ inline void Connect(targetType* dispatcher, StringParam eventId,
     receiver->GetReceiver(), dispatcher->GetDispatcher());
 }
 
-#define DeclareEvent(name) extern const String name
+#define DeclareEvent(name) extern const EventName name
+
+#define DefineEvent(name) const EventName name(#name)
 
-#define DefineEvent(name) const String name = #name
+/// Defines an event whose member function receivers are stored in
+/// EventBatches. Use for events sent every frame to many receivers.
+#define DefineBatchedEvent(name) const EventName name(#name, true)
 
 #define ConnectThisTo(target, eventname, handle) \
   do { Zero::Connect(target, eventname, this, &ZilchSelf::handle); } while (false)
@@ -308,11 +492,13 @@ public:
   EventReceiver* GetReceiverObject() override { return GetReceiver(); }
 
   void DispatchEvent(StringParam eventId, Event* event);
+  void DispatchEvent(const EventName& eventId, Event* event);
   EventDispatcher* GetDispatcher() { return &mDispatcher; }
   EventReceiver* GetReceiver() { return &mTracker; }
 
   /// Check if anyone has signed up for a particular event.
   bool HasReceivers(StringParam eventId);
+  bool HasReceivers(const EventName& eventId);
 
 protected:
   EventReceiver mTracker;
@@ -83,7 +83,7 @@ Semaphore::~Semaphore()
 {
 }
 
-void Semaphore::Increment()
+void Semaphore::Increment(uint count)
 {
 }
 
@@ -82,6 +82,11 @@ String GetVersionString()
   return String();
 }
 
+uint GetProcessorCount()
+{
+  return 1;
+}
+
 }
 
 u64 GenerateUniqueId64()
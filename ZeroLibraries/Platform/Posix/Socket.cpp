@@ -974,6 +974,18 @@ SocketAddress StringToIpv6Address(StringParam address, ushort port)
   return result;
 }
 
+//---------------------------------------------------------------------------------//
+//                               SocketDatagram                                    //
+//---------------------------------------------------------------------------------//
+
+SocketDatagram::SocketDatagram()
+  : mData(nullptr),
+    mDataLength(0),
+    mBytes(0),
+    mAddress()
+{
+}
+
 //---------------------------------------------------------------------------------//
 //                                    Socket                                       //
 //---------------------------------------------------------------------------------//
@@ -1387,6 +1399,144 @@ size_t Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, Soc
   return result;
 }
 
+size_t Socket::SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+#if defined(__linux__)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  mmsghdr messages[MaxBatchDatagrams];
+  iovec   buffers[MaxBatchDatagrams];
+
+  // For all datagrams (a batch at a time)
+  size_t datagramsSent = 0;
+  size_t index         = 0;
+  while(index < datagramCount)
+  {
+    // Describe batch
+    size_t batchCount = datagramCount - index;
+    if(batchCount > MaxBatchDatagrams)
+      batchCount = MaxBatchDatagrams;
+    for(size_t i = 0; i < batchCount; ++i)
+    {
+      SocketDatagram& datagram = datagrams[index + i];
+      datagram.mBytes = 0;
+
+      buffers[i].iov_base = datagram.mData;
+      buffers[i].iov_len  = datagram.mDataLength;
+
+      memset(&messages[i], 0, sizeof(mmsghdr));
+      messages[i].msg_hdr.msg_name    = datagram.mAddress.mPrivateData;
+      messages[i].msg_hdr.msg_namelen = sizeof(SOCKET_ADDRESS_STORAGE);
+      messages[i].msg_hdr.msg_iov     = &buffers[i];
+      messages[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    // Send batch over socket to specified remote addresses
+    int result = sendmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)batchCount, (int)flags);
+    if(result == SOCKET_ERROR) // Unable to send the first datagram?
+    {
+      FailOnLastError(status);
+
+      // Skip datagram and continue with the rest
+      ++index;
+      continue;
+    }
+
+    // Store bytes sent
+    for(int i = 0; i < result; ++i)
+      datagrams[index + i].mBytes = messages[i].msg_len;
+
+    datagramsSent += result;
+    index         += result;
+  }
+
+  // Success
+  return datagramsSent;
+#else
+  // (Batched datagram sends are not available, send each datagram individually)
+  // For all datagrams
+  size_t datagramsSent = 0;
+  for(size_t i = 0; i < datagramCount; ++i)
+  {
+    // Send datagram over socket to specified remote address
+    SocketDatagram& datagram = datagrams[i];
+    Status datagramStatus;
+    datagram.mBytes = SendTo(datagramStatus, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+    if(datagramStatus.Failed()) // Unable?
+    {
+      status.SetFailed(datagramStatus.Message, datagramStatus.Context);
+      continue;
+    }
+
+    ++datagramsSent;
+  }
+
+  // Success
+  return datagramsSent;
+#endif
+}
+
+size_t Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+#if defined(__linux__)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  mmsghdr messages[MaxBatchDatagrams];
+  iovec   buffers[MaxBatchDatagrams];
+
+  // Describe batch
+  size_t batchCount = datagramCount;
+  if(batchCount > MaxBatchDatagrams)
+    batchCount = MaxBatchDatagrams;
+  for(size_t i = 0; i < batchCount; ++i)
+  {
+    SocketDatagram& datagram = datagrams[i];
+    datagram.mBytes = 0;
+
+    buffers[i].iov_base = datagram.mData;
+    buffers[i].iov_len  = datagram.mDataLength;
+
+    memset(&messages[i], 0, sizeof(mmsghdr));
+    messages[i].msg_hdr.msg_name    = datagram.mAddress.mPrivateData;
+    messages[i].msg_hdr.msg_namelen = sizeof(SOCKET_ADDRESS_STORAGE);
+    messages[i].msg_hdr.msg_iov     = &buffers[i];
+    messages[i].msg_hdr.msg_iovlen  = 1;
+  }
+
+  // Receive batch over socket from any remote addresses
+  // (Only waits for the first datagram, the rest are received only if they have already arrived)
+  int result = recvmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)batchCount, (int)flags | MSG_WAITFORONE, nullptr);
+  if(result == SOCKET_ERROR) // Unable?
+  {
+    FailOnLastError(status);
+    return 0;
+  }
+
+  // Store bytes received
+  for(int i = 0; i < result; ++i)
+    datagrams[i].mBytes = messages[i].msg_len;
+
+  // Success
+  return result;
+#else
+  // (Batched datagram receives are not available, receive one datagram per call)
+  // No datagrams?
+  if(datagramCount == 0)
+    return 0;
+
+  // Receive a single datagram over socket from any remote address
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mBytes = ReceiveFrom(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+  if(status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+#endif
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
@@ -76,7 +76,7 @@ Semaphore::~Semaphore()
 
 }
 
-void Semaphore::Increment()
+void Semaphore::Increment(uint count)
 {
 
 }
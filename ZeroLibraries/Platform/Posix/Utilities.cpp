@@ -83,6 +83,14 @@ void SetTimerFrequency(uint ms)
   // Not available on linux
 }
 
+uint GetProcessorCount()
+{
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  if(count < 1)
+    return 1;
+  return (uint)count;
+}
+
 }//End os
 
 u64 GenerateUniqueId64()
@@ -185,6 +185,27 @@ ZeroShared SocketAddress StringToIpv4Address(StringParam address, ushort port);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address, ushort port);
 
+//---------------------------------------------------------------------------------//
+//                               SocketDatagram                                    //
+//---------------------------------------------------------------------------------//
+
+/// Datagram buffer used by batched socket sends and receives
+/// The data buffer is owned by the caller, allowing it to be allocated once and reused
+struct ZeroShared SocketDatagram
+{
+  /// Creates an empty socket datagram
+  SocketDatagram();
+
+  /// Data buffer
+  byte*         mData;
+  /// Data buffer capacity when receiving, data length when sending
+  size_t        mDataLength;
+  /// Number of bytes received or sent (0 if an error occurred)
+  size_t        mBytes;
+  /// Remote address (the source when receiving, the destination when sending)
+  SocketAddress mAddress;
+};
+
 //---------------------------------------------------------------------------------//
 //                                    Socket                                       //
 //---------------------------------------------------------------------------------//
@@ -341,6 +362,20 @@ public:
   /// Returns the number of bytes received (0 if an error occurs, status will contain the error)
   size_t ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, SocketAddress& from, SocketFlags::Enum flags = SocketFlags::None);
 
+  /// Sends each datagram on the open socket to its remote address, using as few socket library calls as the platform allows
+  /// Will block if the send buffer is full (unless the socket is set to non-blocking)
+  /// Sets each datagram's sent bytes, a datagram that could not be sent does not prevent the remaining datagrams from being sent
+  /// Returns the number of datagrams sent (status will contain the last error if any datagram could not be sent)
+  /// (Named sendmmsg on platforms that support it)
+  size_t SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags = SocketFlags::None);
+
+  /// Receives up to the specified number of datagrams on the open socket from any remote address, using as few socket library calls as the platform allows
+  /// Will block until at least one datagram is received (unless the socket is set to non-blocking), but never waits for the remaining datagrams
+  /// Sets each received datagram's received bytes and source address
+  /// Returns the number of datagrams received (0 if an error occurs, status will contain the error)
+  /// (Named recvmmsg on platforms that support it)
+  size_t ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags = SocketFlags::None);
+
   /// Returns true if the specified socket capability is ready for use, else false
   /// In a high efficiency situation, mechanisms other than select should be used
   bool Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const;
@@ -38,6 +38,9 @@ static const size_t MaxHostNameStringLength                 = 255;
 /// Maximum service name string length (including null terminator)
 static const size_t MaxServiceNameStringLength              = 32;
 
+/// Maximum number of datagrams sent or received by a single batched socket library call
+static const size_t MaxBatchDatagrams = 64;
+
 /// Any available port
 static const ushort AnyPort = 0;
 
@@ -84,6 +84,9 @@ public:
   {
     classType* object = (classType*)objectInstance;
     OsInt returnValue = (object->*MemberFunction)();
+    // Hand this thread's small object cache and frame arenas to the next thread that starts
+    Memory::SizeClassAllocator::ReleaseThreadCache();
+    FrameAllocator::ReleaseThreadArenas();
     return returnValue;
   }
 
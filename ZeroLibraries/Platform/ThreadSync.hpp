@@ -51,7 +51,7 @@ class ZeroShared Semaphore
 public:
   Semaphore();
   ~Semaphore();
-  void Increment();
+  void Increment(uint count = 1);
   void Decrement();
   void Reset();
   void WaitAndDecrement();
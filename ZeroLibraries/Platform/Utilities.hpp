@@ -71,6 +71,9 @@ ZeroShared String TranslateErrorCode(int errorCode);
 // Get a string describing the current operating system version.
 ZeroShared String GetVersionString();
 
+// Get the number of logical processors available to this process.
+ZeroShared uint GetProcessorCount();
+
 }
 
 // Generate a 64 bit unique Id. Uses system timer and mac
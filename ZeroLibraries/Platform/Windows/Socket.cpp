@@ -862,6 +862,18 @@ SocketAddress StringToIpv6Address(StringParam address, ushort port)
   return result;
 }
 
+//---------------------------------------------------------------------------------//
+//                               SocketDatagram                                    //
+//---------------------------------------------------------------------------------//
+
+SocketDatagram::SocketDatagram()
+  : mData(nullptr),
+    mDataLength(0),
+    mBytes(0),
+    mAddress()
+{
+}
+
 //---------------------------------------------------------------------------------//
 //                                    Socket                                       //
 //---------------------------------------------------------------------------------//
@@ -1264,6 +1276,47 @@ size_t Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, Soc
   return result;
 }
 
+size_t Socket::SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  // (Winsock does not provide batched datagram sends, send each datagram individually)
+  // For all datagrams
+  size_t datagramsSent = 0;
+  for(size_t i = 0; i < datagramCount; ++i)
+  {
+    // Send datagram over socket to specified remote address
+    SocketDatagram& datagram = datagrams[i];
+    Status datagramStatus;
+    datagram.mBytes = SendTo(datagramStatus, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+    if(datagramStatus.Failed()) // Unable?
+    {
+      status.SetFailed(datagramStatus.Message, datagramStatus.Context);
+      continue;
+    }
+
+    ++datagramsSent;
+  }
+
+  // Success
+  return datagramsSent;
+}
+
+size_t Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  // (Winsock does not provide batched datagram receives, receive one datagram per call)
+  // No datagrams?
+  if(datagramCount == 0)
+    return 0;
+
+  // Receive a single datagram over socket from any remote address
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mBytes = ReceiveFrom(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+  if(status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
@@ -90,9 +90,9 @@ Semaphore::~Semaphore()
   VerifyWin(CloseHandle(mHandle),"Failed to close Semaphore handle");
 }
 
-void Semaphore::Increment()
+void Semaphore::Increment(uint count)
 {
-  VerifyWin(ReleaseSemaphore(mHandle, 1, NULL), "Failed to increment semaphore");
+  VerifyWin(ReleaseSemaphore(mHandle, (LONG)count, NULL), "Failed to increment semaphore");
 }
 
 void Semaphore::Decrement()
@@ -191,6 +191,13 @@ String TranslateErrorCode(int errorCode)
   return errorString;
 }
 
+uint GetProcessorCount()
+{
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return (uint)systemInfo.dwNumberOfProcessors;
+}
+
 typedef void (WINAPI *GetNativeSystemInfoPtr)(LPSYSTEM_INFO);
 
 String GetVersionString()
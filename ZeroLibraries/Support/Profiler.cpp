@@ -10,6 +10,7 @@
 #include "Precompiled.hpp"
 #include "Profiler.hpp"
 #include "Platform/Timer.hpp"
+#include "Platform/File.hpp"
 #include "Utility/Misc.hpp"
 
 namespace Zero
@@ -19,10 +20,57 @@ namespace Profile
 
 uint Record::sSampleIndex = 0;
 
+// The innermost running scope timer and the timeline of each thread
+ZeroThreadLocal ScopeTimer* gCurrentScopeTimer = nullptr;
+ZeroThreadLocal ThreadTimeline* gThreadTimeline = nullptr;
+
+//------------------------------------------------------------- Thread Timeline
+ThreadTimeline::ThreadTimeline(uint threadIndex)
+{
+  mThreadIndex = threadIndex;
+  mName = String::Format("Thread %u", threadIndex);
+  for(uint i = 0; i < cMaxBlocks; ++i)
+    mBlocks[i] = nullptr;
+  mCount.Store(0);
+  mDropped.Store(0);
+}
+
+ThreadTimeline::~ThreadTimeline()
+{
+  for(uint i = 0; i < cMaxBlocks; ++i)
+    delete[] mBlocks[i];
+}
+
+void ThreadTimeline::Add(Record* record, ProfileTime start, ProfileTime end, size_t capacity)
+{
+  size_t count = mCount.Load();
+  if(count >= capacity)
+  {
+    ++mDropped;
+    return;
+  }
+
+  // Only threads that record while capturing pay for events, a block at a time
+  TraceEvent*& block = mBlocks[count / cBlockSize];
+  if(block == nullptr)
+    block = new TraceEvent[cBlockSize];
+
+  TraceEvent& event = block[count % cBlockSize];
+  event.mRecord = record;
+  event.mStart = start;
+  event.mEnd = end;
+  // Publish the event after it's written
+  mCount.Store(count + 1);
+}
+
+//-------------------------------------------------------------- Profile System
 ProfileSystem* ProfileSystem::Instance = nullptr;
 void ProfileSystem::Initialize()
 {
   Instance = new ProfileSystem();
+  Instance->mCapturing = false;
+  Instance->SetTraceCapacity(1 << 18);
+  SetThreadName("Main");
 }
 
 void ProfileSystem::Shutdown()
@@ -30,35 +78,222 @@ void ProfileSystem::Shutdown()
   SafeDelete(Instance);
 }
 
-float ProfileSystem::GetTimeInSeconds(ProfileTime time)
+ProfileSystem::~ProfileSystem()
 {
-  return (float)mTimer.TicksToSeconds(time);
+  // Threads still holding on to a timeline must have exited by now
+  gThreadTimeline = nullptr;
+  DeleteObjectsInContainer(mTimelines);
 }
 
-void ProfileSystem::Add(Record* record)
+void ProfileSystem::SetThreadName(StringParam name)
 {
-  mRecordList.PushBack(record);
+  if(Instance == nullptr)
+    return;
+
+  ThreadTimeline* timeline = Instance->GetThreadTimeline();
+  Instance->mLock.Lock();
+  timeline->mName = name;
+  Instance->mLock.Unlock();
 }
 
-void ProfileSystem::Add(cstr parentName, Record* record)
+ThreadTimeline* ProfileSystem::GetThreadTimeline()
 {
-  Array<Record*>::range r = mRecordList.All();
-  //if this object has a parent, then walk through the record list
-  //to find the parent
-  if(parentName != nullptr)
+  ThreadTimeline* timeline = gThreadTimeline;
+  if(timeline)
+    return timeline;
+
+  mLock.Lock();
+  timeline = new ThreadTimeline(mTimelines.Size());
+  mTimelines.PushBack(timeline);
+  mLock.Unlock();
+
+  gThreadTimeline = timeline;
+  return timeline;
+}
+
+void ProfileSystem::BeginCapture()
+{
+  mCapturing = true;
+}
+
+void ProfileSystem::EndCapture()
+{
+  mCapturing = false;
+}
+
+void ProfileSystem::SetTraceCapacity(size_t events)
+{
+  size_t maxEvents = (size_t)ThreadTimeline::cBlockSize * ThreadTimeline::cMaxBlocks;
+  mTraceCapacity = events < maxEvents ? events : maxEvents;
+}
+
+size_t ProfileSystem::GetTraceCapacity()
+{
+  return mTraceCapacity.Load();
+}
+
+void ProfileSystem::ClearCapture()
+{
+  mLock.Lock();
+  forRange(ThreadTimeline* timeline, mTimelines.All())
+  {
+    timeline->mCount.Store(0);
+    timeline->mDropped.Store(0);
+  }
+  mLock.Unlock();
+}
+
+// Appends the string as a JSON string literal
+void AppendJsonString(StringBuilder& builder, cstr text)
+{
+  builder.Append('"');
+  for(cstr c = text; *c != '\0'; ++c)
   {
-    for(;!r.Empty();r.PopFront())
+    byte character = (byte)*c;
+    if(character == '"')
+      builder.Append("\\\"");
+    else if(character == '\\')
+      builder.Append("\\\\");
+    else if(character < 0x20)
+      builder.Append(String::Format("\\u%04x", (uint)character));
+    else
+      builder.Append(*c);
+  }
+  builder.Append('"');
+}
+
+void ProfileSystem::WriteChromeTrace(StringParam fileName)
+{
+  StringBuilder builder;
+  builder.Append("{\"traceEvents\":[\n");
+
+  mLock.Lock();
+  bool first = true;
+  forRange(ThreadTimeline* timeline, mTimelines.All())
+  {
+    // Thread names are metadata events
+    if(!first)
+      builder.Append(",\n");
+    first = false;
+    builder.Append(String::Format("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+                                  "\"args\":{\"name\":", timeline->mThreadIndex));
+    AppendJsonString(builder, timeline->mName.c_str());
+    builder.Append("}}");
+
+    // Complete events, nesting is recovered by the viewer from the times
+    size_t count = timeline->mCount.Load();
+    for(size_t i = 0; i < count; ++i)
     {
-      if(strcmp(r.Front()->mName,parentName)==0)
+      TraceEvent& event = timeline->GetEvent(i);
+      cstr name = event.mRecord->GetName() ? event.mRecord->GetName() : "Unnamed";
+      double start = mTimer.TicksToSeconds(event.mStart) * 1000000.0;
+      double duration = mTimer.TicksToSeconds(event.mEnd - event.mStart) * 1000000.0;
+      builder.Append(",\n{\"name\":");
+      AppendJsonString(builder, name);
+      builder.Append(String::Format(",\"cat\":\"Zero\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,"
+                                    "\"ts\":%.3f,\"dur\":%.3f}",
+                                    timeline->mThreadIndex, start, duration));
+    }
+
+    size_t dropped = timeline->mDropped.Load();
+    if(dropped != 0)
+      ZPrint("Profile trace of '%s' was full, %u scopes were dropped\n", timeline->mName.c_str(), (uint)dropped);
+  }
+  mLock.Unlock();
+
+  builder.Append("\n]}\n");
+
+  String trace = builder.ToString();
+  WriteToFile(fileName.c_str(), (const byte*)trace.Data(), trace.SizeInBytes());
+}
+
+void ProfileSystem::ResolveParent(Record* record, Record* enclosingRecord)
+{
+  mLock.Lock();
+  if(!record->mParentResolved)
+  {
+    record->mParentResolved = true;
+
+    // Placed under the enclosing record when the records are next gathered
+    PendingRecord& pending = mPendingRecords.PushBack();
+    pending.mRecord = record;
+    pending.mAdd = false;
+    pending.mParentName = nullptr;
+    pending.mEnclosingRecord = enclosingRecord;
+  }
+  mLock.Unlock();
+}
+
+void ProfileSystem::ApplyPendingRecords()
+{
+  mLock.Lock();
+  forRange(PendingRecord& pending, mPendingRecords.All())
+  {
+    Record* record = pending.mRecord;
+    if(pending.mAdd)
+    {
+      //if this object has a parent, then walk through the record list
+      //to find the parent
+      if(pending.mParentName != nullptr)
       {
-        r.Front()->AddChild(record);
-        break;
+        forRange(Record* parent, mRecordList.All())
+        {
+          if(strcmp(parent->mName, pending.mParentName) == 0)
+          {
+            parent->AddChild(record);
+            break;
+          }
+        }
       }
+
+      //always add this record to the record list
+      mRecordList.PushBack(record);
+    }
+
+    Record* enclosingRecord = pending.mEnclosingRecord;
+    if(enclosingRecord != nullptr)
+    {
+      // The first record is the root of the graph, and a record can't
+      // be placed under one of its own children
+      bool isAncestor = false;
+      for(Record* parent = enclosingRecord; parent != nullptr; parent = parent->mParent)
+        isAncestor |= (parent == record);
+
+      if(record->mParent == nullptr && record != mRecordList.Front() && !isAncestor)
+        enclosingRecord->AddChild(record);
     }
   }
+  mPendingRecords.Clear();
+  mLock.Unlock();
+}
 
-  //always add this record to the record list
-  mRecordList.PushBack(record);
+Array<Record*>::range ProfileSystem::GetRecords()
+{
+  ApplyPendingRecords();
+  return mRecordList.All();
+}
+
+float ProfileSystem::GetTimeInSeconds(ProfileTime time)
+{
+  return (float)mTimer.TicksToSeconds(time);
+}
+
+void ProfileSystem::Add(Record* record)
+{
+  Add(nullptr, record);
+}
+
+void ProfileSystem::Add(cstr parentName, Record* record)
+{
+  // Records are created the first time their scope runs (on any thread),
+  // they're added to the graph when the records are next gathered
+  mLock.Lock();
+  PendingRecord& pending = mPendingRecords.PushBack();
+  pending.mRecord = record;
+  pending.mAdd = true;
+  pending.mParentName = parentName;
+  pending.mEnclosingRecord = nullptr;
+  mLock.Unlock();
 }
 
 ProfileTime ProfileSystem::GetTime()
@@ -72,12 +307,15 @@ Record::Record(void)
   mName = nullptr;
   mParent = nullptr;
   mColor = 0xFFFFFFFF;
+  mParentResolved = true;
   Clear();
 }
 
 Record::Record(cstr name)
 { 
   Initialize(name, nullptr, 0xFFFFFFFF);
+  // Placed under whatever scope it's first entered in
+  mParentResolved = false;
 }
 
 Record::Record(cstr name, cstr parentName, u32 color)
@@ -89,6 +327,7 @@ void Record::Initialize(cstr name, cstr parentName, u32 color)
 {
   mColor = color;
   mParent = nullptr;
+  mParentResolved = true;
   mName = name;
   ProfileSystem::Instance->Add(parentName, this);
   Clear();
@@ -162,12 +401,17 @@ void Record::AddChild(Record* record)
 
 void Record::EnterRecord(ProfileTime time)
 {
-  ++mHits;
-  mTotalTime+=time;
+  // Records may be entered from any thread
+  AtomicPreIncrement((volatile s32*)&mHits);
+  AtomicFetchAdd((volatile s64*)&mTotalTime, (s64)time);
+
   //update the max time that was ever spent in this record.
-  if(time > mMaxTime)
+  ProfileTime maxTime = mMaxTime;
+  while(time > maxTime)
   {
-    mMaxTime = time;
+    if(AtomicCompareExchangeBool((volatile s64*)&mMaxTime, (s64)time, (s64)maxTime))
+      break;
+    maxTime = mMaxTime;
     //if(mInstantAvg != 0.0f && 3.0f * mInstantAvg < (float)time)
     //  DebugPrint("%s has an average of %g and spike with %g\n",mName,mInstantAvg,(float)time);
   }
@@ -176,13 +420,25 @@ void Record::EnterRecord(ProfileTime time)
 ScopeTimer::ScopeTimer(Record* data)
 {
   mData = data;
+  mParentTimer = gCurrentScopeTimer;
+  gCurrentScopeTimer = this;
+
+  if(!data->mParentResolved && mParentTimer)
+    ProfileSystem::Instance->ResolveParent(data, mParentTimer->mData);
+
   mStartTime = ProfileSystem::Instance->GetTime();
 }
 
 ScopeTimer::~ScopeTimer()
 {
-  ProfileTime endTime = ProfileSystem::Instance->GetTime();
+  ProfileSystem* system = ProfileSystem::Instance;
+  ProfileTime endTime = system->GetTime();
   mData->EnterRecord(endTime-mStartTime);
+
+  if(system->mCapturing.Load())
+    system->GetThreadTimeline()->Add(mData, mStartTime, endTime, system->mTraceCapacity.Load());
+
+  gCurrentScopeTimer = mParentTimer;
 }
 
 
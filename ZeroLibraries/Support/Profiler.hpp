@@ -12,7 +12,10 @@
 #include "Utility/Typedefs.hpp"
 #include "Containers/Array.hpp"
 #include "Containers/InList.hpp"
+#include "String/String.hpp"
+#include "Utility/Atomic.hpp"
 #include "Platform/Timer.hpp"
+#include "Platform/ThreadSync.hpp"
 
 namespace Zero
 {
@@ -23,6 +26,40 @@ namespace Profile
 // Profile Time in MS
 typedef u64 ProfileTime;
 class Record;
+class ScopeTimer;
+
+/// One completed scope on a thread's timeline.
+struct TraceEvent
+{
+  Record* mRecord;
+  ProfileTime mStart;
+  ProfileTime mEnd;
+};
+
+/// The trace events of one thread. Only the owning thread writes to it, the
+/// count is published atomically so it can be read while still capturing.
+/// Events are allocated in blocks as the timeline fills up, blocks never
+/// move so readers can index them while the owner is still adding.
+class ThreadTimeline
+{
+public:
+  static const uint cBlockSize = 1 << 12;
+  static const uint cMaxBlocks = 1 << 10;
+
+  ThreadTimeline(uint threadIndex);
+  ~ThreadTimeline();
+
+  /// Drops the event if the timeline already holds capacity events.
+  void Add(Record* record, ProfileTime start, ProfileTime end, size_t capacity);
+  TraceEvent& GetEvent(size_t index) { return mBlocks[index / cBlockSize][index % cBlockSize]; }
+
+  String mName;
+  uint mThreadIndex;
+  TraceEvent* mBlocks[cMaxBlocks];
+  Atomic<size_t> mCount;
+  /// Scopes that ended after the buffer was full
+  Atomic<size_t> mDropped;
+};
 
 /// System to manage all of the profile records.
 class ProfileSystem
@@ -31,14 +68,64 @@ public:
   static ProfileSystem* Instance;
   static void Initialize();
   static void Shutdown();
+  ~ProfileSystem();
   void Add(Record* record);
   void Add(cstr parentName, Record* record);
   float GetTimeInSeconds(ProfileTime time);
   ProfileTime GetTime();
-  Array<Record*>::range GetRecords(){ return mRecordList.All(); }
+  /// Attaches records that were created or first entered since the last
+  /// call to the graph, so only the thread walking the graph changes it.
+  Array<Record*>::range GetRecords();
+
+  /// Names the calling thread's timeline in captured traces.
+  static void SetThreadName(StringParam name);
+
+  /// Starts recording every profiled scope on every thread into per
+  /// thread timelines (the records keep being updated either way).
+  void BeginCapture();
+  void EndCapture();
+  bool IsCapturing() { return mCapturing.Load(); }
+  /// Clears the captured timelines.
+  void ClearCapture();
+  /// The most events each thread's timeline keeps (later scopes are dropped).
+  /// Timelines only allocate as they fill up.
+  void SetTraceCapacity(size_t events);
+  size_t GetTraceCapacity();
+
+  /// Writes the captured timelines in the Chrome trace event format (JSON),
+  /// which can be opened by chrome://tracing, Perfetto or imported by Tracy.
+  void WriteChromeTrace(StringParam fileName);
+
 private:
+  friend class ScopeTimer;
+  friend class Record;
+
+  /// The calling thread's timeline, created on first use
+  ThreadTimeline* GetThreadTimeline();
+  /// Makes the record a child of the record of the scope it's first entered in
+  void ResolveParent(Record* record, Record* enclosingRecord);
+  void ApplyPendingRecords();
+
+  /// A record change made on any thread, applied by GetRecords
+  struct PendingRecord
+  {
+    Record* mRecord;
+    /// Added to the record list (and placed under the named parent)
+    bool mAdd;
+    cstr mParentName;
+    /// The record of the scope it was first entered in
+    Record* mEnclosingRecord;
+  };
+
   Array<Record*> mRecordList;
   Timer mTimer;
+
+  Atomic<bool> mCapturing;
+  Atomic<size_t> mTraceCapacity;
+  /// Guards the timeline list and the pending records
+  ThreadLock mLock;
+  Array<ThreadTimeline*> mTimelines;
+  Array<PendingRecord> mPendingRecords;
 };
 
 /// Stores a timed record for a given name. This record may have a parent
@@ -85,6 +172,7 @@ public:
   void AverageRunningSample();
 
 private:
+  friend class ScopeTimer;
 
   //Display information
   u32 mColor;
@@ -104,9 +192,14 @@ private:
   void AddChild(Record* record);
   Record* mParent;
   InListBaseLink<Record> mChildren;
+  /// False until a record without an explicit parent has been entered,
+  /// it then becomes a child of the record it was entered under.
+  bool mParentResolved;
 };
 
-/// A timer that keeps a record for the given variable scope.
+/// A timer that keeps a record for the given variable scope. Timers on the
+/// same thread nest, so records made with ProfileScope are placed under the
+/// record of the enclosing scope without naming a parent.
 class ScopeTimer
 {
 public:
@@ -115,6 +208,7 @@ public:
 
   Record* mData;
   ProfileTime mStartTime;
+  ScopeTimer* mParentTimer;
 };
 
 void PrintProfileGraph();